@@ -0,0 +1,212 @@
+/*-
+ * Public Domain 2014-present MongoDB, Inc.
+ * Public Domain 2008-2014 WiredTiger, Inc.
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * In jurisdictions that recognize copyright laws, the author or authors
+ * of this software dedicate any and all copyright interest in the
+ * software to the public domain. We make this dedication for the benefit
+ * of the public at large and to the detriment of our heirs and
+ * successors. We intend this dedication to be an overt act of
+ * relinquishment in perpetuity of all present and future rights to this
+ * software under copyright law.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include "test_util.h"
+
+/*
+ * Block allocation microbenchmark.
+ *
+ * Fragment a file's free space, then time the block manager's allocation, free and extent-list
+ * merge paths for each of the block_allocation configurations.
+ *
+ * !!!! Note !!!! This program is not a proper usage of the WT API. It's white box and drives the
+ *     live checkpoint's extent lists directly through internal block manager functions, the blocks
+ *     it allocates are never written.
+ */
+
+extern int __wt_optind;
+extern char *__wt_optarg;
+
+#define ALLOCATION_SIZE 4096
+#define MAX_UNITS 16 /* Largest block, in allocation units */
+
+static const char *const modes[] = {"best", "first", "segregated"};
+
+/*
+ * usage --
+ *     Print a usage message.
+ */
+__attribute__((noreturn)) static void
+usage(void)
+{
+    fprintf(stderr, "usage: %s [-h dir] [-n blocks] [-o operations]\n", progname);
+    exit(EXIT_FAILURE);
+}
+
+/*
+ * random_size --
+ *     Return a random block size, a multiple of the allocation size.
+ */
+static wt_off_t
+random_size(WT_RAND_STATE *rnd)
+{
+    return ((wt_off_t)(__wt_random(rnd) % MAX_UNITS + 1) * ALLOCATION_SIZE);
+}
+
+/*
+ * run --
+ *     Fragment a new file and time allocation, free and merge using one allocation configuration.
+ */
+static void
+run(WT_CONNECTION *conn, const char *mode, uint32_t nblocks, uint32_t nops)
+{
+    WT_BLOCK *block;
+    WT_CURSOR *cursor;
+    WT_DATA_HANDLE *saved_dhandle;
+    WT_EXTLIST el;
+    WT_RAND_STATE rnd;
+    WT_SESSION *wt_session;
+    WT_SESSION_IMPL *session;
+    wt_off_t *frag_offs, *frag_sizes, *offs, *sizes;
+    uint64_t alloc_ns, free_ns, merge_ns, start, stop;
+    uint32_t entries, i;
+    char config[128], uri[64];
+
+    testutil_snprintf(uri, sizeof(uri), "file:block_alloc.%s", mode);
+    testutil_snprintf(
+      config, sizeof(config), "allocation_size=%d,block_allocation=%s", ALLOCATION_SIZE, mode);
+    testutil_check(conn->open_session(conn, NULL, NULL, &wt_session));
+    testutil_check(wt_session->create(wt_session, uri, config));
+    testutil_check(wt_session->open_cursor(wt_session, uri, NULL, NULL, &cursor));
+
+    /* The block manager functions find the btree through the session's data handle. */
+    session = (WT_SESSION_IMPL *)wt_session;
+    saved_dhandle = session->dhandle;
+    session->dhandle = ((WT_CURSOR_BTREE *)cursor)->dhandle;
+    block = S2BT(session)->bm->block;
+
+    /* Use the same sequence of sizes for every configuration. */
+    __wt_random_init_custom_seed(&rnd, 42);
+    frag_offs = dcalloc(nblocks, sizeof(wt_off_t));
+    frag_sizes = dcalloc(nblocks, sizeof(wt_off_t));
+    offs = dcalloc(nops, sizeof(wt_off_t));
+    sizes = dcalloc(nops, sizeof(wt_off_t));
+    for (i = 0; i < nblocks; ++i)
+        frag_sizes[i] = random_size(&rnd);
+    for (i = 0; i < nops; ++i)
+        sizes[i] = random_size(&rnd);
+
+    __wt_spin_lock(session, &block->live_lock);
+
+    /* Extend the file, then free every other block, leaving holes of varying sizes. */
+    for (i = 0; i < nblocks; ++i)
+        testutil_check(__wt_block_alloc(session, block, &frag_offs[i], frag_sizes[i]));
+    for (i = 0; i < nblocks; i += 2)
+        testutil_check(
+          __wt_block_off_free(session, block, block->objectid, frag_offs[i], frag_sizes[i]));
+    entries = block->live.avail.entries;
+
+    /* Allocate from the fragmented free space. */
+    start = __wt_clock(session);
+    for (i = 0; i < nops; ++i)
+        testutil_check(__wt_block_alloc(session, block, &offs[i], sizes[i]));
+    stop = __wt_clock(session);
+    alloc_ns = WT_CLOCKDIFF_NS(stop, start);
+
+    /* Free the allocations, coalescing them with their neighbors. */
+    start = __wt_clock(session);
+    for (i = 0; i < nops; ++i)
+        testutil_check(__wt_block_off_free(session, block, block->objectid, offs[i], sizes[i]));
+    stop = __wt_clock(session);
+    free_ns = WT_CLOCKDIFF_NS(stop, start);
+
+    /*
+     * Move the remaining blocks into a separate extent list and merge it into the available list,
+     * the way checkpoint resolution merges the checkpoint-available list.
+     */
+    testutil_check(__wt_block_extlist_init(session, &el, "bench", "merge", false));
+    for (i = 1; i < nblocks; i += 2) {
+        testutil_check(__wt_block_off_remove_overlap(
+          session, block, &block->live.alloc, frag_offs[i], frag_sizes[i]));
+        testutil_check(__wt_block_insert_ext(session, block, &el, frag_offs[i], frag_sizes[i]));
+    }
+    start = __wt_clock(session);
+    testutil_check(__wt_block_extlist_merge(session, block, &el, &block->live.avail));
+    stop = __wt_clock(session);
+    merge_ns = WT_CLOCKDIFF_NS(stop, start);
+    __wt_block_extlist_free(session, &el);
+
+    __wt_spin_unlock(session, &block->live_lock);
+
+    printf("%-10s %8" PRIu32 " extents: alloc %.1f, free %.1f, merge %.1f ns/op\n", mode, entries,
+      (double)alloc_ns / nops, (double)free_ns / nops, (double)merge_ns / (nblocks / 2));
+
+    free(frag_offs);
+    free(frag_sizes);
+    free(offs);
+    free(sizes);
+
+    session->dhandle = saved_dhandle;
+    testutil_check(cursor->close(cursor));
+    testutil_check(wt_session->close(wt_session, NULL));
+}
+
+/*
+ * main --
+ *     Run the block allocation microbenchmark for each allocation configuration.
+ */
+int
+main(int argc, char *argv[])
+{
+    WT_CONNECTION *conn;
+    size_t i;
+    uint32_t nblocks, nops;
+    int ch;
+    const char *working_dir;
+
+    progname = testutil_set_progname(argv);
+    working_dir = "WT_TEST.block_alloc";
+    nblocks = 200 * WT_THOUSAND;
+    nops = 100 * WT_THOUSAND;
+
+    while ((ch = __wt_getopt(progname, argc, argv, "h:n:o:")) != EOF)
+        switch (ch) {
+        case 'h':
+            working_dir = __wt_optarg;
+            break;
+        case 'n':
+            nblocks = (uint32_t)atoi(__wt_optarg);
+            break;
+        case 'o':
+            nops = (uint32_t)atoi(__wt_optarg);
+            break;
+        default:
+            usage();
+        }
+    argc -= __wt_optind;
+    if (argc != 0 || nblocks < 2 || nops == 0)
+        usage();
+
+    testutil_recreate_dir(working_dir);
+    testutil_check(wiredtiger_open(working_dir, NULL, "create", &conn));
+    for (i = 0; i < WT_ELEMENTS(modes); ++i)
+        run(conn, modes[i], nblocks, nops);
+    testutil_check(conn->close(conn, NULL));
+    testutil_remove(working_dir);
+
+    return (EXIT_SUCCESS);
+}
@@ -0,0 +1,256 @@
+/*-
+ * Public Domain 2014-present MongoDB, Inc.
+ * Public Domain 2008-2014 WiredTiger, Inc.
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * In jurisdictions that recognize copyright laws, the author or authors
+ * of this software dedicate any and all copyright interest in the
+ * software to the public domain. We make this dedication for the benefit
+ * of the public at large and to the detriment of our heirs and
+ * successors. We intend this dedication to be an overt act of
+ * relinquishment in perpetuity of all present and future rights to this
+ * software under copyright law.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include "test_util.h"
+
+/*
+ * Block cache microbenchmark.
+ *
+ * Time block cache puts and gets as the number of threads grows. Each round inserts a fresh set
+ * of blocks, split between the threads, then has every thread look up random blocks from the set,
+ * then removes the set.
+ *
+ * !!!! Note !!!! This program is not a proper usage of the WT API. It's white box and calls the
+ *     block cache functions directly with made-up address cookies, no blocks are ever read from or
+ *     written to the file.
+ */
+
+extern int __wt_optind;
+extern char *__wt_optarg;
+
+#define BLOCK_SIZE 4096
+#define MAX_THREADS 128
+#define URI "file:block_cache"
+
+typedef struct {
+    WT_CONNECTION *conn;
+    WT_ITEM *data;    /* Block contents */
+    uint32_t round;   /* Address cookie prefix */
+    uint32_t start;   /* First block to insert */
+    uint32_t stop;    /* Last block to insert, exclusive */
+    uint32_t nblocks; /* Blocks to look up */
+    uint32_t nops;    /* Lookups */
+    bool lookup;      /* Lookup or insert */
+    uint64_t hits;    /* Lookups that found the block */
+} THREAD_DATA;
+
+/*
+ * usage --
+ *     Print a usage message.
+ */
+__attribute__((noreturn)) static void
+usage(void)
+{
+    fprintf(stderr, "usage: %s [-h dir] [-n blocks] [-o operations] [-t threads]\n", progname);
+    exit(EXIT_FAILURE);
+}
+
+/*
+ * make_addr --
+ *     Build a block's address cookie.
+ */
+static void
+make_addr(uint8_t *addr, uint32_t round, uint32_t n)
+{
+    memcpy(addr, &round, sizeof(round));
+    memcpy(addr + sizeof(round), &n, sizeof(n));
+}
+
+/*
+ * thread_run --
+ *     Insert a range of blocks, or look up random blocks.
+ */
+static WT_THREAD_RET
+thread_run(void *arg)
+{
+    THREAD_DATA *td;
+    WT_BLKCACHE_ITEM *blkcache_item;
+    WT_CURSOR *cursor;
+    WT_RAND_STATE rnd;
+    WT_SESSION *wt_session;
+    WT_SESSION_IMPL *session;
+    uint32_t i;
+    uint8_t addr[8];
+    bool found, skip_cache_put;
+
+    td = (THREAD_DATA *)arg;
+    testutil_check(td->conn->open_session(td->conn, NULL, NULL, &wt_session));
+    testutil_check(wt_session->open_cursor(wt_session, URI, NULL, NULL, &cursor));
+
+    /* The block cache functions find the file ID through the session's data handle. */
+    session = (WT_SESSION_IMPL *)wt_session;
+    session->dhandle = ((WT_CURSOR_BTREE *)cursor)->dhandle;
+
+    if (td->lookup) {
+        __wt_random_init_custom_seed(&rnd, (uint64_t)td->start + 1);
+        for (i = 0; i < td->nops; ++i) {
+            make_addr(addr, td->round, __wt_random(&rnd) % td->nblocks);
+            __wt_blkcache_get(
+              session, addr, sizeof(addr), &blkcache_item, &found, &skip_cache_put);
+            if (found) {
+                ++td->hits;
+                (void)__wt_atomic_subv32(&blkcache_item->ref_count, 1);
+            }
+        }
+    } else
+        for (i = td->start; i < td->stop; ++i) {
+            make_addr(addr, td->round, i);
+            testutil_check(__wt_blkcache_put(session, td->data, addr, sizeof(addr), false));
+        }
+
+    session->dhandle = NULL;
+    testutil_check(cursor->close(cursor));
+    testutil_check(wt_session->close(wt_session, NULL));
+    return (WT_THREAD_RET_VALUE);
+}
+
+/*
+ * run --
+ *     Run the threads for one phase of a round, returning the elapsed time in nanoseconds.
+ */
+static uint64_t
+run(THREAD_DATA *td, u_int nthreads)
+{
+    struct timespec start, stop;
+    wt_thread_t thr[MAX_THREADS];
+    u_int i;
+
+    __wt_epoch(NULL, &start);
+    for (i = 0; i < nthreads; ++i)
+        testutil_check(__wt_thread_create(NULL, &thr[i], thread_run, &td[i]));
+    for (i = 0; i < nthreads; ++i)
+        testutil_check(__wt_thread_join(NULL, &thr[i]));
+    __wt_epoch(NULL, &stop);
+    return (WT_TIMEDIFF_NS(stop, start));
+}
+
+/*
+ * main --
+ *     Run the block cache microbenchmark for an increasing number of threads.
+ */
+int
+main(int argc, char *argv[])
+{
+    THREAD_DATA td[MAX_THREADS];
+    WT_CONNECTION *conn;
+    WT_CURSOR *cursor;
+    WT_DATA_HANDLE *saved_dhandle;
+    WT_ITEM data;
+    WT_SESSION *wt_session;
+    WT_SESSION_IMPL *session;
+    uint64_t get_ns, hits, put_ns;
+    uint32_t i, nblocks, nops, round;
+    u_int maxthreads, nthreads, t;
+    int ch;
+    char config[256];
+    const char *working_dir;
+    uint8_t addr[8];
+
+    progname = testutil_set_progname(argv);
+    working_dir = "WT_TEST.block_cache";
+    nblocks = 100 * WT_THOUSAND;
+    nops = WT_MILLION;
+    maxthreads = 32;
+
+    while ((ch = __wt_getopt(progname, argc, argv, "h:n:o:t:")) != EOF)
+        switch (ch) {
+        case 'h':
+            working_dir = __wt_optarg;
+            break;
+        case 'n':
+            nblocks = (uint32_t)atoi(__wt_optarg);
+            break;
+        case 'o':
+            nops = (uint32_t)atoi(__wt_optarg);
+            break;
+        case 't':
+            maxthreads = (u_int)atoi(__wt_optarg);
+            break;
+        default:
+            usage();
+        }
+    argc -= __wt_optind;
+    if (argc != 0 || nblocks == 0 || nops == 0 || maxthreads == 0 || maxthreads > MAX_THREADS)
+        usage();
+
+    /* Size the cache to hold every block, this measures the table, not eviction. */
+    testutil_recreate_dir(working_dir);
+    testutil_snprintf(config, sizeof(config),
+      "create,session_max=%u,block_cache=(enabled=true,type=dram,size=%" PRIu64 "MB)",
+      maxthreads + 10, ((uint64_t)nblocks * BLOCK_SIZE * 2) / WT_MEGABYTE + 1);
+    testutil_check(wiredtiger_open(working_dir, NULL, config, &conn));
+    testutil_check(conn->open_session(conn, NULL, NULL, &wt_session));
+    testutil_check(wt_session->create(wt_session, URI, NULL));
+    testutil_check(wt_session->open_cursor(wt_session, URI, NULL, NULL, &cursor));
+    session = (WT_SESSION_IMPL *)wt_session;
+
+    memset(&data, 0, sizeof(data));
+    data.mem = dcalloc(1, BLOCK_SIZE);
+    data.data = data.mem;
+    data.size = BLOCK_SIZE;
+
+    printf("%8s %16s %16s %8s\n", "threads", "put ops/sec", "get ops/sec", "hit %");
+    for (round = 0, nthreads = 1; nthreads <= maxthreads; ++round, nthreads *= 2) {
+        memset(td, 0, sizeof(td));
+        for (t = 0; t < nthreads; ++t) {
+            td[t].conn = conn;
+            td[t].data = &data;
+            td[t].round = round;
+            td[t].start = (uint32_t)(((uint64_t)nblocks * t) / nthreads);
+            td[t].stop = (uint32_t)(((uint64_t)nblocks * (t + 1)) / nthreads);
+            td[t].nblocks = nblocks;
+            td[t].nops = nops;
+        }
+        put_ns = run(td, nthreads);
+
+        for (t = 0; t < nthreads; ++t)
+            td[t].lookup = true;
+        get_ns = run(td, nthreads);
+        for (hits = 0, t = 0; t < nthreads; ++t)
+            hits += td[t].hits;
+
+        printf("%8u %16.0f %16.0f %8.1f\n", nthreads, (double)nblocks * WT_BILLION / put_ns,
+          (double)nops * nthreads * WT_BILLION / get_ns,
+          (double)hits * 100 / ((double)nops * nthreads));
+
+        /* Empty the cache for the next round. */
+        saved_dhandle = session->dhandle;
+        session->dhandle = ((WT_CURSOR_BTREE *)cursor)->dhandle;
+        for (i = 0; i < nblocks; ++i) {
+            make_addr(addr, round, i);
+            __wt_blkcache_remove(session, addr, sizeof(addr));
+        }
+        session->dhandle = saved_dhandle;
+    }
+
+    free(data.mem);
+    testutil_check(cursor->close(cursor));
+    testutil_check(conn->close(conn, NULL));
+    testutil_remove(working_dir);
+
+    return (EXIT_SUCCESS);
+}
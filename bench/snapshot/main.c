@@ -0,0 +1,235 @@
+/*-
+ * Public Domain 2014-present MongoDB, Inc.
+ * Public Domain 2008-2014 WiredTiger, Inc.
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * In jurisdictions that recognize copyright laws, the author or authors
+ * of this software dedicate any and all copyright interest in the
+ * software to the public domain. We make this dedication for the benefit
+ * of the public at large and to the detriment of our heirs and
+ * successors. We intend this dedication to be an overt act of
+ * relinquishment in perpetuity of all present and future rights to this
+ * software under copyright law.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include "test_util.h"
+
+/*
+ * Snapshot benchmark.
+ *
+ * Hold a number of transactions open with transaction IDs so readers can't skip building a
+ * snapshot, then run threads beginning a snapshot transaction, reading a key and committing, and
+ * report the throughput by session count. Idle sessions can be opened to grow the session array
+ * each snapshot would otherwise have to walk. Snapshots copied from the cache keyed by the commit
+ * sequence number are reported as a fraction of all snapshots taken.
+ */
+
+extern int __wt_optind;
+extern char *__wt_optarg;
+
+#define MAX_THREADS 128
+#define URI "table:snapshot"
+
+static WT_CONNECTION *conn;
+static uint64_t nkeys;
+static wt_shared uint64_t ops;
+static wt_shared bool running;
+
+/*
+ * usage --
+ *     Print a usage message.
+ */
+__attribute__((noreturn)) static void
+usage(void)
+{
+    fprintf(stderr,
+      "usage: %s [-h dir] [-i idle sessions] [-l long transactions] [-s seconds] [-t threads]\n",
+      progname);
+    exit(EXIT_FAILURE);
+}
+
+/*
+ * get_stat --
+ *     Return a connection statistic.
+ */
+static uint64_t
+get_stat(WT_SESSION *session, int which)
+{
+    WT_CURSOR *cursor;
+    int64_t value;
+
+    testutil_check(session->open_cursor(session, "statistics:", NULL, NULL, &cursor));
+    cursor->set_key(cursor, which);
+    testutil_check(cursor->search(cursor));
+    testutil_check(cursor->get_value(cursor, NULL, NULL, &value));
+    testutil_check(cursor->close(cursor));
+    return ((uint64_t)value);
+}
+
+/*
+ * reader --
+ *     Run short read transactions until told to stop.
+ */
+static WT_THREAD_RET
+reader(void *arg)
+{
+    WT_CURSOR *cursor;
+    WT_RAND_STATE rnd;
+    WT_SESSION *session;
+    uint64_t n;
+
+    __wt_random_init_custom_seed(&rnd, (uint64_t)(uintptr_t)arg);
+    testutil_check(conn->open_session(conn, NULL, NULL, &session));
+    testutil_check(session->open_cursor(session, URI, NULL, NULL, &cursor));
+    for (n = 0; __wt_atomic_loadbool(&running); ++n) {
+        testutil_check(session->begin_transaction(session, "isolation=snapshot"));
+        cursor->set_key(cursor, __wt_random(&rnd) % nkeys + 1);
+        testutil_check(cursor->search(cursor));
+        testutil_check(cursor->reset(cursor));
+        testutil_check(session->commit_transaction(session, NULL));
+        if (n % 100 == 99)
+            (void)__wt_atomic_add64(&ops, 100);
+    }
+    testutil_check(session->close(session, NULL));
+    return (WT_THREAD_RET_VALUE);
+}
+
+/*
+ * run --
+ *     Run the readers for the given number of seconds and return the throughput in operations per
+ *     second.
+ */
+static uint64_t
+run(u_int nthreads, u_int seconds)
+{
+    struct timespec start, stop;
+    wt_thread_t thr[MAX_THREADS];
+    uint64_t total;
+    u_int i;
+
+    ops = 0;
+    running = true;
+    __wt_epoch(NULL, &start);
+    for (i = 0; i < nthreads; ++i)
+        testutil_check(__wt_thread_create(NULL, &thr[i], reader, (void *)(uintptr_t)(i + 1)));
+    __wt_sleep(seconds, 0);
+    __wt_atomic_storebool(&running, false);
+    for (i = 0; i < nthreads; ++i)
+        testutil_check(__wt_thread_join(NULL, &thr[i]));
+    __wt_epoch(NULL, &stop);
+
+    total = __wt_atomic_load64(&ops);
+    return ((uint64_t)((double)total * WT_BILLION / WT_TIMEDIFF_NS(stop, start)));
+}
+
+/*
+ * main --
+ *     Run the snapshot benchmark.
+ */
+int
+main(int argc, char *argv[])
+{
+    WT_CURSOR *cursor;
+    WT_SESSION *idle[MAX_THREADS], *session;
+    uint64_t cached, i, missed, throughput;
+    u_int nidle, nlong, nthreads, seconds, threads;
+    int ch;
+    char config[256];
+    const char *working_dir;
+
+    progname = testutil_set_progname(argv);
+    working_dir = "WT_TEST.snapshot";
+    nkeys = 10 * WT_THOUSAND;
+    nidle = 0;
+    nlong = 4;
+    nthreads = 16;
+    seconds = 5;
+
+    while ((ch = __wt_getopt(progname, argc, argv, "h:i:l:s:t:")) != EOF)
+        switch (ch) {
+        case 'h':
+            working_dir = __wt_optarg;
+            break;
+        case 'i':
+            nidle = (u_int)atoi(__wt_optarg);
+            break;
+        case 'l':
+            nlong = (u_int)atoi(__wt_optarg);
+            break;
+        case 's':
+            seconds = (u_int)atoi(__wt_optarg);
+            break;
+        case 't':
+            nthreads = (u_int)atoi(__wt_optarg);
+            break;
+        default:
+            usage();
+        }
+    argc -= __wt_optind;
+    if (argc != 0 || seconds == 0 || nthreads == 0 || nthreads > MAX_THREADS ||
+      nidle + nlong > MAX_THREADS || nlong >= nkeys)
+        usage();
+
+    testutil_recreate_dir(working_dir);
+    testutil_snprintf(config, sizeof(config),
+      "create,cache_size=100MB,session_max=%u,statistics=(fast)", nthreads + nidle + nlong + 10);
+    testutil_check(wiredtiger_open(working_dir, NULL, config, &conn));
+    testutil_check(conn->open_session(conn, NULL, NULL, &session));
+    testutil_check(session->create(session, URI, "key_format=Q,value_format=Q"));
+    testutil_check(session->open_cursor(session, URI, NULL, NULL, &cursor));
+    for (i = 1; i <= nkeys; ++i) {
+        cursor->set_key(cursor, i);
+        cursor->set_value(cursor, i);
+        testutil_check(cursor->insert(cursor));
+    }
+    testutil_check(cursor->close(cursor));
+
+    /*
+     * Open the idle sessions. The first of them leave a transaction running with an ID, so
+     * snapshots can't take the read-only shortcut and always have something to record.
+     */
+    for (i = 0; i < nidle + nlong; ++i) {
+        testutil_check(conn->open_session(conn, NULL, NULL, &idle[i]));
+        if (i >= nlong)
+            continue;
+        testutil_check(idle[i]->begin_transaction(idle[i], NULL));
+        testutil_check(idle[i]->open_cursor(idle[i], URI, NULL, NULL, &cursor));
+        cursor->set_key(cursor, nkeys - i);
+        cursor->set_value(cursor, 0);
+        testutil_check(cursor->update(cursor));
+        testutil_check(cursor->close(cursor));
+    }
+
+    printf("%8s %16s %16s\n", "sessions", "ops/sec", "cached snapshots");
+    for (threads = 1;; threads = WT_MIN(threads * 2, nthreads)) {
+        cached = get_stat(session, WT_STAT_CONN_TXN_SNAPSHOT_CACHED);
+        missed = get_stat(session, WT_STAT_CONN_TXN_SNAPSHOT_CACHE_MISS);
+        throughput = run(threads, seconds);
+        cached = get_stat(session, WT_STAT_CONN_TXN_SNAPSHOT_CACHED) - cached;
+        missed = get_stat(session, WT_STAT_CONN_TXN_SNAPSHOT_CACHE_MISS) - missed;
+        printf("%8u %16" PRIu64 " %15.1f%%\n", threads, throughput,
+          cached + missed == 0 ? 0.0 : 100.0 * (double)cached / (double)(cached + missed));
+        if (threads == nthreads)
+            break;
+    }
+
+    for (i = 0; i < nlong; ++i)
+        testutil_check(idle[i]->rollback_transaction(idle[i], NULL));
+    testutil_check(conn->close(conn, NULL));
+
+    testutil_remove(working_dir);
+    return (EXIT_SUCCESS);
+}
@@ -0,0 +1,280 @@
+/*-
+ * Public Domain 2014-present MongoDB, Inc.
+ * Public Domain 2008-2014 WiredTiger, Inc.
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * In jurisdictions that recognize copyright laws, the author or authors
+ * of this software dedicate any and all copyright interest in the
+ * software to the public domain. We make this dedication for the benefit
+ * of the public at large and to the detriment of our heirs and
+ * successors. We intend this dedication to be an overt act of
+ * relinquishment in perpetuity of all present and future rights to this
+ * software under copyright law.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include "test_util.h"
+
+/*
+ * Warm restart benchmark.
+ *
+ * Populate a table, then run random reads over a hot subset of the keys until the cache is warm and
+ * record the steady state throughput. Then restart the database, once without and once with warm
+ * restart configured, and time how long the same workload takes to get back to 90% of the steady
+ * state throughput, counting from the call to wiredtiger_open.
+ *
+ * The operating system's buffer cache isn't dropped between runs, configure direct I/O to measure
+ * the cost of going to disk.
+ */
+
+extern int __wt_optind;
+extern char *__wt_optarg;
+
+#define INTERVAL_MS 100
+#define MAX_THREADS 64
+#define URI "table:warm_restart"
+#define VALUE_SIZE 200
+
+static WT_CONNECTION *conn;
+static uint64_t hot_keys;
+static wt_shared uint64_t ops;
+static wt_shared bool running;
+
+/*
+ * usage --
+ *     Print a usage message.
+ */
+__attribute__((noreturn)) static void
+usage(void)
+{
+    fprintf(stderr, "usage: %s [-d] [-h dir] [-k hot keys] [-n keys] [-s seconds] [-t threads]\n",
+      progname);
+    exit(EXIT_FAILURE);
+}
+
+/*
+ * get_stat --
+ *     Return a connection statistic.
+ */
+static uint64_t
+get_stat(WT_SESSION *session, int which)
+{
+    WT_CURSOR *cursor;
+    int64_t value;
+
+    testutil_check(session->open_cursor(session, "statistics:", NULL, NULL, &cursor));
+    cursor->set_key(cursor, which);
+    testutil_check(cursor->search(cursor));
+    testutil_check(cursor->get_value(cursor, NULL, NULL, &value));
+    testutil_check(cursor->close(cursor));
+    return ((uint64_t)value);
+}
+
+/*
+ * reader --
+ *     Read random keys from the hot set until told to stop.
+ */
+static WT_THREAD_RET
+reader(void *arg)
+{
+    WT_CURSOR *cursor;
+    WT_RAND_STATE rnd;
+    WT_SESSION *session;
+    uint64_t n;
+
+    __wt_random_init_custom_seed(&rnd, (uint64_t)(uintptr_t)arg);
+    testutil_check(conn->open_session(conn, NULL, NULL, &session));
+    testutil_check(session->open_cursor(session, URI, NULL, NULL, &cursor));
+    for (n = 0; __wt_atomic_loadbool(&running); ++n) {
+        cursor->set_key(cursor, __wt_random(&rnd) % hot_keys + 1);
+        testutil_check(cursor->search(cursor));
+        testutil_check(cursor->reset(cursor));
+        if (n % 100 == 99)
+            (void)__wt_atomic_add64(&ops, 100);
+    }
+    testutil_check(session->close(session, NULL));
+    return (WT_THREAD_RET_VALUE);
+}
+
+/*
+ * run --
+ *     Run the readers. With a target, stop once an interval reaches the target throughput and
+ *     return the time since the start in milliseconds; without a target, run for the given number
+ *     of seconds and return the throughput of the second half of the run in operations per second.
+ */
+static uint64_t
+run(u_int nthreads, struct timespec *start, double target, u_int seconds)
+{
+    struct timespec half, now;
+    wt_thread_t thr[MAX_THREADS];
+    uint64_t half_ops, last, total;
+    u_int i;
+
+    ops = 0;
+    running = true;
+    for (i = 0; i < nthreads; ++i)
+        testutil_check(__wt_thread_create(NULL, &thr[i], reader, (void *)(uintptr_t)(i + 1)));
+
+    half_ops = last = 0;
+    __wt_epoch(NULL, &half);
+    for (;;) {
+        __wt_sleep(0, INTERVAL_MS * WT_THOUSAND);
+        __wt_epoch(NULL, &now);
+        total = __wt_atomic_load64(&ops);
+        if (target > 0) {
+            if ((double)(total - last) * WT_THOUSAND / INTERVAL_MS >= target)
+                break;
+            last = total;
+            if (WT_TIMEDIFF_SEC(now, *start) > 10 * seconds) {
+                printf("never reached the target throughput\n");
+                break;
+            }
+        } else {
+            if (half_ops == 0 && WT_TIMEDIFF_SEC(now, *start) >= seconds / 2) {
+                half_ops = total;
+                half = now;
+            }
+            if (WT_TIMEDIFF_SEC(now, *start) >= seconds)
+                break;
+        }
+    }
+
+    __wt_atomic_storebool(&running, false);
+    for (i = 0; i < nthreads; ++i)
+        testutil_check(__wt_thread_join(NULL, &thr[i]));
+
+    if (target > 0)
+        return (WT_TIMEDIFF_MS(now, *start));
+    return ((uint64_t)((double)(total - half_ops) * WT_BILLION / WT_TIMEDIFF_NS(now, half)));
+}
+
+/*
+ * restart --
+ *     Reopen the database and time how long the workload takes to warm up.
+ */
+static void
+restart(const char *working_dir, const char *config, bool warm, u_int nthreads, uint64_t steady,
+  u_int seconds)
+{
+    struct timespec start;
+    WT_SESSION *session;
+    uint64_t ms, queued;
+    char open_config[512];
+
+    testutil_snprintf(open_config, sizeof(open_config),
+      "%s,statistics=(fast),prefetch=(available=true,warm_restart=%s)", config,
+      warm ? "true" : "false");
+    __wt_epoch(NULL, &start);
+    testutil_check(wiredtiger_open(working_dir, NULL, open_config, &conn));
+    ms = run(nthreads, &start, 0.9 * (double)steady, seconds);
+
+    testutil_check(conn->open_session(conn, NULL, NULL, &session));
+    queued = get_stat(session, WT_STAT_CONN_PREFETCH_WARM_PAGES_QUEUED);
+    testutil_check(session->close(session, NULL));
+    printf("%-16s %12" PRIu64 " ms to 90%% of steady state, %" PRIu64 " pages pre-fetched\n",
+      warm ? "warm restart" : "cold restart", ms, queued);
+
+    /* Without warm restart configured, closing doesn't replace the list of pages. */
+    testutil_check(conn->close(conn, NULL));
+}
+
+/*
+ * main --
+ *     Run the warm restart benchmark.
+ */
+int
+main(int argc, char *argv[])
+{
+    struct timespec start;
+    WT_CURSOR *cursor;
+    WT_SESSION *session;
+    uint64_t i, nkeys, steady;
+    u_int nthreads, seconds;
+    int ch;
+    char config[256], open_config[512], value[VALUE_SIZE];
+    const char *working_dir;
+    bool direct_io;
+
+    progname = testutil_set_progname(argv);
+    working_dir = "WT_TEST.warm_restart";
+    direct_io = false;
+    nkeys = WT_MILLION;
+    hot_keys = 200 * WT_THOUSAND;
+    nthreads = 8;
+    seconds = 10;
+
+    while ((ch = __wt_getopt(progname, argc, argv, "dh:k:n:s:t:")) != EOF)
+        switch (ch) {
+        case 'd':
+            direct_io = true;
+            break;
+        case 'h':
+            working_dir = __wt_optarg;
+            break;
+        case 'k':
+            hot_keys = (uint64_t)atoll(__wt_optarg);
+            break;
+        case 'n':
+            nkeys = (uint64_t)atoll(__wt_optarg);
+            break;
+        case 's':
+            seconds = (u_int)atoi(__wt_optarg);
+            break;
+        case 't':
+            nthreads = (u_int)atoi(__wt_optarg);
+            break;
+        default:
+            usage();
+        }
+    argc -= __wt_optind;
+    if (argc != 0 || nkeys == 0 || hot_keys == 0 || hot_keys > nkeys || seconds < 2 ||
+      nthreads == 0 || nthreads > MAX_THREADS)
+        usage();
+
+    /* Size the cache to hold the hot set, with room to spare. */
+    testutil_snprintf(config, sizeof(config), "cache_size=%" PRIu64 "MB,session_max=%u%s",
+      (hot_keys * VALUE_SIZE * 2) / WT_MEGABYTE + 50, nthreads + 10,
+      direct_io ? ",direct_io=[data]" : "");
+
+    /* Populate the table and warm the cache. */
+    testutil_recreate_dir(working_dir);
+    testutil_snprintf(open_config, sizeof(open_config),
+      "%s,create,prefetch=(available=true,warm_restart=true)", config);
+    testutil_check(wiredtiger_open(working_dir, NULL, open_config, &conn));
+    testutil_check(conn->open_session(conn, NULL, NULL, &session));
+    testutil_check(session->create(session, URI, "key_format=Q,value_format=S"));
+    testutil_check(session->open_cursor(session, URI, NULL, "bulk", &cursor));
+    memset(value, 'a', sizeof(value) - 1);
+    value[sizeof(value) - 1] = '\0';
+    for (i = 1; i <= nkeys; ++i) {
+        cursor->set_key(cursor, i);
+        cursor->set_value(cursor, value);
+        testutil_check(cursor->insert(cursor));
+    }
+    testutil_check(cursor->close(cursor));
+    testutil_check(session->checkpoint(session, NULL));
+    testutil_check(session->close(session, NULL));
+
+    __wt_epoch(NULL, &start);
+    steady = run(nthreads, &start, 0, seconds);
+    printf("%-16s %12" PRIu64 " ops/sec\n", "steady state", steady);
+    testutil_check(conn->close(conn, NULL));
+
+    restart(working_dir, config, false, nthreads, steady, seconds);
+    restart(working_dir, config, true, nthreads, steady, seconds);
+
+    testutil_remove(working_dir);
+    return (EXIT_SUCCESS);
+}
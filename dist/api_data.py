@@ -259,10 +259,12 @@ file_runtime_config = common_runtime_config + [
 # Per-file configuration
 file_config = format_meta + file_runtime_config + tiered_config + [
     Config('block_allocation', 'best', r'''
-        configure block allocation. Permitted values are \c "best" or \c "first"; the \c "best"
-        configuration uses a best-fit algorithm, the \c "first" configuration uses a
-        first-available algorithm during block allocation''',
-        choices=['best', 'first',]),
+        configure block allocation. Permitted values are \c "best", \c "first" or
+        \c "segregated"; the \c "best" configuration uses a best-fit algorithm, the \c "first"
+        configuration uses a first-available algorithm during block allocation, the
+        \c "segregated" configuration tracks free space in power-of-two size classes, trading
+        some best-fit precision for allocation cost that doesn't grow with file fragmentation''',
+        choices=['best', 'first', 'segregated',]),
     Config('allocation_size', '4KB', r'''
         the file unit allocation size, in bytes, must be a power of two; smaller values decrease
         the file space required by overflow items, and the default value of 4KB is a good choice
@@ -281,6 +283,20 @@ file_config = format_meta + file_runtime_config + tiered_config + [
         \c unencrypted setting only checksums blocks that are not encrypted. See @ref
         tune_checksum for more information.''',
         choices=['on', 'off', 'uncompressed', 'unencrypted']),
+    Config('checkpoint_extent_lists', '', r'''
+        configure how checkpoints write the file's extent lists''',
+        type='category', subconfig=[
+        Config('incremental', 'false', r'''
+            write the list of available file blocks as the changes since a previously written
+            full list, instead of rewriting the full list at every checkpoint. Files written
+            with this setting cannot be opened by releases without support for incremental
+            extent lists''',
+            type='boolean'),
+        Config('consolidate', '25', r'''
+            when writing incremental extent lists, write the full list instead once the changes
+            reach this percentage of the full list's size''',
+            min='1', max='100'),
+        ]),
     Config('dictionary', '0', r'''
         the maximum number of unique values remembered in the row-store/variable-length column-store
         leaf page value dictionary; see @ref file_formats_compression for more information''',
@@ -301,6 +317,23 @@ file_config = format_meta + file_runtime_config + tiered_config + [
     Config('format', 'btree', r'''
         the file format''',
         choices=['btree']),
+    Config('history_store', '', r'''
+        configure the history store for the file''',
+        type='category', subconfig=[
+        Config('separate', 'false', r'''
+            keep the file's history in a history store file of its own instead of the shared
+            history store. Searches for the file's history aren't slowed by other files' history,
+            and the history is discarded with the file when it is dropped. Ignored for in-memory
+            databases''',
+            type='boolean'),
+        Config('reverse_modify_max', '10', r'''
+            the maximum number of consecutive versions of a value written to the history store as
+            reverse deltas against the next newer version, after which a full value is written.
+            Deltas make the history store smaller when large values change by a few bytes at a
+            time; the limit bounds the number of deltas applied to read an old version. A value of
+            0 writes every version as a full value''',
+            min='0', max='1000'),
+        ]),
     Config('huffman_key', 'none', r'''
         This option is no longer supported, retained for backward compatibility''', undoc=True),
     Config('huffman_value', 'none', r'''
@@ -478,12 +511,23 @@ connection_runtime_config = [
     Config('block_cache', '', r'''
         block cache configuration options''',
         type='category', subconfig=[
+        Config('admission', 'none', r'''
+            the policy for admitting blocks read from disk once the block cache is full. With
+            \c tinylfu, a block is admitted only if its recent access frequency is estimated to
+            be higher than that of the cached block it competes with, which keeps scans from
+            displacing frequently used blocks''',
+            choices=['none', 'tinylfu']),
         Config('cache_on_checkpoint', 'true', r'''
             cache blocks written by a checkpoint''',
             type='boolean'),
         Config('cache_on_writes', 'true', r'''
             cache blocks as they are written (other than checkpoint blocks)''',
             type='boolean'),
+        Config('compressor', 'none', r'''
+            store blocks in the block cache compressed, decompressing them when they are read
+            from the cache. Permitted values are \c "none" or the name of a compressor loaded
+            with WT_CONNECTION::add_compressor, for example \c "lz4". Blocks that don't compress
+            are stored uncompressed'''),
         Config('enabled', 'false', r'''
             enable block cache''',
             type='boolean'),
@@ -498,7 +542,9 @@ connection_runtime_config = [
             maximum memory to allocate for the block cache''',
             min='0', max='10TB'),
         Config('hashsize', '32768', r'''
-            number of buckets in the hashtable that keeps track of blocks''',
+            number of buckets in the hashtable that keeps track of blocks. Each bucket holds up
+            to 8 blocks, and the number of buckets is increased if needed to hold the configured
+            cache size in 16KB blocks''',
             min='512', max='256K'),
         Config('max_percent_overhead', '10', r'''
             maximum tolerated overhead expressed as the number of blocks added and removed as
@@ -507,6 +553,11 @@ connection_runtime_config = [
             min='1', max='500'),
         Config('nvram_path', '', r'''
             the absolute path to the file system mounted on the NVRAM device'''),
+        Config('promote_references', '20', r'''
+            the number of times a compressed block is read from the block cache before it is
+            stored uncompressed, as long as the cache is below its \c full_target. The value 0
+            keeps blocks compressed''',
+            min='0', max='1000'),
         Config('percent_file_in_dram', '50', r'''
             bypass cache for a file if the set percentage of the file fits in system DRAM
             (as specified by block_cache.system_ram)''',
@@ -541,12 +592,26 @@ connection_runtime_config = [
         periodically checkpoint the database. Enabling the checkpoint server uses a session
         from the configured \c session_max''',
         type='category', subconfig=[
+        Config('flush_wait', '0', r'''
+            seconds to wait between background writes of the dirty leaf pages of all open files
+            while waiting for the next periodic checkpoint. Each checkpoint then has fewer dirty
+            pages to write, shortening it and the stalls it causes. Pages updated since the
+            previous write are left to the checkpoint. Setting this value to 0 disables background
+            writes, and they have no effect unless \c wait is configured''',
+            min='0', max='100000'),
         Config('log_size', '0', r'''
             wait for this amount of log record bytes to be written to the log between each
             checkpoint. If non-zero, this value will use a minimum of the log file size.
             A database can configure both log_size and wait to set an upper bound for checkpoints;
             setting this value above 0 configures periodic checkpoints''',
             min='0', max='2GB'),
+        Config('pacing', '0', r'''
+            spread the writes of each periodic checkpoint over this percentage of the \c wait
+            interval. The checkpoint's writes are throttled to the rate needed to write the
+            remaining dirty data by the end of that period, smoothing the I/O a checkpoint
+            causes. If the checkpoint falls behind, it writes as fast as possible. Setting this
+            value to 0 disables pacing, and pacing has no effect unless \c wait is configured''',
+            min='0', max='100'),
         Config('wait', '0', r'''
             seconds to wait between each checkpoint; setting this value above 0 configures
             periodic checkpoints''',
@@ -967,6 +1032,13 @@ wiredtiger_open_log_configuration = [
             compression engine name created with WT_CONNECTION::add_compressor. If WiredTiger
             has builtin support for \c "lz4", \c "snappy", \c "zlib" or \c "zstd" compression,
             these names are also available. See @ref compression for more information'''),
+        Config('dictionary_size', '0', r'''
+            the size of a dictionary built from samples of recent log records and used to
+            compress log records, if the log compressor supports dictionaries. A new dictionary
+            is built as log files are created, and the dictionaries are stored in the log files
+            that use them. Log files written with dictionaries cannot be read by releases
+            without dictionary support. If 0, records are compressed without a dictionary''',
+            min='0', max='1MB'),
         Config('file_max', '100MB', r'''
             the maximum size of log files''',
             min='100KB',    # !!! Must match WT_LOG_FILE_MIN
@@ -983,7 +1055,12 @@ wiredtiger_open_log_configuration = [
         Config('recover', 'on', r'''
             run recovery or fail with an error if recovery needs to run after an unclean
             shutdown''',
-            choices=['error', 'on'])
+            choices=['error', 'on']),
+        Config('recover_threads', '0', r'''
+            the number of threads applying log records during recovery. Operations are
+            partitioned among the threads by file and key, so operations on the same key are
+            applied in log order. If 0, log records are applied by the thread running recovery''',
+            min='0', max='32'),
     ]),
 ]
 
@@ -1096,6 +1173,11 @@ wiredtiger_open_chunk_cache_configuration = [
         Config('chunk_size', '1MB', r'''
             size of cached chunks''',
             min='512KB', max='100GB'),
+        Config('prefetch_chunks', '0', r'''
+            number of chunks to read ahead when an object is read sequentially. Sequential
+            access is detected per object and the following chunks are read in the background
+            by the chunk cache thread. Zero disables read-ahead''',
+            min='0', max='64'),
         Config('storage_path', '', r'''
             the path (absolute or relative) to the file used as cache location. This should be on a
             filesystem that supports file truncation. All filesystems in common use
@@ -1268,6 +1350,15 @@ wiredtiger_open_common =\
         Config('default', 'false', r'''
             whether pre-fetch is enabled for all sessions by default''',
             type='boolean'),
+        Config('warm_restart', 'false', r'''
+            record the most recently used pages of each tree in cache at checkpoint, including
+            the checkpoint taken on clean shutdown. When the database is next opened, pre-fetch
+            the recorded pages in the background, most recently used first, until the cache
+            reaches its eviction trigger. Requires \c prefetch.available''',
+            type='boolean'),
+        Config('warm_restart_pages', '10000', r'''
+            the maximum number of pages recorded per tree for warm restart''',
+            min='1', max='1M'),
         ]),
     Config('readonly', 'false', r'''
         open connection in read-only mode. The database must exist. All methods that may
@@ -1295,6 +1386,12 @@ wiredtiger_open_common =\
             whether to sync the log on every commit by default, can be overridden by the \c
             sync setting to WT_SESSION::commit_transaction''',
             type='boolean'),
+        Config('latency_target', '0', r'''
+            target latency for synchronous commits, in microseconds. When non-zero, the log
+            holds a synchronous commit's group open for up to the target less the measured sync
+            time, so that other commits arriving in that window share a single sync. The window
+            is skipped when commits are not arriving often enough for another one to join''',
+            min='0', max='1000000'),
         Config('method', 'fsync', r'''
             the method used to ensure log records are stable on disk, see @ref tune_durability
             for more information''',
@@ -162,8 +162,12 @@ def rec_pack_fmt(r):
 
 # Check for an operation that has a file id type. Redact any user data
 # if the redact flag is set, but print operations for file id 0, known
-# to be the metadata.
+# to be the metadata. Operations built from user data are always redacted.
 def check_redact(optype):
+    if optype.redact:
+        redact_str = '    if (!FLD_ISSET(args->flags, WT_TXN_PRINTLOG_UNREDACT))\n'
+        redact_str += '        return(__wt_fprintf(session, args->fs, " REDACTED"));\n'
+        return redact_str
     for f in optype.fields:
         if f.typename == 'uint32_id':
             redact_str = '    if (!FLD_ISSET(args->flags, WT_TXN_PRINTLOG_UNREDACT) && '
@@ -43,10 +43,11 @@ rectypes = [
 ]
 
 class LogOperationType:
-    def __init__(self, name, desc, fields):
+    def __init__(self, name, desc, fields, redact=False):
         self.name = name
         self.desc = desc
         self.fields = fields
+        self.redact = redact
         self.macro_name = 'WT_LOGOP_%s' % name.upper()
 
 #
@@ -81,6 +82,11 @@ optypes = [
     LogOperationType('backup_id', 'incremental backup id', [
         ('uint32_t', 'index'), ('uint64_t', 'granularity'), ('string', 'id')]),
 
+    # Log compression dictionaries, written at the start of log files. The dictionary is built
+    # from user data, redact it.
+    LogOperationType('log_dictionary', 'log compression dictionary',
+        [('uint32_t', 'version'), ('WT_ITEM', 'dictionary')], redact=True),
+
 # diagnostic operations
 # Operations used only for diagnostic purposes should be have their type
 # values in the diagnostic range in src/include/wiredtiger.in so that they
@@ -235,13 +235,18 @@ conn_stats = [
     ##########################################
     # Block cache statistics
     ##########################################
+    BlockCacheStat('block_cache_admission_admitted', 'blocks admitted by the admission filter'),
+    BlockCacheStat('block_cache_admission_rejected', 'blocks rejected by the admission filter'),
     BlockCacheStat('block_cache_blocks', 'total blocks'),
+    BlockCacheStat('block_cache_blocks_compressed', 'blocks stored compressed'),
     BlockCacheStat('block_cache_blocks_evicted', 'evicted blocks'),
     BlockCacheStat('block_cache_blocks_insert_read', 'total blocks inserted on read path'),
     BlockCacheStat('block_cache_blocks_insert_write', 'total blocks inserted on write path'),
+    BlockCacheStat('block_cache_blocks_promoted', 'compressed blocks promoted to uncompressed'),
     BlockCacheStat('block_cache_blocks_removed', 'removed blocks'),
     BlockCacheStat('block_cache_blocks_removed_blocked', 'time sleeping to remove block (usecs)'),
     BlockCacheStat('block_cache_blocks_update', 'cached blocks updated'),
+    BlockCacheStat('block_cache_bypass_bucket_full', 'number of put bypasses because the hash buckets were full'),
     BlockCacheStat('block_cache_bypass_chkpt', 'number of put bypasses on checkpoint I/O'),
     BlockCacheStat('block_cache_bypass_filesize', 'file size causing bypass'),
     BlockCacheStat('block_cache_bypass_get', 'number of bypasses on get'),
@@ -252,7 +257,10 @@ conn_stats = [
     BlockCacheStat('block_cache_bytes_insert_read', 'total bytes inserted on read path'),
     BlockCacheStat('block_cache_bytes_insert_write', 'total bytes inserted on write path'),
     BlockCacheStat('block_cache_bytes_update', 'cached bytes updated'),
+    BlockCacheStat('block_cache_capacity_multiplier', 'effective capacity multiplier of compression (percent)', 'no_clear,no_scale'),
+    BlockCacheStat('block_cache_decompress_time', 'time decompressing blocks on hits (usecs)'),
     BlockCacheStat('block_cache_eviction_passes', 'number of eviction passes'),
+    BlockCacheStat('block_cache_hit_ratio', 'hit ratio (percent)', 'no_clear,no_scale'),
     BlockCacheStat('block_cache_hits', 'number of hits'),
     BlockCacheStat('block_cache_lookups', 'lookups'),
     BlockCacheStat('block_cache_misses', 'number of misses'),
@@ -270,12 +278,16 @@ conn_stats = [
     BlockStat('block_byte_write_compact', 'bytes written by compaction', 'size'),
     BlockStat('block_byte_write_mmap', 'bytes written via memory map API', 'size'),
     BlockStat('block_byte_write_syscall', 'bytes written via system call API', 'size'),
+    BlockStat('block_extlist_consolidate', 'incremental extent lists consolidated'),
+    BlockStat('block_extlist_incremental', 'extent lists written incrementally'),
     BlockStat('block_map_read', 'mapped blocks read'),
     BlockStat('block_preload', 'blocks pre-loaded'),
     BlockStat('block_read', 'blocks read'),
     BlockStat('block_remap_file_resize', 'number of times the file was remapped because it changed size via fallocate or truncate'),
     BlockStat('block_remap_file_write', 'number of times the region was remapped via write'),
     BlockStat('block_write', 'blocks written'),
+    BlockStat('block_write_batch', 'checkpoint write batches written'),
+    BlockStat('block_write_batch_blocks', 'blocks written in checkpoint write batches'),
 
     ##########################################
     # Cache and eviction statistics
@@ -383,9 +395,11 @@ conn_stats = [
     CapacityStat('capacity_bytes_log', 'bytes written for log'),
     CapacityStat('capacity_bytes_read', 'bytes read'),
     CapacityStat('capacity_bytes_written', 'bytes written total'),
+    CapacityStat('capacity_ckpt_pace_rate', 'checkpoint pacing rate (bytes per second)', 'no_clear,no_scale'),
     CapacityStat('capacity_threshold', 'threshold to call fsync'),
     CapacityStat('capacity_time_chunkcache', 'time waiting for chunk cache IO bandwidth (usecs)'),
     CapacityStat('capacity_time_ckpt', 'time waiting during checkpoint (usecs)'),
+    CapacityStat('capacity_time_ckpt_pace', 'time waiting for checkpoint pacing (usecs)'),
     CapacityStat('capacity_time_evict', 'time waiting during eviction (usecs)'),
     CapacityStat('capacity_time_log', 'time waiting during logging (usecs)'),
     CapacityStat('capacity_time_read', 'time waiting during read (usecs)'),
@@ -398,6 +412,8 @@ conn_stats = [
     # Checkpoint statistics
     ##########################################
     CheckpointStat('checkpoint_cleanup_success', 'checkpoint cleanup successful calls'),
+    CheckpointStat('checkpoint_flush', 'background flushes of dirty leaf pages between checkpoints'),
+    CheckpointStat('checkpoint_flush_pages', 'number of leaf pages written ahead of checkpoints'),
     CheckpointStat('checkpoint_fsync_post', 'fsync calls after allocating the transaction ID'),
     CheckpointStat('checkpoint_fsync_post_duration', 'fsync duration after allocating the transaction ID (usecs)', 'no_clear,no_scale'),
     CheckpointStat('checkpoint_generation', 'generation', 'no_clear,no_scale'),
@@ -414,6 +430,7 @@ conn_stats = [
     CheckpointStat('checkpoint_handle_skip_duration', 'most recent duration for gathering skipped handles (usecs)', 'no_clear,no_scale'),
     CheckpointStat('checkpoint_handle_walked', 'most recent handles walked'),
     CheckpointStat('checkpoint_hs_pages_reconciled', 'number of history store pages caused to be reconciled'),
+    CheckpointStat('checkpoint_meta_update_duration', 'most recent duration for writing tree metadata updates (usecs)', 'no_clear,no_scale'),
     CheckpointStat('checkpoint_pages_reconciled', 'number of pages caused to be reconciled'),
     CheckpointStat('checkpoint_pages_visited_internal', 'number of internal pages visited'),
     CheckpointStat('checkpoint_pages_visited_leaf', 'number of leaf pages visited'),
@@ -464,6 +481,11 @@ conn_stats = [
     ChunkCacheStat('chunkcache_metadata_work_units_dequeued', 'number of metadata inserts/deletes read by the worker thread'),
     ChunkCacheStat('chunkcache_metadata_work_units_dropped', 'number of metadata inserts/deletes dropped by the worker thread'),
     ChunkCacheStat('chunkcache_misses', 'number of misses'),
+    ChunkCacheStat('chunkcache_prefetch_hits', 'read-ahead chunks accessed'),
+    ChunkCacheStat('chunkcache_prefetch_queue_depth', 'read-ahead chunks queued and not yet read', 'no_clear,no_scale'),
+    ChunkCacheStat('chunkcache_prefetch_queued', 'read-ahead chunks queued'),
+    ChunkCacheStat('chunkcache_prefetch_read', 'read-ahead chunks read'),
+    ChunkCacheStat('chunkcache_prefetch_wasted', 'read-ahead chunks removed without being accessed'),
     ChunkCacheStat('chunkcache_retries', 'retried accessing a chunk while I/O was in progress'),
     ChunkCacheStat('chunkcache_retries_checksum_mismatch', 'retries from a chunk cache checksum mismatch'),
     ChunkCacheStat('chunkcache_spans_chunks_read', 'aggregate number of spanned chunks on read'),
@@ -553,15 +575,37 @@ conn_stats = [
     LogStat('log_bytes_payload', 'log bytes of payload data', 'size'),
     LogStat('log_bytes_written', 'log bytes written', 'size'),
     LogStat('log_close_yields', 'yields waiting for previous log file close'),
+    LogStat('log_compress_dict_builds', 'log compression dictionaries built'),
+    LogStat('log_compress_dict_writes', 'log records compressed with a dictionary'),
     LogStat('log_compress_len', 'total size of compressed records', 'size'),
     LogStat('log_compress_mem', 'total in-memory size of compressed records', 'size'),
+    LogStat('log_compress_ratio', 'compression ratio of compressed records (percent)', 'no_clear,no_scale'),
     LogStat('log_compress_small', 'log records too small to compress'),
+    LogStat('log_compress_time', 'time spent compressing log records (usecs)'),
     LogStat('log_compress_write_fails', 'log records not compressed'),
     LogStat('log_compress_writes', 'log records compressed'),
+    LogStat('log_decompress_time', 'time spent decompressing log records (usecs)'),
     LogStat('log_flush', 'log flush operations'),
     LogStat('log_force_remove_sleep', 'force log remove time sleeping (usecs)'),
     LogStat('log_force_write', 'log force write operations'),
     LogStat('log_force_write_skip', 'log force write operations skipped'),
+    LogStat('log_group_arrival_usecs', 'group commit estimated time between synchronous commits (usecs)', 'no_clear,no_scale'),
+    LogStat('log_group_fsync_usecs', 'group commit estimated sync time (usecs)', 'no_clear,no_scale'),
+    LogStat('log_group_hold_usecs', 'group commit time slots held open (usecs)'),
+    LogStat('log_group_holds', 'group commit slots held open'),
+    LogStat('log_group_latency_gt10000', 'group commit latency histogram (bucket 6) - 10000us+'),
+    LogStat('log_group_latency_lt100', 'group commit latency histogram (bucket 1) - 0-99us'),
+    LogStat('log_group_latency_lt250', 'group commit latency histogram (bucket 2) - 100-249us'),
+    LogStat('log_group_latency_lt500', 'group commit latency histogram (bucket 3) - 250-499us'),
+    LogStat('log_group_latency_lt1000', 'group commit latency histogram (bucket 4) - 500-999us'),
+    LogStat('log_group_latency_lt10000', 'group commit latency histogram (bucket 5) - 1000-9999us'),
+    LogStat('log_group_latency_total_usecs', 'group commit latency histogram total (usecs)'),
+    LogStat('log_group_size_1', 'group commit size histogram (bucket 1) - 1 commit'),
+    LogStat('log_group_size_lt4', 'group commit size histogram (bucket 2) - 2-3 commits'),
+    LogStat('log_group_size_lt8', 'group commit size histogram (bucket 3) - 4-7 commits'),
+    LogStat('log_group_size_lt16', 'group commit size histogram (bucket 4) - 8-15 commits'),
+    LogStat('log_group_size_lt32', 'group commit size histogram (bucket 5) - 16-31 commits'),
+    LogStat('log_group_size_gt32', 'group commit size histogram (bucket 6) - 32+ commits'),
     LogStat('log_max_filesize', 'maximum log file size', 'no_clear,no_scale,size'),
     LogStat('log_prealloc_files', 'pre-allocated log files prepared'),
     LogStat('log_prealloc_max', 'number of pre-allocated log files to create', 'no_clear,no_scale'),
@@ -572,6 +616,10 @@ conn_stats = [
     LogStat('log_scan_rereads', 'log scan records requiring two reads'),
     LogStat('log_scans', 'log scan operations'),
     LogStat('log_slot_active_closed', 'slot join found active slot closed'),
+    LogStat('log_slot_buffer_grow_unbuffered', 'slot buffer size increases for unbuffered records'),
+    LogStat('log_slot_buffer_shrink_pool', 'slot buffer size decreases for slot pool exhaustion'),
+    LogStat('log_slot_buffer_shrink_small', 'slot buffer size decreases for small records'),
+    LogStat('log_slot_buffer_size', 'slot buffer size', 'no_clear,no_scale,size'),
     LogStat('log_slot_close_race', 'slot close lost race'),
     LogStat('log_slot_close_unbuf', 'slot close unbuffered waits'),
     LogStat('log_slot_closes', 'slot closures'),
@@ -579,6 +627,7 @@ conn_stats = [
     LogStat('log_slot_consolidated', 'logging bytes consolidated', 'size'),
     LogStat('log_slot_immediate', 'slot join calls did not yield'),
     LogStat('log_slot_no_free_slots', 'slot transitions unable to find free slot'),
+    LogStat('log_slot_pool_depth', 'slots available in the slot pool', 'no_clear,no_scale'),
     LogStat('log_slot_races', 'slot join atomic update races'),
     LogStat('log_slot_switch_busy', 'busy returns attempting to switch slots'),
     LogStat('log_slot_unbuffered', 'slot unbuffered writes'),
@@ -592,6 +641,7 @@ conn_stats = [
     LogStat('log_sync_dir_duration', 'log sync_dir time duration (usecs)', 'no_clear,no_scale'),
     LogStat('log_sync_duration', 'log sync time duration (usecs)', 'no_clear,no_scale'),
     LogStat('log_write_lsn', 'log server thread advances write LSN'),
+    LogStat('log_write_lsn_release', 'log release thread advances write LSN in order'),
     LogStat('log_write_lsn_skip', 'log server thread write LSN walk skipped'),
     LogStat('log_writes', 'log write operations'),
     LogStat('log_zero_fills', 'log files manually zero-filled'),
@@ -658,6 +708,9 @@ conn_stats = [
     PrefetchStat('prefetch_skipped_no_valid_dhandle', 'pre-fetch not triggered as there is no valid dhandle'),
     PrefetchStat('prefetch_skipped_same_ref', 'pre-fetch not repeating for recently pre-fetched ref'),
     PrefetchStat('prefetch_skipped_special_handle', 'pre-fetch not triggered due to special btree handle'),
+    PrefetchStat('prefetch_warm_pages_missing', 'warm restart pages no longer on disk in the tree'),
+    PrefetchStat('prefetch_warm_pages_queued', 'warm restart pages queued'),
+    PrefetchStat('prefetch_warm_pages_recorded', 'warm restart pages recorded'),
     PrefetchStat('prefetch_pages_fail', 'pre-fetch page not on disk when reading'),
 
     ##########################################
@@ -766,6 +819,8 @@ conn_stats = [
     TxnStat('txn_set_ts_out_of_order', 'set timestamp global oldest timestamp set to be more recent than the global stable timestamp'),
     TxnStat('txn_set_ts_stable', 'set timestamp stable calls'),
     TxnStat('txn_set_ts_stable_upd', 'set timestamp stable updates'),
+    TxnStat('txn_snapshot_cache_miss', 'transaction snapshots not found in the snapshot cache'),
+    TxnStat('txn_snapshot_cached', 'transaction snapshots copied from the snapshot cache'),
     TxnStat('txn_timestamp_oldest_active_read', 'transaction read timestamp of the oldest active reader', 'no_clear,no_scale'),
     TxnStat('txn_walk_sessions', 'transaction walk of concurrent sessions'),
 
@@ -1019,12 +1074,16 @@ conn_dsrc_stats = [
     CacheStat('cache_eviction_walks_gave_up_no_targets', 'eviction walks gave up because they saw too many pages and found no candidates'),
     CacheStat('cache_eviction_walks_gave_up_ratio', 'eviction walks gave up because they saw too many pages and found too few candidates'),
     CacheStat('cache_eviction_walks_stopped', 'eviction walks gave up because they restarted their walk twice'),
+    CacheStat('cache_hs_bloom_build', 'history store table bloom filters built'),
+    CacheStat('cache_hs_bloom_false_positive', 'history store table reads not skipped by the bloom filter that found no history'),
+    CacheStat('cache_hs_bloom_skip', 'history store table reads skipped by the bloom filter'),
     CacheStat('cache_hs_btree_truncate', 'history store table truncation to remove all the keys of a btree'),
     CacheStat('cache_hs_btree_truncate_dryrun', 'history store table truncations that would have happened in non-dryrun mode'),
     CacheStat('cache_hs_insert', 'history store table insert calls'),
     CacheStat('cache_hs_insert_full_update', 'the number of times full update inserted to history store'),
     CacheStat('cache_hs_insert_restart', 'history store table insert calls that returned restart'),
     CacheStat('cache_hs_insert_reverse_modify', 'the number of times reverse modify inserted to history store'),
+    CacheStat('cache_hs_insert_reverse_modify_saved', 'the number of bytes saved by inserting reverse modifies instead of full updates to history store', 'size'),
     CacheStat('cache_hs_key_truncate', 'history store table truncation to remove an update'),
     CacheStat('cache_hs_key_truncate_onpage_removal', 'history store table truncation to remove range of updates due to key being removed from the data page during reconciliation'),
     CacheStat('cache_hs_key_truncate_rts', 'history store table truncation by rollback to stable to remove an update'),
@@ -1037,6 +1096,7 @@ conn_dsrc_stats = [
     CacheStat('cache_hs_read', 'history store table reads'),
     CacheStat('cache_hs_read_miss', 'history store table reads missed'),
     CacheStat('cache_hs_read_squash', 'history store table reads requiring squashed modifies'),
+    CacheStat('cache_hs_read_squash_modify', 'history store table reverse modifies applied by reads'),
     CacheStat('cache_hs_write_squash', 'history store table writes requiring squashed modifies'),
     CacheStat('cache_inmem_split', 'in-memory page splits'),
     CacheStat('cache_inmem_splittable', 'in-memory page passed criteria to be split'),
@@ -1050,6 +1110,12 @@ conn_dsrc_stats = [
     CacheStat('cache_read_overflow', 'overflow pages read into cache'),
     CacheStat('cache_reverse_splits', 'reverse splits performed'),
     CacheStat('cache_reverse_splits_skipped_vlcs', 'reverse splits skipped because of VLCS namespace gap restrictions'),
+    CacheStat('cache_update_chain_consolidate', 'update chains consolidated into a full value'),
+    CacheStat('cache_update_chain_consolidate_modify', 'modify updates skipped by update chain consolidation'),
+    CacheStat('cache_update_chain_ge1000', 'update chain length histogram - 1000 and higher'),
+    CacheStat('cache_update_chain_lt10', 'update chain length histogram - 0-9'),
+    CacheStat('cache_update_chain_lt100', 'update chain length histogram - 10-99'),
+    CacheStat('cache_update_chain_lt1000', 'update chain length histogram - 100-999'),
     CacheStat('cache_write', 'pages written from cache'),
     CacheStat('cache_write_hs', 'page written requiring history store records'),
     CacheStat('cache_write_restore', 'pages written requiring in-memory restoration'),
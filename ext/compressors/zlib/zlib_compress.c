@@ -63,6 +63,13 @@ typedef struct {
     WT_SESSION *session;
 } ZLIB_OPAQUE;
 
+/* A loaded preset dictionary, the content follows the structure. */
+typedef struct {
+    size_t len;
+} ZLIB_DICT;
+
+#define ZLIB_DICT_DATA(zd) ((uint8_t *)((zd) + 1))
+
 /*
  * zlib_error --
  *     Output an error message, and return a standard error code.
@@ -109,12 +116,13 @@ zfree(void *cookie, void *p)
 }
 
 /*
- * zlib_compress --
- *     WiredTiger zlib compression.
+ * zlib_compress_internal --
+ *     WiredTiger zlib compression, optionally with a preset dictionary.
  */
 static int
-zlib_compress(WT_COMPRESSOR *compressor, WT_SESSION *session, uint8_t *src, size_t src_len,
-  uint8_t *dst, size_t dst_len, size_t *result_lenp, int *compression_failed)
+zlib_compress_internal(WT_COMPRESSOR *compressor, WT_SESSION *session, ZLIB_DICT *zd,
+  uint8_t *src, size_t src_len, uint8_t *dst, size_t dst_len, size_t *result_lenp,
+  int *compression_failed)
 {
     ZLIB_COMPRESSOR *zlib_compressor;
     ZLIB_OPAQUE opaque;
@@ -132,6 +140,11 @@ zlib_compress(WT_COMPRESSOR *compressor, WT_SESSION *session, uint8_t *src, size
 
     if ((ret = deflateInit(&zs, zlib_compressor->zlib_level)) != Z_OK)
         return (zlib_error(compressor, session, "deflateInit", ret));
+    if (zd != NULL &&
+      (ret = deflateSetDictionary(&zs, ZLIB_DICT_DATA(zd), (uint32_t)zd->len)) != Z_OK) {
+        (void)deflateEnd(&zs);
+        return (zlib_error(compressor, session, "deflateSetDictionary", ret));
+    }
 
     zs.next_in = src;
     zs.avail_in = (uint32_t)src_len;
@@ -150,12 +163,24 @@ zlib_compress(WT_COMPRESSOR *compressor, WT_SESSION *session, uint8_t *src, size
 }
 
 /*
- * zlib_decompress --
- *     WiredTiger zlib decompression.
+ * zlib_compress --
+ *     WiredTiger zlib compression.
  */
 static int
-zlib_decompress(WT_COMPRESSOR *compressor, WT_SESSION *session, uint8_t *src, size_t src_len,
-  uint8_t *dst, size_t dst_len, size_t *result_lenp)
+zlib_compress(WT_COMPRESSOR *compressor, WT_SESSION *session, uint8_t *src, size_t src_len,
+  uint8_t *dst, size_t dst_len, size_t *result_lenp, int *compression_failed)
+{
+    return (zlib_compress_internal(
+      compressor, session, NULL, src, src_len, dst, dst_len, result_lenp, compression_failed));
+}
+
+/*
+ * zlib_decompress_internal --
+ *     WiredTiger zlib decompression, optionally with a preset dictionary.
+ */
+static int
+zlib_decompress_internal(WT_COMPRESSOR *compressor, WT_SESSION *session, ZLIB_DICT *zd,
+  uint8_t *src, size_t src_len, uint8_t *dst, size_t dst_len, size_t *result_lenp)
 {
     ZLIB_OPAQUE opaque;
     z_stream zs;
@@ -175,8 +200,14 @@ zlib_decompress(WT_COMPRESSOR *compressor, WT_SESSION *session, uint8_t *src, si
     zs.avail_in = (uint32_t)src_len;
     zs.next_out = dst;
     zs.avail_out = (uint32_t)dst_len;
-    while ((ret = inflate(&zs, Z_FINISH)) == Z_OK)
-        ;
+    for (;;) {
+        ret = inflate(&zs, Z_FINISH);
+        if (ret == Z_NEED_DICT && zd != NULL &&
+          (ret = inflateSetDictionary(&zs, ZLIB_DICT_DATA(zd), (uint32_t)zd->len)) == Z_OK)
+            continue;
+        if (ret != Z_OK)
+            break;
+    }
     if (ret == Z_STREAM_END) {
         *result_lenp = (size_t)zs.total_out;
         ret = Z_OK;
@@ -188,6 +219,78 @@ zlib_decompress(WT_COMPRESSOR *compressor, WT_SESSION *session, uint8_t *src, si
     return (ret == Z_OK ? 0 : zlib_error(compressor, session, "inflate", ret));
 }
 
+/*
+ * zlib_decompress --
+ *     WiredTiger zlib decompression.
+ */
+static int
+zlib_decompress(WT_COMPRESSOR *compressor, WT_SESSION *session, uint8_t *src, size_t src_len,
+  uint8_t *dst, size_t dst_len, size_t *result_lenp)
+{
+    return (zlib_decompress_internal(
+      compressor, session, NULL, src, src_len, dst, dst_len, result_lenp));
+}
+
+/*
+ * zlib_dict_load --
+ *     WiredTiger zlib dictionary load: zlib uses the dictionary content as a preset history.
+ */
+static int
+zlib_dict_load(WT_COMPRESSOR *compressor, WT_SESSION *session, const uint8_t *dict,
+  size_t dict_len, void **dict_handlep)
+{
+    ZLIB_DICT *zd;
+
+    (void)compressor; /* Unused parameters */
+    (void)session;
+
+    if ((zd = malloc(sizeof(ZLIB_DICT) + dict_len)) == NULL)
+        return (errno);
+    zd->len = dict_len;
+    memcpy(ZLIB_DICT_DATA(zd), dict, dict_len);
+    *dict_handlep = zd;
+    return (0);
+}
+
+/*
+ * zlib_dict_compress --
+ *     WiredTiger zlib compression with a dictionary.
+ */
+static int
+zlib_dict_compress(WT_COMPRESSOR *compressor, WT_SESSION *session, void *dict_handle,
+  uint8_t *src, size_t src_len, uint8_t *dst, size_t dst_len, size_t *result_lenp,
+  int *compression_failed)
+{
+    return (zlib_compress_internal(compressor, session, dict_handle, src, src_len, dst, dst_len,
+      result_lenp, compression_failed));
+}
+
+/*
+ * zlib_dict_decompress --
+ *     WiredTiger zlib decompression with a dictionary.
+ */
+static int
+zlib_dict_decompress(WT_COMPRESSOR *compressor, WT_SESSION *session, void *dict_handle,
+  uint8_t *src, size_t src_len, uint8_t *dst, size_t dst_len, size_t *result_lenp)
+{
+    return (zlib_decompress_internal(
+      compressor, session, dict_handle, src, src_len, dst, dst_len, result_lenp));
+}
+
+/*
+ * zlib_dict_unload --
+ *     WiredTiger zlib dictionary unload.
+ */
+static int
+zlib_dict_unload(WT_COMPRESSOR *compressor, WT_SESSION *session, void *dict_handle)
+{
+    (void)compressor; /* Unused parameters */
+    (void)session;
+
+    free(dict_handle);
+    return (0);
+}
+
 /*
  * zlib_terminate --
  *     WiredTiger zlib compression termination.
@@ -218,6 +321,10 @@ zlib_add_compressor(WT_CONNECTION *connection, const char *name, int zlib_level)
     zlib_compressor->compressor.decompress = zlib_decompress;
     zlib_compressor->compressor.pre_size = NULL;
     zlib_compressor->compressor.terminate = zlib_terminate;
+    zlib_compressor->compressor.dict_load = zlib_dict_load;
+    zlib_compressor->compressor.dict_compress = zlib_dict_compress;
+    zlib_compressor->compressor.dict_decompress = zlib_dict_decompress;
+    zlib_compressor->compressor.dict_unload = zlib_dict_unload;
 
     zlib_compressor->wt_api = connection->get_extension_api(connection);
     zlib_compressor->zlib_level = zlib_level;
@@ -27,6 +27,7 @@
  */
 
 #include <zstd.h>
+#include <zdict.h>
 #include <errno.h>
 #include <stdlib.h>
 #include <string.h>
@@ -76,6 +77,12 @@ typedef struct {
     ZSTD_CONTEXT_POOL *dctx_pool; /* Decompression context pool. */
 } ZSTD_COMPRESSOR;
 
+/* A loaded dictionary, digested for both compression and decompression. */
+typedef struct {
+    ZSTD_CDict *cdict;
+    ZSTD_DDict *ddict;
+} ZSTD_DICT;
+
 /*
  * Zstd decompression requires an exact compressed byte count. WiredTiger doesn't track that value,
  * store it in the destination buffer.
@@ -180,13 +187,15 @@ zstd_release_context(
 }
 
 /*
- *  zstd_compress --
- *	WiredTiger Zstd compression.
+ *  zstd_compress_internal --
+ *	WiredTiger Zstd compression, optionally with a dictionary.
  */
 static int
-zstd_compress(WT_COMPRESSOR *compressor, WT_SESSION *session, uint8_t *src, size_t src_len,
-  uint8_t *dst, size_t dst_len, size_t *result_lenp, int *compression_failed)
+zstd_compress_internal(WT_COMPRESSOR *compressor, WT_SESSION *session, ZSTD_DICT *zd,
+  uint8_t *src, size_t src_len, uint8_t *dst, size_t dst_len, size_t *result_lenp,
+  int *compression_failed)
 {
+    ZSTD_CCtx *cctx;
     ZSTD_COMPRESSOR *zcompressor;
     ZSTD_CONTEXT *context = NULL;
     size_t zstd_ret;
@@ -197,7 +206,15 @@ zstd_compress(WT_COMPRESSOR *compressor, WT_SESSION *session, uint8_t *src, size
     zstd_get_context(zcompressor, session, CONTEXT_TYPE_COMPRESS, &context);
 
     /* Compress, starting past the prefix bytes. */
-    if (context != NULL) {
+    if (zd != NULL) {
+        /* Dictionary compression requires a context, create one if the pool is empty. */
+        if ((cctx = context != NULL ? (ZSTD_CCtx *)context->ctx : ZSTD_createCCtx()) == NULL)
+            return (ENOMEM);
+        zstd_ret = ZSTD_compress_usingCDict(
+          cctx, dst + ZSTD_PREFIX, dst_len - ZSTD_PREFIX, src, src_len, zd->cdict);
+        if (context == NULL)
+            (void)ZSTD_freeCCtx(cctx);
+    } else if (context != NULL) {
         zstd_ret = ZSTD_compressCCtx((ZSTD_CCtx *)context->ctx, dst + ZSTD_PREFIX,
           dst_len - ZSTD_PREFIX, src, src_len, zcompressor->compression_level);
     } else {
@@ -235,13 +252,26 @@ zstd_compress(WT_COMPRESSOR *compressor, WT_SESSION *session, uint8_t *src, size
 }
 
 /*
- * zstd_decompress --
- *     WiredTiger Zstd decompression.
+ *  zstd_compress --
+ *	WiredTiger Zstd compression.
  */
 static int
-zstd_decompress(WT_COMPRESSOR *compressor, WT_SESSION *session, uint8_t *src, size_t src_len,
-  uint8_t *dst, size_t dst_len, size_t *result_lenp)
+zstd_compress(WT_COMPRESSOR *compressor, WT_SESSION *session, uint8_t *src, size_t src_len,
+  uint8_t *dst, size_t dst_len, size_t *result_lenp, int *compression_failed)
+{
+    return (zstd_compress_internal(
+      compressor, session, NULL, src, src_len, dst, dst_len, result_lenp, compression_failed));
+}
+
+/*
+ * zstd_decompress_internal --
+ *     WiredTiger Zstd decompression, optionally with a dictionary.
+ */
+static int
+zstd_decompress_internal(WT_COMPRESSOR *compressor, WT_SESSION *session, ZSTD_DICT *zd,
+  uint8_t *src, size_t src_len, uint8_t *dst, size_t dst_len, size_t *result_lenp)
 {
+    ZSTD_DCtx *dctx;
     WT_EXTENSION_API *wt_api;
     ZSTD_COMPRESSOR *zcompressor;
     ZSTD_CONTEXT *context = NULL;
@@ -270,7 +300,15 @@ zstd_decompress(WT_COMPRESSOR *compressor, WT_SESSION *session, uint8_t *src, si
      * and over again for performance gains.
      */
     zstd_get_context(zcompressor, session, CONTEXT_TYPE_DECOMPRESS, &context);
-    if (context != NULL) {
+    if (zd != NULL) {
+        /* Dictionary decompression requires a context, create one if the pool is empty. */
+        if ((dctx = context != NULL ? (ZSTD_DCtx *)context->ctx : ZSTD_createDCtx()) == NULL)
+            return (ENOMEM);
+        zstd_ret = ZSTD_decompress_usingDDict(
+          dctx, dst, dst_len, src + ZSTD_PREFIX, (size_t)zstd_len, zd->ddict);
+        if (context == NULL)
+            (void)ZSTD_freeDCtx(dctx);
+    } else if (context != NULL) {
         zstd_ret = ZSTD_decompressDCtx(
           (ZSTD_DCtx *)context->ctx, dst, dst_len, src + ZSTD_PREFIX, (size_t)zstd_len);
     } else {
@@ -285,6 +323,113 @@ zstd_decompress(WT_COMPRESSOR *compressor, WT_SESSION *session, uint8_t *src, si
     return (zstd_error(compressor, session, "ZSTD_decompress", zstd_ret));
 }
 
+/*
+ * zstd_decompress --
+ *     WiredTiger Zstd decompression.
+ */
+static int
+zstd_decompress(WT_COMPRESSOR *compressor, WT_SESSION *session, uint8_t *src, size_t src_len,
+  uint8_t *dst, size_t dst_len, size_t *result_lenp)
+{
+    return (zstd_decompress_internal(
+      compressor, session, NULL, src, src_len, dst, dst_len, result_lenp));
+}
+
+/*
+ * zstd_dict_load --
+ *     WiredTiger Zstd dictionary load.
+ */
+static int
+zstd_dict_load(WT_COMPRESSOR *compressor, WT_SESSION *session, const uint8_t *dict,
+  size_t dict_len, void **dict_handlep)
+{
+    WT_EXTENSION_API *wt_api;
+    ZSTD_COMPRESSOR *zcompressor;
+    ZSTD_DICT *zd;
+
+    zcompressor = (ZSTD_COMPRESSOR *)compressor;
+    wt_api = zcompressor->wt_api;
+
+    if ((zd = calloc(1, sizeof(ZSTD_DICT))) == NULL)
+        return (errno);
+    if ((zd->cdict = ZSTD_createCDict(dict, dict_len, zcompressor->compression_level)) == NULL ||
+      (zd->ddict = ZSTD_createDDict(dict, dict_len)) == NULL) {
+        (void)ZSTD_freeCDict(zd->cdict);
+        free(zd);
+        (void)wt_api->err_printf(wt_api, session, "zstd_dict_load: dictionary create failure");
+        return (WT_ERROR);
+    }
+    *dict_handlep = zd;
+    return (0);
+}
+
+/*
+ * zstd_dict_compress --
+ *     WiredTiger Zstd compression with a dictionary.
+ */
+static int
+zstd_dict_compress(WT_COMPRESSOR *compressor, WT_SESSION *session, void *dict_handle,
+  uint8_t *src, size_t src_len, uint8_t *dst, size_t dst_len, size_t *result_lenp,
+  int *compression_failed)
+{
+    return (zstd_compress_internal(compressor, session, dict_handle, src, src_len, dst, dst_len,
+      result_lenp, compression_failed));
+}
+
+/*
+ * zstd_dict_decompress --
+ *     WiredTiger Zstd decompression with a dictionary.
+ */
+static int
+zstd_dict_decompress(WT_COMPRESSOR *compressor, WT_SESSION *session, void *dict_handle,
+  uint8_t *src, size_t src_len, uint8_t *dst, size_t dst_len, size_t *result_lenp)
+{
+    return (zstd_decompress_internal(
+      compressor, session, dict_handle, src, src_len, dst, dst_len, result_lenp));
+}
+
+/*
+ * zstd_dict_train --
+ *     WiredTiger Zstd dictionary training from sample records.
+ */
+static int
+zstd_dict_train(WT_COMPRESSOR *compressor, WT_SESSION *session, const uint8_t *samples,
+  const size_t *sample_sizes, size_t nsamples, uint8_t *dict, size_t dict_len,
+  size_t *result_lenp)
+{
+    size_t zstd_ret;
+
+    (void)compressor; /* Unused parameters */
+    (void)session;
+
+    /*
+     * Training fails if there are too few samples or too little variety in them: that isn't an
+     * error, the caller falls back to using the sample content.
+     */
+    zstd_ret = ZDICT_trainFromBuffer(dict, dict_len, samples, sample_sizes, (unsigned)nsamples);
+    *result_lenp = ZDICT_isError(zstd_ret) ? 0 : zstd_ret;
+    return (0);
+}
+
+/*
+ * zstd_dict_unload --
+ *     WiredTiger Zstd dictionary unload.
+ */
+static int
+zstd_dict_unload(WT_COMPRESSOR *compressor, WT_SESSION *session, void *dict_handle)
+{
+    ZSTD_DICT *zd;
+
+    (void)compressor; /* Unused parameters */
+    (void)session;
+
+    zd = dict_handle;
+    (void)ZSTD_freeCDict(zd->cdict);
+    (void)ZSTD_freeDDict(zd->ddict);
+    free(zd);
+    return (0);
+}
+
 /*
  * zstd_pre_size --
  *     WiredTiger Zstd destination buffer sizing for compression.
@@ -492,6 +637,11 @@ zstd_extension_init(WT_CONNECTION *connection, WT_CONFIG_ARG *config)
     zstd_compressor->compressor.decompress = zstd_decompress;
     zstd_compressor->compressor.pre_size = zstd_pre_size;
     zstd_compressor->compressor.terminate = zstd_terminate;
+    zstd_compressor->compressor.dict_load = zstd_dict_load;
+    zstd_compressor->compressor.dict_compress = zstd_dict_compress;
+    zstd_compressor->compressor.dict_decompress = zstd_dict_decompress;
+    zstd_compressor->compressor.dict_train = zstd_dict_train;
+    zstd_compressor->compressor.dict_unload = zstd_dict_unload;
 
     zstd_compressor->wt_api = connection->get_extension_api(connection);
 
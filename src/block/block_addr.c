@@ -8,7 +8,8 @@
 
 #include "wt_internal.h"
 
-#define WT_BLOCK_COOKIE_FILEID 0x01 /* The following bytes are an object ID. */
+#define WT_BLOCK_COOKIE_FILEID 0x01     /* The following bytes are an object ID. */
+#define WT_BLOCK_COOKIE_AVAIL_BASE 0x02 /* The following bytes are an avail list base address. */
 
 /*
  * __block_addr_unpack --
@@ -230,25 +231,34 @@ __block_ckpt_unpack(WT_SESSION_IMPL *session, WT_BLOCK *block, const uint8_t *ck
     WT_RET(__wt_vunpack_uint(&ckpt, 0, &a));
     ci->ckpt_size = a;
 
-    /* The first part of the checkpoint cookie is optionally followed by an object ID. */
+    /*
+     * The first part of the checkpoint cookie is optionally followed by an object ID and the
+     * address of an incremental avail list's base.
+     */
     objectid = 0;
     flags = 0;
+    ci->avail_base.offset = WT_BLOCK_INVALID_OFFSET;
+    ci->avail_base.size = ci->avail_base.checksum = 0;
     if (WT_PTRDIFF(ckpt, begin) != ckpt_size) {
         flags = *ckpt++;
         if (LF_ISSET(WT_BLOCK_COOKIE_FILEID)) {
             WT_RET(__wt_vunpack_uint(&ckpt, 0, &a));
             objectid = (uint32_t)a;
         }
+        if (LF_ISSET(WT_BLOCK_COOKIE_AVAIL_BASE))
+            WT_RET(__block_addr_unpack(session, block, &ckpt, 0, &ci->avail_base.objectid,
+              &ci->avail_base.offset, &ci->avail_base.size, &ci->avail_base.checksum));
     }
-    ci->root_objectid = ci->alloc.objectid = ci->avail.objectid = ci->discard.objectid = objectid;
+    ci->root_objectid = ci->alloc.objectid = ci->avail.objectid = ci->discard.objectid =
+      ci->avail_base.objectid = objectid;
 
     /*
-     * If there is no flag value or the flag value is the object ID flag by itself, assert the
-     * cookie was entirely consumed. Future extensions will use different cookie flag values
-     * (although the file-ID flag might still be set, our test is for equality).
+     * If there is no flag value or the flag value only includes flags we understand, assert the
+     * cookie was entirely consumed. Future extensions will use different cookie flag values.
      */
     WT_ASSERT(session,
-      (flags != 0 && flags != WT_BLOCK_COOKIE_FILEID) || WT_PTRDIFF(ckpt, begin) == ckpt_size);
+      (flags & ~(WT_BLOCK_COOKIE_FILEID | WT_BLOCK_COOKIE_AVAIL_BASE)) != 0 ||
+        WT_PTRDIFF(ckpt, begin) == ckpt_size);
 
     return (0);
 }
@@ -287,6 +297,7 @@ __wt_block_ckpt_pack(
   WT_SESSION_IMPL *session, WT_BLOCK *block, uint8_t **pp, WT_BLOCK_CKPT *ci, bool skip_avail)
 {
     uint64_t a;
+    uint8_t flags;
 
     if (ci->version != WT_BM_CHECKPOINT_VERSION)
         WT_RET_MSG(session, WT_ERROR, "unsupported checkpoint version");
@@ -314,13 +325,27 @@ __wt_block_ckpt_pack(
     WT_RET(__wt_vpack_uint(pp, 0, a));
     a = ci->ckpt_size;
     WT_RET(__wt_vpack_uint(pp, 0, a));
-    /* Don't store object IDs of zero, the function that cracks the cookie defaults IDs to 0. */
-    if (block->objectid != 0) {
-        **pp = WT_BLOCK_COOKIE_FILEID;
+    /*
+     * Don't store object IDs of zero, the function that cracks the cookie defaults IDs to 0. Only
+     * incremental avail lists have a base address, a full list is its own base.
+     */
+    flags = 0;
+    if (block->objectid != 0)
+        flags |= WT_BLOCK_COOKIE_FILEID;
+    if (ci->avail_base.offset != WT_BLOCK_INVALID_OFFSET &&
+      (skip_avail || ci->avail_base.offset != ci->avail.offset))
+        flags |= WT_BLOCK_COOKIE_AVAIL_BASE;
+    if (flags != 0) {
+        **pp = flags;
         ++(*pp);
+    }
+    if (LF_ISSET(WT_BLOCK_COOKIE_FILEID)) {
         a = block->objectid;
         WT_RET(__wt_vpack_uint(pp, 0, a));
     }
+    if (LF_ISSET(WT_BLOCK_COOKIE_AVAIL_BASE))
+        WT_RET(__wt_block_addr_pack(block, pp, WT_TIERED_OBJECTID_NONE, ci->avail_base.offset,
+          ci->avail_base.size, ci->avail_base.checksum));
 
     return (0);
 }
@@ -373,6 +398,13 @@ __wt_ckpt_verbose(WT_SESSION_IMPL *session, WT_BLOCK *block, const char *tag, co
           ", avail=[off: %" PRIuMAX "-%" PRIuMAX ", size: %" PRIu32 ", checksum: 0x%" PRIx32 "]",
           (uintmax_t)ci->avail.offset, (uintmax_t)(ci->avail.offset + ci->avail.size),
           ci->avail.size, ci->avail.checksum));
+    if (ci->avail_base.offset != WT_BLOCK_INVALID_OFFSET)
+        WT_ERR(__wt_buf_catfmt(session, tmp,
+          ", avail base=[off: %" PRIuMAX "-%" PRIuMAX ", size: %" PRIu32 ", checksum: 0x%" PRIx32
+          "]",
+          (uintmax_t)ci->avail_base.offset,
+          (uintmax_t)(ci->avail_base.offset + ci->avail_base.size), ci->avail_base.size,
+          ci->avail_base.checksum));
     if (ci->discard.offset == WT_BLOCK_INVALID_OFFSET)
         WT_ERR(__wt_buf_catfmt(session, tmp, ", discard=[Empty]"));
     else
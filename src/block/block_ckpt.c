@@ -22,6 +22,7 @@ __block_extlist_setup(WT_SESSION_IMPL *session, WT_BLOCK_CKPT *ci, const char *n
     WT_RET(__wt_block_extlist_init(session, &ci->avail, name, "avail", true));
     WT_RET(__wt_block_extlist_init(session, &ci->discard, name, "discard", false));
     WT_RET(__wt_block_extlist_init(session, &ci->ckpt_avail, name, "ckpt_avail", true));
+    WT_RET(__wt_block_extlist_init(session, &ci->avail_base, name, "avail_base", false));
 
     return (0);
 }
@@ -102,6 +103,7 @@ __wt_block_checkpoint_load(WT_SESSION_IMPL *session, WT_BLOCK *block, const uint
 
         ci = &block->live;
         WT_ERR(__wt_block_ckpt_init(session, ci, "live"));
+        WT_ERR(__wt_block_extlist_size_class(session, block, &ci->avail));
     }
 
     /*
@@ -142,14 +144,20 @@ __wt_block_checkpoint_load(WT_SESSION_IMPL *session, WT_BLOCK *block, const uint
              * checkpoint we are opening. So we discard the incorrect extent lists and reinitialize
              * them to be empty.
              */
-            if (block->objectid != ci->root_objectid)
-                __block_extlist_reset(session, ci, "live");
+            if (block->objectid != ci->root_objectid) {
+                WT_ERR(__block_extlist_reset(session, ci, "live"));
+                WT_ERR(__wt_block_extlist_size_class(session, block, &ci->avail));
+            }
 
             /*
              * Rolling a checkpoint forward requires the avail list, the blocks from which we can
-             * allocate.
+             * allocate. If the avail list is written incrementally, we also need a copy of its
+             * base, subsequent checkpoints write their changes against it.
              */
-            WT_ERR(__wt_block_extlist_read_avail(session, block, &ci->avail, ci->file_size));
+            WT_ERR(__wt_block_extlist_read_avail(
+              session, block, &ci->avail, &ci->avail_base, ci->file_size));
+            if (block->extlist_incremental)
+                WT_ERR(__wt_block_extlist_read_base(session, block, ci));
         }
     }
 
@@ -230,6 +238,7 @@ __wt_block_ckpt_destroy(WT_SESSION_IMPL *session, WT_BLOCK_CKPT *ci)
     __wt_block_extlist_free(session, &ci->ckpt_alloc);
     __wt_block_extlist_free(session, &ci->ckpt_avail);
     __wt_block_extlist_free(session, &ci->ckpt_discard);
+    __wt_block_extlist_free(session, &ci->avail_base);
 }
 
 /*
@@ -294,6 +303,13 @@ __wt_block_checkpoint(
         ci->root_objectid = block->objectid;
     }
 
+    /*
+     * Write any batched checkpoint pages, including the root page: the extent lists, and the
+     * checkpoint itself, must not reach the disk before the blocks they reference. Discard the
+     * batch buffer, it's only needed while a checkpoint is writing the file.
+     */
+    WT_ERR(__wt_block_write_batch_flush(session, block, true));
+
     /*
      * Checkpoints are potentially reading/writing/merging lots of blocks, pre-allocate structures
      * for this thread's use.
@@ -371,6 +387,86 @@ __ckpt_extlist_fblocks(WT_SESSION_IMPL *session, WT_BLOCK *block, WT_EXTLIST *el
     return (__wt_block_insert_ext(session, block, &block->live.ckpt_avail, el->offset, el->size));
 }
 
+/*
+ * __ckpt_avail_fblocks --
+ *     If a checkpoint's avail list, or the base of its incremental avail list, is going away, free
+ *     its blocks. Base lists are shared: don't free blocks still referenced by the live system or a
+ *     checkpoint that isn't being deleted.
+ */
+static int
+__ckpt_avail_fblocks(WT_SESSION_IMPL *session, WT_BLOCK *block, WT_CKPT *ckptbase, WT_EXTLIST *el)
+{
+    WT_BLOCK_CKPT *ci, _ci;
+    WT_CKPT *ckpt;
+    WT_EXT *ext;
+
+    if (el->offset == WT_BLOCK_INVALID_OFFSET || el->offset == block->live.avail_base.offset)
+        return (0);
+
+    WT_CKPT_FOREACH (ckptbase, ckpt) {
+        if (F_ISSET(ckpt, WT_CKPT_ADD | WT_CKPT_DELETE | WT_CKPT_FAKE) || ckpt->raw.size == 0)
+            continue;
+        if ((ci = ckpt->bpriv) == NULL) {
+            ci = &_ci;
+            WT_CLEAR(_ci);
+            WT_RET(__wt_block_ckpt_unpack(session, block, ckpt->raw.data, ckpt->raw.size, ci));
+        }
+        if (ci->root_objectid == block->objectid &&
+          (ci->avail.offset == el->offset || ci->avail_base.offset == el->offset))
+            return (0);
+    }
+
+    /* Deleted checkpoints may share a base list, only free it once. */
+    ext = __wt_block_off_srch_inclusive(&block->live.ckpt_avail, el->offset);
+    if (ext != NULL && ext->off <= el->offset)
+        return (0);
+
+    return (__ckpt_extlist_fblocks(session, block, el));
+}
+
+/*
+ * __ckpt_avail_base --
+ *     Decide if the live system's avail list is written incrementally. If the list is written in
+ *     full, it becomes the new base and the current base can go away.
+ */
+static int
+__ckpt_avail_base(
+  WT_SESSION_IMPL *session, WT_BLOCK *block, WT_CKPT *ckptbase, WT_BLOCK_CKPT *ci, bool *incrp)
+{
+    WT_EXTLIST base;
+    uint32_t changes;
+
+    *incrp = false;
+
+    /*
+     * Write the list incrementally unless the changes since the base was written are a significant
+     * fraction of the base: at that point, writing the full list costs little more and rebasing
+     * keeps subsequent incremental lists small.
+     */
+    if (ci->avail_base.offset == WT_BLOCK_INVALID_OFFSET)
+        return (0);
+    if (block->extlist_incremental) {
+        WT_RET(__wt_block_extlist_changes(&ci->avail, &ci->ckpt_avail, &ci->avail_base, &changes));
+        if ((uint64_t)changes * 100 <=
+          (uint64_t)ci->avail_base.entries * block->extlist_consolidate) {
+            WT_STAT_CONN_INCR(session, block_extlist_incremental);
+            *incrp = true;
+            return (0);
+        }
+        WT_STAT_CONN_INCR(session, block_extlist_consolidate);
+    }
+
+    /*
+     * Discard the base, keeping a copy of its address. Its blocks are freed into the checkpoint
+     * avail list (they can't be reused until the new checkpoint is durable), and so are written as
+     * part of the new list.
+     */
+    base = ci->avail_base;
+    __wt_block_extlist_free(session, &ci->avail_base);
+    WT_RET(__wt_block_extlist_init(session, &ci->avail_base, "live", "avail_base", false));
+    return (__ckpt_avail_fblocks(session, block, ckptbase, &base));
+}
+
 /*
  * __ckpt_verify --
  *     Diagnostic code, confirm we get what we expect in the checkpoint array.
@@ -728,7 +824,8 @@ __ckpt_process(WT_SESSION_IMPL *session, WT_BLOCK *block, WT_CKPT *ckptbase)
          * list.
          */
         WT_ERR(__ckpt_extlist_fblocks(session, block, &a->alloc));
-        WT_ERR(__ckpt_extlist_fblocks(session, block, &a->avail));
+        WT_ERR(__ckpt_avail_fblocks(session, block, ckptbase, &a->avail));
+        WT_ERR(__ckpt_avail_fblocks(session, block, ckptbase, &a->avail_base));
         WT_ERR(__ckpt_extlist_fblocks(session, block, &a->discard));
 
         /*
@@ -865,8 +962,9 @@ __ckpt_update(
     WT_DECL_ITEM(a);
     WT_DECL_RET;
     uint8_t *endp;
-    bool is_live;
+    bool avail_incr, is_live;
 
+    avail_incr = false;
     is_live = F_ISSET(ckpt, WT_CKPT_ADD);
     if (is_live)
         WT_ASSERT_SPINLOCK_OWNED(session, &block->live_lock);
@@ -881,14 +979,20 @@ __ckpt_update(
      * Write the checkpoint's alloc and discard extent lists. Note these blocks never appear on the
      * system's allocation list, checkpoint extent blocks don't appear on any extent lists.
      */
-    WT_RET(__wt_block_extlist_write(session, block, &ci->alloc, NULL));
-    WT_RET(__wt_block_extlist_write(session, block, &ci->discard, NULL));
+    WT_RET(__wt_block_extlist_write(session, block, &ci->alloc, NULL, NULL));
+    WT_RET(__wt_block_extlist_write(session, block, &ci->discard, NULL, NULL));
 
     /*
      * If this is the final block, we append an incomplete copy of the checkpoint information to the
      * avail list for standalone retrieval.
      */
     if (is_live) {
+        /*
+         * Decide how the avail list will be written, the checkpoint information includes the base
+         * of an incremental list.
+         */
+        WT_RET(__ckpt_avail_base(session, block, ckptbase, ci, &avail_incr));
+
         /*
          * Copy the INCOMPLETE checkpoint information into the checkpoint.
          */
@@ -921,10 +1025,26 @@ __ckpt_update(
      * until the new checkpoint locations have been saved to the metadata.
      */
     if (is_live) {
+        /*
+         * A list written in full becomes the base for subsequent incremental lists: copy it first,
+         * writing the list allocates its blocks from it.
+         */
+        if (!avail_incr && block->extlist_incremental)
+            WT_RET(__wt_block_extlist_base_set(
+              session, block, &ci->avail, &ci->ckpt_avail, &ci->avail_base));
+
         block->final_ckpt = ckpt;
-        ret = __wt_block_extlist_write(session, block, &ci->avail, &ci->ckpt_avail);
+        ret = __wt_block_extlist_write(
+          session, block, &ci->avail, &ci->ckpt_avail, avail_incr ? &ci->avail_base : NULL);
         block->final_ckpt = NULL;
         WT_RET(ret);
+
+        if (!avail_incr && block->extlist_incremental) {
+            ci->avail_base.objectid = ci->avail.objectid;
+            ci->avail_base.offset = ci->avail.offset;
+            ci->avail_base.size = ci->avail.size;
+            ci->avail_base.checksum = ci->avail.checksum;
+        }
     }
 
     /*
@@ -295,7 +295,8 @@ __wt_block_checkpoint_last(WT_SESSION_IMPL *session, WT_BLOCK *block, char **met
 
         p = WT_BLOCK_HEADER_BYTE(tmp->mem);
         WT_BLOCK_SKIP(__wt_extlist_read_pair(&p, &ext_off, &ext_size));
-        if (ext_off != WT_BLOCK_EXTLIST_MAGIC || ext_size != 0)
+        if (ext_off != WT_BLOCK_EXTLIST_MAGIC ||
+          (ext_size != 0 && ext_size != WT_BLOCK_EXTLIST_INCREMENTAL))
             continue;
         for (;;) {
             if ((ret = __wt_extlist_read_pair(&p, &ext_off, &ext_size)) != 0)
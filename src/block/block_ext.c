@@ -127,6 +127,90 @@ __block_size_srch(WT_SIZE **head, wt_off_t size, WT_SIZE ***stack)
             stack[i--] = szp--;
 }
 
+/*
+ * __block_size_class --
+ *     Return the segregated size class of an extent size: the base-2 logarithm of the size.
+ */
+static WT_INLINE u_int
+__block_size_class(wt_off_t size)
+{
+#if defined(_MSC_VER)
+    unsigned long idx;
+#endif
+    uint64_t v;
+    u_int cls;
+
+    v = (uint64_t)size;
+#if defined(__GNUC__)
+    cls = v == 0 ? 0 : 63 - (u_int)__builtin_clzll(v);
+#elif defined(_MSC_VER)
+    cls = _BitScanReverse64(&idx, v) ? (u_int)idx : 0;
+#else
+    for (cls = 0; (v >>= 1) != 0;)
+        ++cls;
+#endif
+    return (cls);
+}
+
+/*
+ * __block_size_class_first --
+ *     Return the lowest non-empty size class in a non-zero bitmap.
+ */
+static WT_INLINE u_int
+__block_size_class_first(uint64_t bitmap)
+{
+#if defined(_MSC_VER)
+    unsigned long idx;
+#endif
+    u_int cls;
+
+#if defined(__GNUC__)
+    cls = (u_int)__builtin_ctzll(bitmap);
+#elif defined(_MSC_VER)
+    (void)_BitScanForward64(&idx, bitmap);
+    cls = (u_int)idx;
+#else
+    for (cls = 0; (bitmap & 1) == 0; bitmap >>= 1)
+        ++cls;
+#endif
+    return (cls);
+}
+
+/*
+ * __block_class_srch --
+ *     Search the segregated size classes for an extent at least as large as the specified size.
+ */
+static WT_INLINE WT_EXT *
+__block_class_srch(WT_SIZE_CLASS *szc, wt_off_t size)
+{
+    WT_EXT *ext;
+    uint64_t larger;
+    u_int cls, i;
+
+    cls = __block_size_class(size);
+
+    /*
+     * Extents in the request's own class may be too small: check the first few in offset order.
+     * Every extent in a larger class is big enough, so otherwise take the lowest offset from the
+     * smallest non-empty larger class, found in the bitmap without touching the lists. Only if
+     * there are no larger extents, walk the remainder of the request's own class.
+     */
+    i = 0;
+    WT_EXT_FOREACH_OFF (ext, szc->off[cls]) {
+        if (ext->size >= size)
+            return (ext);
+        if (++i == WT_BLOCK_SIZE_CLASS_PROBE)
+            break;
+    }
+    larger = szc->bitmap & ~(((uint64_t)2 << cls) - 1);
+    if (larger != 0)
+        return (szc->off[__block_size_class_first(larger)][0]);
+    for (; ext != NULL; ext = ext->next[ext->depth])
+        if (ext->size >= size)
+            return (ext);
+    return (NULL);
+}
+
 /*
  * __block_off_srch_pair --
  *     Search a by-offset skiplist for before/after records of the specified offset.
@@ -172,13 +256,24 @@ __block_ext_insert(WT_SESSION_IMPL *session, WT_EXTLIST *el, WT_EXT *ext)
 {
     WT_EXT **astack[WT_SKIP_MAXDEPTH];
     WT_SIZE **sstack[WT_SKIP_MAXDEPTH], *szp;
-    u_int i;
+    u_int cls, i;
 
     /*
+     * If we are maintaining segregated size classes, insert the new WT_EXT structure into its
+     * class's offset skiplist and mark the class non-empty.
+     *
      * If we are inserting a new size onto the size skiplist, we'll need a new WT_SIZE structure for
      * that skiplist.
      */
-    if (el->track_size) {
+    if (el->szc != NULL) {
+        cls = __block_size_class(ext->size);
+        __block_off_srch(el->szc->off[cls], ext->off, astack, true);
+        for (i = 0; i < ext->depth; ++i) {
+            ext->next[i + ext->depth] = *astack[i];
+            *astack[i] = ext;
+        }
+        el->szc->bitmap |= (uint64_t)1 << cls;
+    } else if (el->track_size) {
         __block_size_srch(el->sz, ext->size, sstack);
         szp = *sstack[0];
         if (szp == NULL || szp->size != ext->size) {
@@ -334,7 +429,7 @@ __block_off_remove(
 {
     WT_EXT **astack[WT_SKIP_MAXDEPTH], *ext;
     WT_SIZE **sstack[WT_SKIP_MAXDEPTH], *szp;
-    u_int i;
+    u_int cls, i;
 
     /* Find and remove the record from the by-offset skiplist. */
     __block_off_srch(el->off, off, astack, false);
@@ -345,10 +440,20 @@ __block_off_remove(
         *astack[i] = ext->next[i];
 
     /*
-     * Find and remove the record from the size's offset skiplist; if that empties the by-size
-     * skiplist entry, remove it as well.
+     * Find and remove the record from the size's (or size class's) offset skiplist; if that empties
+     * the by-size skiplist entry, remove it as well, if it empties the size class, clear its bit.
      */
-    if (el->track_size) {
+    if (el->szc != NULL) {
+        cls = __block_size_class(ext->size);
+        __block_off_srch(el->szc->off[cls], off, astack, true);
+        ext = *astack[0];
+        if (ext == NULL || ext->off != off)
+            goto corrupt;
+        for (i = 0; i < ext->depth; ++i)
+            *astack[i] = ext->next[i + ext->depth];
+        if (el->szc->off[cls][0] == NULL)
+            el->szc->bitmap &= ~((uint64_t)1 << cls);
+    } else if (el->track_size) {
         __block_size_srch(el->sz, ext->size, sstack);
         szp = *sstack[0];
         if (szp == NULL || szp->size != ext->size)
@@ -548,8 +653,12 @@ __wt_block_alloc(WT_SESSION_IMPL *session, WT_BLOCK *block, wt_off_t *offp, wt_o
           (intmax_t)size, block->allocsize);
 
     /*
-     * Allocation is either first-fit (lowest offset), or best-fit (best size). If it's first-fit,
-     * walk the offset list linearly until we find an entry that will work.
+     * Allocation is either first-fit (lowest offset), segregated-fit (size class) or best-fit (best
+     * size). If it's first-fit, walk the offset list linearly until we find an entry that will
+     * work.
+     *
+     * If it's segregated-fit, search the request's size class and then the smallest non-empty
+     * larger size class, see the search function for details.
      *
      * If it's best-fit by size, search the by-size skiplist for the size and take the first entry
      * on the by-size offset list. This means we prefer best-fit over lower offset, but within a
@@ -563,6 +672,9 @@ __wt_block_alloc(WT_SESSION_IMPL *session, WT_BLOCK *block, wt_off_t *offp, wt_o
         if (!__block_first_srch(block->live.avail.off, size, estack))
             goto append;
         ext = *estack[0];
+    } else if (block->live.avail.szc != NULL) {
+        if ((ext = __block_class_srch(block->live.avail.szc, size)) == NULL)
+            goto append;
     } else {
         __block_size_srch(block->live.avail.sz, size, sstack);
         if ((szp = *sstack[0]) == NULL) {
@@ -942,6 +1054,7 @@ __wt_block_extlist_merge(WT_SESSION_IMPL *session, WT_BLOCK *block, WT_EXTLIST *
 {
     WT_EXT *ext;
     WT_EXTLIST tmp;
+    WT_SIZE_CLASS *szc;
     u_int i;
 
     /*
@@ -954,9 +1067,10 @@ __wt_block_extlist_merge(WT_SESSION_IMPL *session, WT_BLOCK *block, WT_EXTLIST *
     /*
      * Sometimes the list we are merging is much bigger than the other: if so, swap the lists around
      * to reduce the amount of work we need to do during the merge. The size lists have to match as
-     * well, so this is only possible if both lists are tracking sizes, or neither are.
+     * well, so this is only possible if both lists are tracking sizes the same way, or neither are.
      */
-    if (a->track_size == b->track_size && a->entries > b->entries) {
+    if (a->track_size == b->track_size && (a->szc == NULL) == (b->szc == NULL) &&
+      a->entries > b->entries) {
         tmp = *a;
         a->bytes = b->bytes;
         b->bytes = tmp.bytes;
@@ -968,6 +1082,9 @@ __wt_block_extlist_merge(WT_SESSION_IMPL *session, WT_BLOCK *block, WT_EXTLIST *
             a->sz[i] = b->sz[i];
             b->sz[i] = tmp.sz[i];
         }
+        szc = a->szc;
+        a->szc = b->szc;
+        b->szc = szc;
     }
 
     WT_EXT_FOREACH (ext, a->off)
@@ -1118,15 +1235,92 @@ __block_merge(
     return (__block_ext_insert(session, el, ext));
 }
 
+/*
+ * __block_extlist_read --
+ *     Read an extent list block into an extent list. An incremental list's added ranges are merged
+ *     into the list and its removed ranges are taken out of it, the caller has already read its
+ *     base list.
+ */
+static int
+__block_extlist_read(WT_SESSION_IMPL *session, WT_BLOCK *block, WT_EXTLIST *el, WT_EXTLIST *src,
+  wt_off_t ckpt_size, bool merge, bool incremental)
+{
+    WT_DECL_ITEM(tmp);
+    WT_DECL_RET;
+    wt_off_t off, size;
+    const uint8_t *p;
+    int (*func)(WT_SESSION_IMPL *, WT_BLOCK *, WT_EXTLIST *, wt_off_t, wt_off_t);
+
+    off = size = 0;
+
+    WT_RET(__wt_scr_alloc(session, src->size, &tmp));
+    WT_ERR(__wt_block_read_off(
+      session, block, tmp, src->objectid, src->offset, src->size, src->checksum));
+
+    p = WT_BLOCK_HEADER_BYTE(tmp->mem);
+    WT_ERR(__wt_extlist_read_pair(&p, &off, &size));
+    if (off != WT_BLOCK_EXTLIST_MAGIC ||
+      size != (incremental ? WT_BLOCK_EXTLIST_INCREMENTAL : 0))
+        goto corrupted;
+
+    /*
+     * If we're not creating both offset and size skiplists, use the simpler append API, otherwise
+     * do a full merge. There are two reasons for the test: first, checkpoint "available" lists are
+     * NOT sorted (checkpoints write two separate lists, both of which are sorted but they're not
+     * merged). Second, the "available" list is sorted by size as well as by offset, and the
+     * fast-path append code doesn't support that, it's limited to offset. The test of "track size"
+     * is short-hand for "are we reading the available-blocks list", callers reading an available
+     * list into an offset-only list have to ask for a merge.
+     */
+    func = el->track_size == 0 && !merge ? __block_append : __block_merge;
+    for (;;) {
+        WT_ERR(__wt_extlist_read_pair(&p, &off, &size));
+        if (off == WT_BLOCK_INVALID_OFFSET)
+            break;
+
+        /* Incremental lists switch from added to removed ranges at a magic pair. */
+        if (incremental && off == WT_BLOCK_EXTLIST_MAGIC && size == 0 &&
+          func != __wt_block_off_remove_overlap) {
+            func = __wt_block_off_remove_overlap;
+            continue;
+        }
+
+        /*
+         * We check the offset/size pairs represent valid file ranges, then insert them into the
+         * list. We don't necessarily have to check for offsets past the end of the checkpoint, but
+         * it's a cheap test to do here and we'd have to do the check as part of file verification,
+         * regardless.
+         */
+        if (off < block->allocsize || off % block->allocsize != 0 || size % block->allocsize != 0 ||
+          off + size > ckpt_size) {
+corrupted:
+            __wt_scr_free(session, &tmp);
+            WT_BLOCK_RET(session, block, WT_ERROR,
+              "file contains a corrupted %s extent list, range %" PRIdMAX "-%" PRIdMAX
+              " past end-of-file",
+              el->name, (intmax_t)off, (intmax_t)(off + size));
+        }
+
+        WT_ERR(func(session, block, el, off, size));
+    }
+
+    WT_ERR(__block_extlist_dump(session, block, el, "read"));
+
+err:
+    __wt_scr_free(session, &tmp);
+    return (ret);
+}
+
 /*
  * __wt_block_extlist_read_avail --
  *     Read an avail extent list, includes minor special handling.
  */
 int
 __wt_block_extlist_read_avail(
-  WT_SESSION_IMPL *session, WT_BLOCK *block, WT_EXTLIST *el, wt_off_t ckpt_size)
+  WT_SESSION_IMPL *session, WT_BLOCK *block, WT_EXTLIST *el, WT_EXTLIST *base, wt_off_t ckpt_size)
 {
     WT_DECL_RET;
+    WT_EXT **astack[WT_SKIP_MAXDEPTH], *ext;
 
     /* If there isn't a list, we're done. */
     if (el->offset == WT_BLOCK_INVALID_OFFSET)
@@ -1141,14 +1335,33 @@ __wt_block_extlist_read_avail(
     __wt_spin_lock(session, &block->live_lock);
 #endif
 
-    WT_ERR(__wt_block_extlist_read(session, block, el, ckpt_size));
+    /*
+     * An incremental list is applied to its base list. The file may have been truncated since the
+     * base was written, its ranges are only checked against the end of the file once the changes
+     * have been applied.
+     */
+    if (base->offset != WT_BLOCK_INVALID_OFFSET) {
+        WT_ERR(__block_extlist_read(session, block, el, base, INT64_MAX, true, false));
+        WT_ERR(__block_extlist_read(session, block, el, el, INT64_MAX, true, true));
+        if ((ext = __block_off_srch_last(el->off, astack)) != NULL &&
+          ext->off + ext->size > ckpt_size)
+            WT_ERR_MSG(session, WT_ERROR,
+              "file contains a corrupted %s extent list, range %" PRIdMAX "-%" PRIdMAX
+              " past end-of-file",
+              el->name, (intmax_t)ext->off, (intmax_t)(ext->off + ext->size));
+    } else
+        WT_ERR(__block_extlist_read(session, block, el, el, ckpt_size, false, false));
 
     /*
      * Extent blocks are allocated from the available list: if reading the avail list, the extent
-     * blocks might be included, remove them.
+     * blocks might be included, remove them. That includes the base list's blocks, they're in use
+     * until the base is replaced.
      */
     WT_ERR_NOTFOUND_OK(
       __wt_block_off_remove_overlap(session, block, el, el->offset, el->size), false);
+    if (base->offset != WT_BLOCK_INVALID_OFFSET)
+        WT_ERR_NOTFOUND_OK(
+          __wt_block_off_remove_overlap(session, block, el, base->offset, base->size), false);
 
 err:
 #ifdef HAVE_DIAGNOSTIC
@@ -1166,81 +1379,163 @@ int
 __wt_block_extlist_read(
   WT_SESSION_IMPL *session, WT_BLOCK *block, WT_EXTLIST *el, wt_off_t ckpt_size)
 {
-    WT_DECL_ITEM(tmp);
-    WT_DECL_RET;
-    wt_off_t off, size;
-    const uint8_t *p;
-    int (*func)(WT_SESSION_IMPL *, WT_BLOCK *, WT_EXTLIST *, wt_off_t, wt_off_t);
-
-    off = size = 0;
-
     /* If there isn't a list, we're done. */
     if (el->offset == WT_BLOCK_INVALID_OFFSET)
         return (0);
 
-    WT_RET(__wt_scr_alloc(session, el->size, &tmp));
-    WT_ERR(
-      __wt_block_read_off(session, block, tmp, el->objectid, el->offset, el->size, el->checksum));
+    return (__block_extlist_read(session, block, el, el, ckpt_size, false, false));
+}
 
-    p = WT_BLOCK_HEADER_BYTE(tmp->mem);
-    WT_ERR(__wt_extlist_read_pair(&p, &off, &size));
-    if (off != WT_BLOCK_EXTLIST_MAGIC || size != 0)
-        goto corrupted;
+/*
+ * __wt_block_extlist_read_base --
+ *     Read the live system's avail list base, the list against which incremental avail lists are
+ *     written. If the avail list isn't incremental, it becomes the base. The file may have been
+ *     truncated since the base was written, don't check its ranges against the end of the file.
+ */
+int
+__wt_block_extlist_read_base(WT_SESSION_IMPL *session, WT_BLOCK *block, WT_BLOCK_CKPT *ci)
+{
+    WT_EXTLIST *base;
 
-    /*
-     * If we're not creating both offset and size skiplists, use the simpler append API, otherwise
-     * do a full merge. There are two reasons for the test: first, checkpoint "available" lists are
-     * NOT sorted (checkpoints write two separate lists, both of which are sorted but they're not
-     * merged). Second, the "available" list is sorted by size as well as by offset, and the
-     * fast-path append code doesn't support that, it's limited to offset. The test of "track size"
-     * is short-hand for "are we reading the available-blocks list".
-     */
-    func = el->track_size == 0 ? __block_append : __block_merge;
-    for (;;) {
-        WT_ERR(__wt_extlist_read_pair(&p, &off, &size));
-        if (off == WT_BLOCK_INVALID_OFFSET)
+    base = &ci->avail_base;
+    if (base->offset == WT_BLOCK_INVALID_OFFSET) {
+        if (ci->avail.offset == WT_BLOCK_INVALID_OFFSET)
+            return (0);
+        base->objectid = ci->avail.objectid;
+        base->offset = ci->avail.offset;
+        base->size = ci->avail.size;
+        base->checksum = ci->avail.checksum;
+    }
+    return (__block_extlist_read(session, block, base, base, INT64_MAX, true, false));
+}
+
+/*
+ * __block_ext_union_next --
+ *     Return the next range from the union of two disjoint extent lists, coalescing adjacent
+ *     ranges, advancing the caller's list references.
+ */
+static bool
+__block_ext_union_next(WT_EXT **ap, WT_EXT **bp, wt_off_t *offp, wt_off_t *sizep)
+{
+    WT_EXT **nextp;
+    wt_off_t off, size;
+
+    if (*ap == NULL && *bp == NULL)
+        return (false);
+
+    for (off = size = 0;;) {
+        if (*ap == NULL && *bp == NULL)
             break;
+        nextp = *bp == NULL || (*ap != NULL && (*ap)->off < (*bp)->off) ? ap : bp;
+        if (size == 0)
+            off = (*nextp)->off;
+        else if ((*nextp)->off != off + size)
+            break;
+        size += (*nextp)->size;
+        *nextp = (*nextp)->next[0];
+    }
 
-        /*
-         * We check the offset/size pairs represent valid file ranges, then insert them into the
-         * list. We don't necessarily have to check for offsets past the end of the checkpoint, but
-         * it's a cheap test to do here and we'd have to do the check as part of file verification,
-         * regardless.
-         */
-        if (off < block->allocsize || off % block->allocsize != 0 || size % block->allocsize != 0 ||
-          off + size > ckpt_size) {
-corrupted:
-            __wt_scr_free(session, &tmp);
-            WT_BLOCK_RET(session, block, WT_ERROR,
-              "file contains a corrupted %s extent list, range %" PRIdMAX "-%" PRIdMAX
-              " past end-of-file",
-              el->name, (intmax_t)off, (intmax_t)(off + size));
+    *offp = off;
+    *sizep = size;
+    return (true);
+}
+
+/*
+ * __block_extlist_diff --
+ *     Walk the ranges in the union of two extent lists that don't appear in the union of two other
+ *     extent lists, counting them and optionally writing them into a buffer.
+ */
+static int
+__block_extlist_diff(WT_EXTLIST *a1, WT_EXTLIST *a2, WT_EXTLIST *b1, WT_EXTLIST *b2, uint8_t **pp,
+  uint32_t *entriesp)
+{
+    WT_EXT *a1ext, *a2ext, *b1ext, *b2ext;
+    wt_off_t a_end, a_off, a_size, b_off, b_size;
+    uint32_t entries;
+    bool b_more;
+
+    a1ext = a1 == NULL ? NULL : a1->off[0];
+    a2ext = a2 == NULL ? NULL : a2->off[0];
+    b1ext = b1 == NULL ? NULL : b1->off[0];
+    b2ext = b2 == NULL ? NULL : b2->off[0];
+    b_off = b_size = 0;
+    entries = 0;
+
+    b_more = __block_ext_union_next(&b1ext, &b2ext, &b_off, &b_size);
+    while (__block_ext_union_next(&a1ext, &a2ext, &a_off, &a_size))
+        for (a_end = a_off + a_size; a_off < a_end; a_off = b_off + b_size) {
+            /* Skip ranges that end before this one starts. */
+            while (b_more && b_off + b_size <= a_off)
+                b_more = __block_ext_union_next(&b1ext, &b2ext, &b_off, &b_size);
+
+            /* Everything up to the next range, or to the end of this range, is a difference. */
+            if (!b_more || b_off >= a_end) {
+                if (pp != NULL)
+                    WT_RET(__wt_extlist_write_pair(pp, a_off, a_end - a_off));
+                ++entries;
+                break;
+            }
+            if (b_off > a_off) {
+                if (pp != NULL)
+                    WT_RET(__wt_extlist_write_pair(pp, a_off, b_off - a_off));
+                ++entries;
+            }
         }
 
-        WT_ERR(func(session, block, el, off, size));
-    }
+    *entriesp = entries;
+    return (0);
+}
 
-    WT_ERR(__block_extlist_dump(session, block, el, "read"));
+/*
+ * __wt_block_extlist_changes --
+ *     Return the number of changes an incremental avail list would record against its base.
+ */
+int
+__wt_block_extlist_changes(
+  WT_EXTLIST *el, WT_EXTLIST *additional, WT_EXTLIST *base, uint32_t *changesp)
+{
+    uint32_t added, removed;
 
-err:
-    __wt_scr_free(session, &tmp);
-    return (ret);
+    WT_RET(__block_extlist_diff(el, additional, base, NULL, NULL, &added));
+    WT_RET(__block_extlist_diff(base, NULL, el, additional, NULL, &removed));
+    *changesp = added + removed;
+    return (0);
+}
+
+/*
+ * __wt_block_extlist_base_set --
+ *     Copy the live system's avail list into its base, before the list is written in full.
+ */
+int
+__wt_block_extlist_base_set(WT_SESSION_IMPL *session, WT_BLOCK *block, WT_EXTLIST *el,
+  WT_EXTLIST *additional, WT_EXTLIST *base)
+{
+    WT_EXT *a, *b;
+    wt_off_t off, size;
+
+    /* The base is an offset-only list, and the union of the two lists is sorted, append. */
+    a = el->off[0];
+    b = additional == NULL ? NULL : additional->off[0];
+    while (__block_ext_union_next(&a, &b, &off, &size))
+        WT_RET(__block_append(session, block, base, off, size));
+    return (0);
 }
 
 /*
  * __wt_block_extlist_write --
- *     Write an extent list at the tail of the file.
+ *     Write an extent list at the tail of the file. If a base list is passed, write the list
+ *     incrementally, as the changes against the base.
  */
 int
-__wt_block_extlist_write(
-  WT_SESSION_IMPL *session, WT_BLOCK *block, WT_EXTLIST *el, WT_EXTLIST *additional)
+__wt_block_extlist_write(WT_SESSION_IMPL *session, WT_BLOCK *block, WT_EXTLIST *el,
+  WT_EXTLIST *additional, WT_EXTLIST *base)
 {
     WT_DECL_ITEM(tmp);
     WT_DECL_RET;
     WT_EXT *ext;
     WT_PAGE_HEADER *dsk;
     size_t size;
-    uint32_t entries;
+    uint32_t added, entries, removed;
     uint8_t *p;
 
     WT_RET(__block_extlist_dump(session, block, el, "write"));
@@ -1248,9 +1543,17 @@ __wt_block_extlist_write(
     /*
      * Figure out how many entries we're writing -- if there aren't any entries, there's nothing to
      * write, unless we still have to write the extent list to include the checkpoint recovery
-     * information.
+     * information. Incremental lists include an additional pair separating added and removed
+     * ranges.
      */
-    entries = el->entries + (additional == NULL ? 0 : additional->entries);
+    added = removed = 0;
+    if (base == NULL)
+        entries = el->entries + (additional == NULL ? 0 : additional->entries);
+    else {
+        WT_RET(__block_extlist_diff(el, additional, base, NULL, NULL, &added));
+        WT_RET(__block_extlist_diff(base, NULL, el, additional, NULL, &removed));
+        entries = added + removed + 1;
+    }
     if (entries == 0 && block->final_ckpt == NULL) {
         el->offset = WT_BLOCK_INVALID_OFFSET;
         el->checksum = el->size = 0;
@@ -1274,12 +1577,19 @@ __wt_block_extlist_write(
     /* Fill the page's data. */
     p = WT_BLOCK_HEADER_BYTE(dsk);
     /* Extent list starts */
-    WT_ERR(__wt_extlist_write_pair(&p, WT_BLOCK_EXTLIST_MAGIC, 0));
-    WT_EXT_FOREACH (ext, el->off) /* Free ranges */
-        WT_ERR(__wt_extlist_write_pair(&p, ext->off, ext->size));
-    if (additional != NULL)
-        WT_EXT_FOREACH (ext, additional->off) /* Free ranges */
+    if (base == NULL) {
+        WT_ERR(__wt_extlist_write_pair(&p, WT_BLOCK_EXTLIST_MAGIC, 0));
+        WT_EXT_FOREACH (ext, el->off) /* Free ranges */
             WT_ERR(__wt_extlist_write_pair(&p, ext->off, ext->size));
+        if (additional != NULL)
+            WT_EXT_FOREACH (ext, additional->off) /* Free ranges */
+                WT_ERR(__wt_extlist_write_pair(&p, ext->off, ext->size));
+    } else {
+        WT_ERR(__wt_extlist_write_pair(&p, WT_BLOCK_EXTLIST_MAGIC, WT_BLOCK_EXTLIST_INCREMENTAL));
+        WT_ERR(__block_extlist_diff(el, additional, base, NULL, &p, &added)); /* Added ranges */
+        WT_ERR(__wt_extlist_write_pair(&p, WT_BLOCK_EXTLIST_MAGIC, 0));
+        WT_ERR(__block_extlist_diff(base, NULL, el, additional, &p, &removed)); /* Removed ranges */
+    }
     /* Extent list stops */
     WT_ERR(__wt_extlist_write_pair(
       &p, WT_BLOCK_INVALID_OFFSET, block->final_ckpt == NULL ? 0 : WT_BLOCK_EXTLIST_VERSION_CKPT));
@@ -1370,6 +1680,21 @@ __wt_block_extlist_init(
     return (0);
 }
 
+/*
+ * __wt_block_extlist_size_class --
+ *     Configure an empty by-size extent list to use segregated size classes, if the block is
+ *     configured for it.
+ */
+int
+__wt_block_extlist_size_class(WT_SESSION_IMPL *session, WT_BLOCK *block, WT_EXTLIST *el)
+{
+    if (!block->allocsizeclass)
+        return (0);
+
+    WT_ASSERT(session, el->track_size && el->entries == 0 && el->szc == NULL);
+    return (__wt_calloc_one(session, &el->szc));
+}
+
 /*
  * __wt_block_extlist_free --
  *     Discard an extent list.
@@ -1390,6 +1715,7 @@ __wt_block_extlist_free(WT_SESSION_IMPL *session, WT_EXTLIST *el)
         nszp = szp->next[0];
         __wt_free(session, szp);
     }
+    __wt_free(session, el->szc);
 
     /* Extent lists are re-used, clear them. */
     WT_CLEAR(*el);
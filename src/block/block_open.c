@@ -135,6 +135,8 @@ __wt_block_close(WT_SESSION_IMPL *session, WT_BLOCK *block)
     WT_TRET(__wt_close(session, &block->fh));
 
     __wt_spin_destroy(session, &block->live_lock);
+    __wt_spin_destroy(session, &block->write_batch_lock);
+    __wt_buf_free(session, &block->write_batch);
     __wt_block_ckpt_destroy(session, &block->live);
 
     __wt_overwrite_and_free(session, block);
@@ -211,6 +213,12 @@ __wt_block_open(WT_SESSION_IMPL *session, const char *filename, uint32_t objecti
 
     WT_ERR(__wt_config_gets(session, cfg, "block_allocation", &cval));
     block->allocfirst = WT_CONFIG_LIT_MATCH("first", cval) ? 1 : 0;
+    block->allocsizeclass = WT_CONFIG_LIT_MATCH("segregated", cval);
+
+    WT_ERR(__wt_config_gets(session, cfg, "checkpoint_extent_lists.incremental", &cval));
+    block->extlist_incremental = cval.val != 0;
+    WT_ERR(__wt_config_gets(session, cfg, "checkpoint_extent_lists.consolidate", &cval));
+    block->extlist_consolidate = (u_int)cval.val;
 
     /* Configuration: optional OS buffer cache maximum size. */
     WT_ERR(__wt_config_gets(session, cfg, "os_cache_max", &cval));
@@ -263,6 +271,7 @@ __wt_block_open(WT_SESSION_IMPL *session, const char *filename, uint32_t objecti
 
     /* Initialize the live checkpoint's lock. */
     WT_ERR(__wt_spin_init(session, &block->live_lock, "block manager"));
+    WT_ERR(__wt_spin_init(session, &block->write_batch_lock, "block write batch"));
 
     /*
      * Read the description information from the first block.
@@ -335,7 +344,7 @@ __wt_desc_write(WT_SESSION_IMPL *session, WT_FH *fh, uint32_t allocsize)
 static bool
 __file_is_wt_internal(const char *name)
 {
-    return (strcmp(name, WT_METAFILE) == 0 || strcmp(name, WT_HS_FILE) == 0 ||
+    return (strcmp(name, WT_METAFILE) == 0 || WT_PREFIX_MATCH(name, WT_HS_FILE_PREFIX) ||
       strcmp(name, WT_CC_METAFILE) == 0);
 }
 
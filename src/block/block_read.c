@@ -203,6 +203,9 @@ __wt_block_read_off(WT_SESSION_IMPL *session, WT_BLOCK *block, WT_ITEM *buf, uin
           "%s: impossibly small block size of %" PRIu32 "B, less than allocation size of %" PRIu32,
           block->name, size, block->allocsize);
 
+    /* The block may be part of a checkpoint write batch that hasn't yet been written. */
+    WT_RET(__wt_block_write_batch_overlap(session, block, offset, (wt_off_t)size));
+
     WT_RET(__wt_buf_init(session, buf, bufsize));
     buf->size = size;
 
@@ -28,6 +28,7 @@ __wt_block_salvage_start(WT_SESSION_IMPL *session, WT_BLOCK *block)
      * forward.
      */
     WT_RET(__wt_block_ckpt_init(session, &block->live, "live"));
+    WT_RET(__wt_block_extlist_size_class(session, block, &block->live.avail));
 
     /*
      * Truncate the file to an allocation-size multiple of blocks (bytes trailing the last block
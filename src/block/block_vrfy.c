@@ -123,7 +123,7 @@ __verify_last_avail(WT_SESSION_IMPL *session, WT_BLOCK *block, WT_CKPT *ckpt)
 
     el = &ci->avail;
     if (el->offset != WT_BLOCK_INVALID_OFFSET) {
-        WT_ERR(__wt_block_extlist_read_avail(session, block, el, ci->file_size));
+        WT_ERR(__wt_block_extlist_read_avail(session, block, el, &ci->avail_base, ci->file_size));
         WT_EXT_FOREACH (ext, el->off)
             if ((ret = __verify_filefrag_add(
                    session, block, "avail-list chunk", ext->off, ext->size, true)) != 0)
@@ -224,6 +224,10 @@ __wt_verify_ckpt_load(WT_SESSION_IMPL *session, WT_BLOCK *block, WT_BLOCK_CKPT *
     if (ci->avail.offset != WT_BLOCK_INVALID_OFFSET)
         WT_RET(__verify_filefrag_add(
           session, block, "avail list", ci->avail.offset, (wt_off_t)ci->avail.size, true));
+    /* Incremental avail lists share their base list, it may be referenced multiple times. */
+    if (ci->avail_base.offset != WT_BLOCK_INVALID_OFFSET)
+        WT_RET(__verify_filefrag_add(session, block, "avail list base", ci->avail_base.offset,
+          (wt_off_t)ci->avail_base.size, false));
     if (ci->discard.offset != WT_BLOCK_INVALID_OFFSET)
         WT_RET(__verify_filefrag_add(
           session, block, "discard list", ci->discard.offset, (wt_off_t)ci->discard.size, true));
@@ -258,7 +262,7 @@ __wt_verify_ckpt_load(WT_SESSION_IMPL *session, WT_BLOCK *block, WT_BLOCK_CKPT *
      */
     el = &ci->avail;
     if (el->offset != WT_BLOCK_INVALID_OFFSET) {
-        WT_RET(__wt_block_extlist_read(session, block, el, ci->file_size));
+        WT_RET(__wt_block_extlist_read_avail(session, block, el, &ci->avail_base, ci->file_size));
         __wt_block_extlist_free(session, el);
     }
 
@@ -208,6 +208,119 @@ __wt_block_write(WT_SESSION_IMPL *session, WT_BLOCK *block, WT_ITEM *buf, uint8_
     return (0);
 }
 
+/*
+ * __block_write_batch_flush --
+ *     Write the block's pending batch of checkpoint writes, the write batch lock must be held.
+ */
+static int
+__block_write_batch_flush(WT_SESSION_IMPL *session, WT_BLOCK *block)
+{
+    WT_ASSERT_SPINLOCK_OWNED(session, &block->write_batch_lock);
+
+    if (block->write_batch_size == 0)
+        return (0);
+
+    /*
+     * If the write fails, leave the batch in place: the blocks have already been handed out, and
+     * the checkpoint must not complete until they're written, so a later flush will retry and the
+     * checkpoint's flush will return the error.
+     */
+    WT_RET(__wt_write(session, block->fh, block->write_batch_off, block->write_batch_size,
+      block->write_batch.mem));
+
+    WT_STAT_CONN_INCR(session, block_write_batch);
+    __wt_verbose_debug2(session, WT_VERB_WRITE, "batch off %" PRIuMAX ", size %" PRIuMAX,
+      (uintmax_t)block->write_batch_off, (uintmax_t)block->write_batch_size);
+
+    WT_RELEASE_WRITE(block->write_batch_size, 0);
+    return (0);
+}
+
+/*
+ * __wt_block_write_batch_flush --
+ *     Write the block's pending batch of checkpoint writes, optionally discarding the batch buffer.
+ */
+int
+__wt_block_write_batch_flush(WT_SESSION_IMPL *session, WT_BLOCK *block, bool discard)
+{
+    WT_DECL_RET;
+
+    __wt_spin_lock(session, &block->write_batch_lock);
+    ret = __block_write_batch_flush(session, block);
+    if (ret == 0 && discard)
+        __wt_buf_free(session, &block->write_batch);
+    __wt_spin_unlock(session, &block->write_batch_lock);
+    return (ret);
+}
+
+/*
+ * __wt_block_write_batch_overlap --
+ *     Write the block's pending batch of checkpoint writes if it overlaps a file range: used before
+ *     reading a block, or writing a block to reused space, to keep file I/O in order.
+ */
+int
+__wt_block_write_batch_overlap(
+  WT_SESSION_IMPL *session, WT_BLOCK *block, wt_off_t offset, wt_off_t size)
+{
+    WT_DECL_RET;
+    size_t batch_size;
+
+    /* Don't take the lock in the common case, where there's no batch. */
+    WT_ACQUIRE_READ(batch_size, block->write_batch_size);
+    if (batch_size == 0)
+        return (0);
+
+    __wt_spin_lock(session, &block->write_batch_lock);
+    if (block->write_batch_size != 0 &&
+      offset < block->write_batch_off + (wt_off_t)block->write_batch_size &&
+      block->write_batch_off < offset + size)
+        ret = __block_write_batch_flush(session, block);
+    __wt_spin_unlock(session, &block->write_batch_lock);
+    return (ret);
+}
+
+/*
+ * __block_write_batch --
+ *     Add a checkpoint write to the block's write batch. A checkpoint writing many pages often
+ *     allocates them at adjacent file offsets (extending the file, or carving them from a single
+ *     large free extent), gather those into a single write call instead of one per block.
+ */
+static int
+__block_write_batch(
+  WT_SESSION_IMPL *session, WT_BLOCK *block, wt_off_t offset, size_t align_size, const void *mem)
+{
+    WT_DECL_RET;
+
+    __wt_spin_lock(session, &block->write_batch_lock);
+
+    /* Flush the batch if the new block doesn't follow it or won't fit. */
+    if (block->write_batch_size != 0 &&
+      (offset != block->write_batch_off + (wt_off_t)block->write_batch_size ||
+        block->write_batch_size + align_size > WT_BLOCK_WRITE_BATCH_MAX))
+        WT_ERR(__block_write_batch_flush(session, block));
+
+    /* Large blocks gain nothing from batching. */
+    if (align_size * 2 > WT_BLOCK_WRITE_BATCH_MAX) {
+        ret = __wt_write(session, block->fh, offset, align_size, mem);
+        goto err;
+    }
+
+    /* The batch is written with the block's file handle, which may be configured for direct I/O. */
+    if (block->write_batch.mem == NULL) {
+        F_SET(&block->write_batch, WT_ITEM_ALIGNED);
+        WT_ERR(__wt_buf_init(session, &block->write_batch, WT_BLOCK_WRITE_BATCH_MAX));
+    }
+    if (block->write_batch_size == 0)
+        block->write_batch_off = offset;
+    memcpy((uint8_t *)block->write_batch.mem + block->write_batch_size, mem, align_size);
+    WT_RELEASE_WRITE(block->write_batch_size, block->write_batch_size + align_size);
+    WT_STAT_CONN_INCR(session, block_write_batch_blocks);
+
+err:
+    __wt_spin_unlock(session, &block->write_batch_lock);
+    return (ret);
+}
+
 /*
  * __block_write_off --
  *     Write a buffer into a block, returning the block's offset, size and checksum.
@@ -327,8 +440,20 @@ __block_write_off(WT_SESSION_IMPL *session, WT_BLOCK *block, WT_ITEM *buf, wt_of
     blk->checksum = __wt_bswap32(blk->checksum);
 #endif
 
-    /* Write the block. */
-    if ((ret = __wt_write(session, fh, offset, align_size, buf->mem)) != 0) {
+    /*
+     * Write the block. Checkpoint writes are batched (except for the final checkpoint write and the
+     * extent lists, which are written with the live system locked). Otherwise, if the block reuses
+     * space from a batched block that was since freed, write the batch first so the older data
+     * can't overwrite the newer.
+     */
+    if (checkpoint_io && !caller_locked && block->final_ckpt == NULL)
+        ret = __block_write_batch(session, block, offset, align_size, buf->mem);
+    else {
+        ret = __wt_block_write_batch_overlap(session, block, offset, (wt_off_t)align_size);
+        if (ret == 0)
+            ret = __wt_write(session, fh, offset, align_size, buf->mem);
+    }
+    if (ret != 0) {
         if (!caller_locked)
             __wt_spin_lock(session, &block->live_lock);
         WT_TRET(__wt_block_off_free(session, block, block->objectid, offset, (wt_off_t)align_size));
@@ -140,6 +140,283 @@ __blkcache_high_overhead(WT_SESSION_IMPL *session)
     return (blkcache->lookups == 0 || ((ops * 100) / blkcache->lookups) > blkcache->overhead_pct);
 }
 
+/*
+ * __blkcache_sketch_key --
+ *     Return the admission sketch key for a block: the address hash mixed with the file ID.
+ */
+static WT_INLINE uint64_t
+__blkcache_sketch_key(uint64_t hash, uint32_t fid)
+{
+    return (hash ^ ((uint64_t)fid * 0x9e3779b97f4a7c15ULL));
+}
+
+/*
+ * __blkcache_sketch_slot --
+ *     Return the counter for a key in a row of the sketch; rows use double hashing on the key.
+ */
+static WT_INLINE uint8_t *
+__blkcache_sketch_slot(WT_BLKCACHE *blkcache, uint64_t key, u_int row)
+{
+    return (&blkcache->sketch[(uint64_t)row * (blkcache->sketch_mask + 1) +
+      ((key + row * ((key >> 32) | 1)) & blkcache->sketch_mask)]);
+}
+
+/*
+ * __blkcache_sketch_age --
+ *     Halve every counter in the sketch so older accesses count for less.
+ */
+static void
+__blkcache_sketch_age(WT_BLKCACHE *blkcache)
+{
+    uint64_t i, n;
+
+    n = WT_BLKCACHE_SKETCH_DEPTH * (blkcache->sketch_mask + 1);
+    for (i = 0; i < n; i++)
+        blkcache->sketch[i] >>= 1;
+}
+
+/*
+ * __blkcache_sketch_increment --
+ *     Record an access to a block in the admission sketch.
+ */
+static void
+__blkcache_sketch_increment(WT_SESSION_IMPL *session, uint64_t key)
+{
+    WT_BLKCACHE *blkcache;
+    uint8_t *counter;
+    u_int row;
+
+    blkcache = &S2C(session)->blkcache;
+
+    /*
+     * The counters are updated without synchronization: a lost increment only makes the estimate
+     * slightly lower, and one thread ages the sketch each time the access count crosses a sample.
+     */
+    for (row = 0; row < WT_BLKCACHE_SKETCH_DEPTH; row++) {
+        counter = __blkcache_sketch_slot(blkcache, key, row);
+        if (*counter < WT_BLKCACHE_SKETCH_MAX)
+            ++*counter;
+    }
+    if (__wt_atomic_add64(&blkcache->sketch_accesses, 1) % blkcache->sketch_sample == 0)
+        __blkcache_sketch_age(blkcache);
+}
+
+/*
+ * __blkcache_sketch_estimate --
+ *     Return the estimated number of recent accesses to a block.
+ */
+static u_int
+__blkcache_sketch_estimate(WT_BLKCACHE *blkcache, uint64_t key)
+{
+    u_int freq, row;
+    uint8_t counter;
+
+    freq = WT_BLKCACHE_SKETCH_MAX;
+    for (row = 0; row < WT_BLKCACHE_SKETCH_DEPTH; row++)
+        if ((counter = *__blkcache_sketch_slot(blkcache, key, row)) < freq)
+            freq = counter;
+    return (freq);
+}
+
+/*
+ * __blkcache_admit --
+ *     Decide whether a block read from disk should be admitted into the cache in preference to the
+ *     block it competes with. The caller holds the bucket locks.
+ */
+static bool
+__blkcache_admit(
+  WT_SESSION_IMPL *session, uint64_t key, WT_BLKCACHE_ITEM *victim, uint64_t victim_hash)
+{
+    WT_BLKCACHE *blkcache;
+
+    blkcache = &S2C(session)->blkcache;
+
+    /* An empty bucket has no victim to compare against, admit the block. */
+    if (victim == NULL)
+        return (true);
+
+    return (__blkcache_sketch_estimate(blkcache, key) >
+      __blkcache_sketch_estimate(blkcache, __blkcache_sketch_key(victim_hash, victim->fid)));
+}
+
+/*
+ * __blkcache_buckets --
+ *     Return the two buckets a block can be stored in.
+ */
+static WT_INLINE void
+__blkcache_buckets(WT_BLKCACHE *blkcache, uint64_t hash, uint64_t *bucket1p, uint64_t *bucket2p)
+{
+    *bucket1p = hash % blkcache->bucket_count;
+    *bucket2p = (hash >> 32) % blkcache->bucket_count;
+    if (*bucket2p == *bucket1p)
+        *bucket2p = (*bucket1p + 1) % blkcache->bucket_count;
+}
+
+/*
+ * __blkcache_item_match --
+ *     Return if a cached item is the block with the given address.
+ */
+static WT_INLINE bool
+__blkcache_item_match(
+  WT_BLKCACHE_ITEM *blkcache_item, uint32_t fid, const uint8_t *addr, size_t addr_size)
+{
+    return (blkcache_item->fid == fid && blkcache_item->addr_size == addr_size &&
+      memcmp(blkcache_item->addr, addr, addr_size) == 0);
+}
+
+/*
+ * __blkcache_bucket_modify_begin --
+ *     Start modifying a bucket's slots. The caller holds the bucket lock.
+ */
+static WT_INLINE void
+__blkcache_bucket_modify_begin(WT_BLKCACHE_BUCKET *bucket)
+{
+    /* The atomic increment is a full barrier, ordering it before any check of an item's pins. */
+    (void)__wt_atomic_addv64(&bucket->seq, 1);
+}
+
+/*
+ * __blkcache_bucket_modify_end --
+ *     Finish modifying a bucket's slots. The caller holds the bucket lock.
+ */
+static WT_INLINE void
+__blkcache_bucket_modify_end(WT_BLKCACHE_BUCKET *bucket)
+{
+    (void)__wt_atomic_addv64(&bucket->seq, 1);
+}
+
+/*
+ * __blkcache_bucket_search --
+ *     Search a bucket for a block without locking it, returning the block pinned.
+ */
+static WT_BLKCACHE_ITEM *
+__blkcache_bucket_search(
+  WT_BLKCACHE_BUCKET *bucket, uint64_t hash, uint32_t fid, const uint8_t *addr, size_t addr_size)
+{
+    WT_BLKCACHE_ITEM *blkcache_item, *found;
+    uint64_t seq;
+    u_int i;
+
+    for (;;) {
+        /* Wait out a writer modifying the bucket's slots. */
+        while ((seq = __wt_atomic_loadv64(&bucket->seq)) % 2 != 0)
+            WT_PAUSE();
+        WT_ACQUIRE_BARRIER();
+
+        found = NULL;
+        for (i = 0; i < WT_BLKCACHE_BUCKET_SLOTS; i++)
+            if (bucket->hash[i] == hash && (blkcache_item = bucket->item[i]) != NULL &&
+              __blkcache_item_match(blkcache_item, fid, addr, addr_size)) {
+                found = blkcache_item;
+                break;
+            }
+
+        /*
+         * Pin the item before checking the sequence number. A writer removing an item makes the
+         * sequence number odd before checking the item's pins, and both are atomic operations with
+         * full barriers: either the writer sees our pin, or we see the sequence number change. If
+         * the bucket changed, the item we found may have been removed and reused, unpin it and
+         * retry. Items are never freed while the cache exists, so the racing reads are safe.
+         */
+        if (found != NULL)
+            (void)__wt_atomic_addv32(&found->ref_count, 1);
+        else
+            WT_ACQUIRE_BARRIER();
+        if (__wt_atomic_loadv64(&bucket->seq) == seq)
+            return (found);
+        if (found != NULL)
+            (void)__wt_atomic_subv32(&found->ref_count, 1);
+    }
+}
+
+/*
+ * __blkcache_bucket_find --
+ *     Return if a block is in a bucket. The caller holds the bucket lock.
+ */
+static bool
+__blkcache_bucket_find(
+  WT_BLKCACHE_BUCKET *bucket, uint64_t hash, uint32_t fid, const uint8_t *addr, size_t addr_size)
+{
+    u_int i;
+
+    for (i = 0; i < WT_BLKCACHE_BUCKET_SLOTS; i++)
+        if (bucket->hash[i] == hash && bucket->item[i] != NULL &&
+          __blkcache_item_match(bucket->item[i], fid, addr, addr_size))
+            return (true);
+    return (false);
+}
+
+/*
+ * __blkcache_item_alloc --
+ *     Allocate item metadata from the slabs.
+ */
+static int
+__blkcache_item_alloc(WT_SESSION_IMPL *session, WT_BLKCACHE_ITEM **blkcache_itemp)
+{
+    WT_BLKCACHE *blkcache;
+    WT_BLKCACHE_SLAB *slab;
+    WT_DECL_RET;
+    u_int i;
+
+    *blkcache_itemp = NULL;
+
+    blkcache = &S2C(session)->blkcache;
+
+    __wt_spin_lock(session, &blkcache->slab_lock);
+    if (blkcache->free_items == NULL) {
+        WT_ERR(__wt_calloc_one(session, &slab));
+        slab->next = blkcache->slabs;
+        blkcache->slabs = slab;
+        for (i = 0; i < WT_BLKCACHE_SLAB_ITEMS; i++) {
+            slab->items[i].next_free = blkcache->free_items;
+            blkcache->free_items = &slab->items[i];
+        }
+    }
+    *blkcache_itemp = blkcache->free_items;
+    blkcache->free_items = (*blkcache_itemp)->next_free;
+
+err:
+    __wt_spin_unlock(session, &blkcache->slab_lock);
+    return (ret);
+}
+
+/*
+ * __blkcache_item_free --
+ *     Return item metadata to the slabs.
+ */
+static void
+__blkcache_item_free(WT_SESSION_IMPL *session, WT_BLKCACHE_ITEM *blkcache_item)
+{
+    WT_BLKCACHE *blkcache;
+
+    blkcache = &S2C(session)->blkcache;
+
+    __wt_spin_lock(session, &blkcache->slab_lock);
+    blkcache_item->next_free = blkcache->free_items;
+    blkcache->free_items = blkcache_item;
+    __wt_spin_unlock(session, &blkcache->slab_lock);
+}
+
+/*
+ * __blkcache_item_discard --
+ *     Free a block that has been removed from its bucket and is no longer pinned.
+ */
+static void
+__blkcache_item_discard(WT_SESSION_IMPL *session, WT_BLKCACHE_ITEM *blkcache_item, int type)
+{
+    WT_BLKCACHE *blkcache;
+
+    blkcache = &S2C(session)->blkcache;
+
+    __blkcache_update_ref_histogram(session, blkcache_item, type);
+    (void)__wt_atomic_sub64(&blkcache->bytes_used, blkcache_item->data_size);
+    (void)__wt_atomic_sub64(&blkcache->bytes_logical,
+      blkcache_item->mem_size == 0 ? blkcache_item->data_size : blkcache_item->mem_size);
+    __blkcache_free(session, blkcache_item->data);
+    blkcache_item->data = NULL;
+    __blkcache_item_free(session, blkcache_item);
+}
+
 /*
  * __blkcache_should_evict --
  *     Decide if the block should be evicted.
@@ -199,9 +476,12 @@ static WT_THREAD_RET
 __blkcache_eviction_thread(void *arg)
 {
     WT_BLKCACHE *blkcache;
-    WT_BLKCACHE_ITEM *blkcache_item, *blkcache_item_tmp;
+    WT_BLKCACHE_BUCKET *bucket;
+    WT_BLKCACHE_ITEM *blkcache_item, *evict[WT_BLKCACHE_BUCKET_SLOTS];
     WT_SESSION_IMPL *session;
-    int i, reason;
+    uint64_t i;
+    u_int nevict, slot;
+    int reason;
     bool no_eviction_candidates;
 
     session = (WT_SESSION_IMPL *)arg;
@@ -238,35 +518,44 @@ __blkcache_eviction_thread(void *arg)
          * evict blocks with the smallest counter before evicting those with a larger one.
          */
         no_eviction_candidates = true;
-        for (i = 0; i < (int)blkcache->hash_size; i++) {
-            __wt_spin_lock(session, &blkcache->hash_locks[i]);
-            TAILQ_FOREACH_SAFE(blkcache_item, &blkcache->hash[i], hashq, blkcache_item_tmp)
-            {
+        for (i = 0; i < blkcache->bucket_count; i++) {
+            bucket = &blkcache->buckets[i];
+            nevict = 0;
+
+            /*
+             * Readers may pin blocks without the bucket lock, mark the bucket as changing before
+             * checking whether blocks are pinned. Blocks are freed after the bucket is unlocked.
+             */
+            __wt_spin_lock(session, &bucket->lock);
+            __blkcache_bucket_modify_begin(bucket);
+            for (slot = 0; slot < WT_BLKCACHE_BUCKET_SLOTS; slot++) {
+                if ((blkcache_item = bucket->item[slot]) == NULL)
+                    continue;
                 if (__blkcache_should_evict(session, blkcache_item, &reason)) {
-                    TAILQ_REMOVE(&blkcache->hash[i], blkcache_item, hashq);
-                    __blkcache_free(session, blkcache_item->data);
-                    __blkcache_update_ref_histogram(
-                      session, blkcache_item, WT_BLKCACHE_RM_EVICTION);
-                    (void)__wt_atomic_sub64(&blkcache->bytes_used, blkcache_item->data_size);
-
-                    /*
-                     * Update the number of removals because it is used to estimate the overhead,
-                     * and we want the overhead contributed by eviction to be part of that
-                     * calculation.
-                     */
-                    blkcache->removals++;
-
-                    WT_STAT_CONN_INCR(session, block_cache_blocks_evicted);
-                    WT_STAT_CONN_DECRV(session, block_cache_bytes, blkcache_item->data_size);
-                    WT_STAT_CONN_DECR(session, block_cache_blocks);
-                    __wt_free(session, blkcache_item);
+                    bucket->item[slot] = NULL;
+                    evict[nevict++] = blkcache_item;
                 } else {
                     blkcache_item->freq_rec_counter--;
                     if (reason != WT_BLKCACHE_NOT_EVICTION_CANDIDATE)
                         no_eviction_candidates = false;
                 }
             }
-            __wt_spin_unlock(session, &blkcache->hash_locks[i]);
+            __blkcache_bucket_modify_end(bucket);
+            __wt_spin_unlock(session, &bucket->lock);
+
+            for (slot = 0; slot < nevict; slot++) {
+                WT_STAT_CONN_DECRV(session, block_cache_bytes, evict[slot]->data_size);
+                __blkcache_item_discard(session, evict[slot], WT_BLKCACHE_RM_EVICTION);
+
+                /*
+                 * Update the number of removals because it is used to estimate the overhead, and
+                 * we want the overhead contributed by eviction to be part of that calculation.
+                 */
+                blkcache->removals++;
+
+                WT_STAT_CONN_INCR(session, block_cache_blocks_evicted);
+                WT_STAT_CONN_DECR(session, block_cache_blocks);
+            }
             if (blkcache->blkcache_exiting)
                 return (WT_THREAD_RET_VALUE);
         }
@@ -325,7 +614,8 @@ __wt_blkcache_get(WT_SESSION_IMPL *session, const uint8_t *addr, size_t addr_siz
 {
     WT_BLKCACHE *blkcache;
     WT_BLKCACHE_ITEM *blkcache_item;
-    uint64_t bucket, hash;
+    uint64_t bucket1, bucket2, hash;
+    uint32_t fid;
 
     *foundp = *skip_cache_putp = false;
     *blkcache_retp = NULL;
@@ -335,12 +625,11 @@ __wt_blkcache_get(WT_SESSION_IMPL *session, const uint8_t *addr, size_t addr_siz
     WT_STAT_CONN_INCR(session, block_cache_lookups);
 
     /*
-     * In an NVRAM cache, we track lookups to calculate the overhead of using the cache. We race to
-     * avoid using synchronization. We only care about an approximate value, so we accept inaccuracy
-     * for the sake of avoiding synchronization on the critical path.
+     * We track lookups to calculate the hit ratio and, in an NVRAM cache, the overhead of using the
+     * cache. We race to avoid using synchronization. We only care about an approximate value, so we
+     * accept inaccuracy for the sake of avoiding synchronization on the critical path.
      */
-    if (blkcache->type == WT_BLKCACHE_NVRAM)
-        blkcache->lookups++;
+    blkcache->lookups++;
 
     /*
      * An NVRAM cache is slower than retrieving the block from the OS buffer cache, a DRAM cache is
@@ -356,24 +645,26 @@ __wt_blkcache_get(WT_SESSION_IMPL *session, const uint8_t *addr, size_t addr_siz
     }
 
     hash = __wt_hash_city64(addr, addr_size);
-    bucket = hash % blkcache->hash_size;
-    __wt_spin_lock(session, &blkcache->hash_locks[bucket]);
-    TAILQ_FOREACH (blkcache_item, &blkcache->hash[bucket], hashq) {
-        if (blkcache_item->addr_size == addr_size && blkcache_item->fid == S2BT(session)->id &&
-          memcmp(blkcache_item->addr, addr, addr_size) == 0) {
-            blkcache_item->num_references++;
-            if (blkcache_item->freq_rec_counter < 0)
-                blkcache_item->freq_rec_counter = 0;
-            blkcache_item->freq_rec_counter++;
-            (void)__wt_atomic_addv32(&blkcache_item->ref_count, 1);
-            break;
-        }
-    }
-    __wt_spin_unlock(session, &blkcache->hash_locks[bucket]);
+    fid = S2BT(session)->id;
+    if (blkcache->admission == WT_BLKCACHE_ADMIT_TINYLFU)
+        __blkcache_sketch_increment(session, __blkcache_sketch_key(hash, fid));
+
+    __blkcache_buckets(blkcache, hash, &bucket1, &bucket2);
+    if ((blkcache_item = __blkcache_bucket_search(
+           &blkcache->buckets[bucket1], hash, fid, addr, addr_size)) == NULL)
+        blkcache_item =
+          __blkcache_bucket_search(&blkcache->buckets[bucket2], hash, fid, addr, addr_size);
 
     if (blkcache_item != NULL) {
+        /* The counters guiding eviction are heuristics, update them without synchronization. */
+        blkcache_item->num_references++;
+        if (blkcache_item->freq_rec_counter < 0)
+            blkcache_item->freq_rec_counter = 0;
+        blkcache_item->freq_rec_counter++;
+
         *blkcache_retp = blkcache_item;
         *foundp = *skip_cache_putp = true;
+        blkcache->hits++;
         WT_STAT_CONN_INCR(session, block_cache_hits);
         __blkcache_verbose(
           session, WT_VERBOSE_DEBUG_2, "block found in cache", hash, addr, addr_size);
@@ -384,6 +675,169 @@ __wt_blkcache_get(WT_SESSION_IMPL *session, const uint8_t *addr, size_t addr_siz
     }
 }
 
+/*
+ * __wt_blkcache_decompress --
+ *     Decompress a block stored compressed in the cache into a buffer, returning if the block is
+ *     read often enough it's worth storing uncompressed. The caller holds a pin on the block.
+ */
+int
+__wt_blkcache_decompress(
+  WT_SESSION_IMPL *session, WT_BLKCACHE_ITEM *blkcache_item, WT_ITEM *buf, bool *promotep)
+{
+    WT_BLKCACHE *blkcache;
+    WT_COMPRESSOR *compressor;
+    size_t result_len;
+    uint64_t time_start, time_stop;
+
+    *promotep = false;
+
+    blkcache = &S2C(session)->blkcache;
+    compressor = blkcache->compressor;
+
+    WT_RET(__wt_buf_initsize(session, buf, blkcache_item->mem_size));
+    time_start = __wt_clock(session);
+    WT_RET(compressor->decompress(compressor, &session->iface, blkcache_item->data,
+      blkcache_item->data_size, buf->mem, blkcache_item->mem_size, &result_len));
+    time_stop = __wt_clock(session);
+    if (result_len != blkcache_item->mem_size)
+        WT_RET_MSG(session, WT_ERROR,
+          "block cache decompression returned %" WT_SIZET_FMT " bytes, expected %" PRIu32,
+          result_len, blkcache_item->mem_size);
+    WT_STAT_CONN_INCRV(
+      session, block_cache_decompress_time, WT_CLOCKDIFF_US(time_stop, time_start));
+
+    /* Hot blocks are worth the memory of an uncompressed copy, if the cache has room for it. */
+    if (blkcache->promote_references != 0 &&
+      blkcache_item->num_references >= blkcache->promote_references &&
+      blkcache->bytes_used + blkcache_item->mem_size < blkcache->full_target)
+        *promotep = true;
+    return (0);
+}
+
+/*
+ * __wt_blkcache_promote --
+ *     Replace a block stored compressed in the cache with its uncompressed image.
+ */
+int
+__wt_blkcache_promote(
+  WT_SESSION_IMPL *session, const uint8_t *addr, size_t addr_size, WT_ITEM *image)
+{
+    WT_BLKCACHE *blkcache;
+    WT_BLKCACHE_BUCKET *bucket;
+    WT_BLKCACHE_ITEM *blkcache_item, *blkcache_store;
+    WT_DECL_RET;
+    uint64_t b[2], hash, sleep_usecs, yield_count;
+    uint32_t fid;
+    u_int i, slot;
+    void *data_ptr;
+
+    blkcache = &S2C(session)->blkcache;
+    blkcache_store = NULL;
+
+    WT_RET(__blkcache_alloc(session, image->size, &data_ptr));
+    if (data_ptr == NULL)
+        return (0);
+    memcpy(data_ptr, image->data, image->size);
+    WT_ERR(__blkcache_item_alloc(session, &blkcache_store));
+
+    fid = S2BT(session)->id;
+    blkcache_store->data = data_ptr;
+    blkcache_store->data_size = WT_STORE_SIZE(image->size);
+    blkcache_store->mem_size = 0;
+    blkcache_store->fid = fid;
+    blkcache_store->addr_size = (uint8_t)addr_size;
+    memcpy(blkcache_store->addr, addr, addr_size);
+
+    hash = __wt_hash_city64(addr, addr_size);
+    __blkcache_buckets(blkcache, hash, &b[0], &b[1]);
+    for (i = 0; i < 2; i++) {
+        bucket = &blkcache->buckets[b[i]];
+        __wt_spin_lock(session, &bucket->lock);
+        for (slot = 0; slot < WT_BLKCACHE_BUCKET_SLOTS; slot++) {
+            if (bucket->hash[slot] != hash || (blkcache_item = bucket->item[slot]) == NULL ||
+              !__blkcache_item_match(blkcache_item, fid, addr, addr_size))
+                continue;
+
+            /* Another reader may have promoted the block first. */
+            if (blkcache_item->mem_size == 0 || blkcache_item->mem_size != image->size) {
+                __wt_spin_unlock(session, &bucket->lock);
+                goto err;
+            }
+
+            /* The uncompressed block inherits the eviction state of the compressed block. */
+            blkcache_store->num_references = blkcache_item->num_references;
+            blkcache_store->freq_rec_counter = blkcache_item->freq_rec_counter;
+            __blkcache_bucket_modify_begin(bucket);
+            bucket->item[slot] = blkcache_store;
+            __blkcache_bucket_modify_end(bucket);
+            __wt_spin_unlock(session, &bucket->lock);
+
+            (void)__wt_atomic_add64(&blkcache->bytes_used, image->size);
+            (void)__wt_atomic_add64(&blkcache->bytes_logical, image->size);
+            WT_STAT_CONN_INCRV(session, block_cache_bytes, image->size - blkcache_item->data_size);
+            WT_STAT_CONN_INCR(session, block_cache_blocks_promoted);
+
+            /* Readers of the compressed block may still hold pins, wait for them to finish. */
+            sleep_usecs = yield_count = 0;
+            while (blkcache_item->ref_count != 0)
+                __wt_spin_backoff(&yield_count, &sleep_usecs);
+            (void)__wt_atomic_sub64(&blkcache->bytes_used, blkcache_item->data_size);
+            (void)__wt_atomic_sub64(&blkcache->bytes_logical, blkcache_item->mem_size);
+            __blkcache_free(session, blkcache_item->data);
+            blkcache_item->data = NULL;
+            __blkcache_item_free(session, blkcache_item);
+            __blkcache_verbose(
+              session, WT_VERBOSE_DEBUG_1, "block promoted to uncompressed", hash, addr, addr_size);
+            return (0);
+        }
+        __wt_spin_unlock(session, &bucket->lock);
+    }
+
+err:
+    __blkcache_free(session, data_ptr);
+    if (blkcache_store != NULL)
+        __blkcache_item_free(session, blkcache_store);
+    return (ret);
+}
+
+/*
+ * __blkcache_compress --
+ *     Compress a block for the cache, returning if the compressed copy is worth keeping.
+ */
+static int
+__blkcache_compress(WT_SESSION_IMPL *session, WT_ITEM *src, WT_ITEM *dst, bool *compressedp)
+{
+    WT_COMPRESSOR *compressor;
+    size_t len, result_len;
+    int compression_failed;
+
+    *compressedp = false;
+
+    compressor = S2C(session)->blkcache.compressor;
+
+    /* Some compression engines need more memory than the source, ask them. */
+    if (compressor->pre_size == NULL)
+        len = src->size;
+    else
+        WT_RET(compressor->pre_size(
+          compressor, &session->iface, (uint8_t *)src->data, src->size, &len));
+    WT_RET(__wt_buf_init(session, dst, len));
+
+    compression_failed = 0;
+    WT_RET(compressor->compress(compressor, &session->iface, (uint8_t *)src->data, src->size,
+      dst->mem, len, &result_len, &compression_failed));
+
+    /*
+     * Decompressing costs time on every hit, only keep the compressed copy if it saves at least an
+     * eighth of the block.
+     */
+    if (compression_failed || result_len > src->size - src->size / 8)
+        return (0);
+    dst->size = result_len;
+    *compressedp = true;
+    return (0);
+}
+
 /*
  * __wt_blkcache_put --
  *     Put a block into the cache.
@@ -393,18 +847,29 @@ __wt_blkcache_put(
   WT_SESSION_IMPL *session, WT_ITEM *data, const uint8_t *addr, size_t addr_size, bool write)
 {
     WT_BLKCACHE *blkcache;
-    WT_BLKCACHE_ITEM *blkcache_item, *blkcache_store;
+    WT_BLKCACHE_BUCKET *bucket, *bucket1, *bucket2, *free_bucket, *victim_bucket;
+    WT_BLKCACHE_ITEM *blkcache_item, *blkcache_store, *victim;
+    WT_DECL_ITEM(tmp);
     WT_DECL_RET;
-    uint64_t bucket, hash;
+    WT_ITEM *store;
+    uint64_t b1, b2, hash;
+    uint32_t fid;
+    u_int free_slot, i, slot, victim_slot;
     void *data_ptr;
+    bool compressed;
 
     blkcache = &S2C(session)->blkcache;
     blkcache_store = NULL;
+    data_ptr = NULL;
 
     /* Are we within cache size limits? */
     if (blkcache->bytes_used > blkcache->max_bytes)
         return (0);
 
+    /* Address cookies are stored in the item, block manager cookies are always small enough. */
+    if (addr_size > WT_BLKCACHE_ADDR_MAX)
+        return (0);
+
     /*
      * An NVRAM cache is slower than retrieving the block from the OS buffer cache, a DRAM cache is
      * faster than the OS buffer cache. In the case of NVRAM, if more than the configured fraction
@@ -423,25 +888,50 @@ __wt_blkcache_put(
         return (0);
     }
 
+    /* With a compressor configured, store the block compressed if that saves space. */
+    store = data;
+    if (blkcache->compressor != NULL) {
+        WT_RET(__wt_scr_alloc(session, 0, &tmp));
+        WT_ERR(__blkcache_compress(session, data, tmp, &compressed));
+        if (compressed)
+            store = tmp;
+    }
+
     /*
      * Allocate and initialize space in the cache outside of the critical section. In the unlikely
      * event that we fail an allocation, free the space. NVRAM allocations can fail if there's no
      * available memory, treat it as a cache-full failure.
      */
-    WT_RET(__blkcache_alloc(session, data->size, &data_ptr));
+    WT_ERR(__blkcache_alloc(session, store->size, &data_ptr));
     if (data_ptr == NULL)
-        return (0);
-    WT_ERR(__wt_calloc(session, 1, sizeof(*blkcache_store) + addr_size, &blkcache_store));
+        goto err;
+    memcpy(data_ptr, store->data, store->size);
+    WT_ERR(__blkcache_item_alloc(session, &blkcache_store));
+
+    /*
+     * Don't reset the item's reference count: it's zero, unless a reader that raced with the item's
+     * previous removal still briefly holds a pin it's about to release.
+     *
+     * Set the recency timestamp on newly inserted blocks to the maximum value to reduce the chance
+     * of them being evicted before they are reused.
+     */
+    fid = S2BT(session)->id;
     blkcache_store->data = data_ptr;
-    blkcache_store->data_size = WT_STORE_SIZE(data->size);
-    memcpy(blkcache_store->data, data->data, data->size);
-    blkcache_store->fid = S2BT(session)->id;
+    blkcache_store->data_size = WT_STORE_SIZE(store->size);
+    blkcache_store->mem_size = store == data ? 0 : WT_STORE_SIZE(data->size);
+    blkcache_store->num_references = 0;
+    blkcache_store->freq_rec_counter = 1;
+    blkcache_store->fid = fid;
     blkcache_store->addr_size = (uint8_t)addr_size;
     memcpy(blkcache_store->addr, addr, addr_size);
 
+    /* Lock both of the block's buckets, in bucket order to avoid deadlocks. */
     hash = __wt_hash_city64(addr, addr_size);
-    bucket = hash % blkcache->hash_size;
-    __wt_spin_lock(session, &blkcache->hash_locks[bucket]);
+    __blkcache_buckets(blkcache, hash, &b1, &b2);
+    bucket1 = &blkcache->buckets[WT_MIN(b1, b2)];
+    bucket2 = &blkcache->buckets[WT_MAX(b1, b2)];
+    __wt_spin_lock(session, &bucket1->lock);
+    __wt_spin_lock(session, &bucket2->lock);
 
     /*
      * In the case of a read, check if the block is already in the cache: it's possible because two
@@ -456,34 +946,108 @@ __wt_blkcache_put(
 #if !defined(HAVE_DIAGNOSTIC)
     if (!write)
 #endif
-        TAILQ_FOREACH (blkcache_item, &blkcache->hash[bucket], hashq)
-            if (blkcache_item->addr_size == addr_size && blkcache_item->fid == S2BT(session)->id &&
-              memcmp(blkcache_item->addr, addr, addr_size) == 0) {
-                __wt_spin_unlock(session, &blkcache->hash_locks[bucket]);
-                WT_ASSERT(session, !write);
-
-                WT_STAT_CONN_INCRV(session, block_cache_bytes_update, data->size);
-                WT_STAT_CONN_INCR(session, block_cache_blocks_update);
-                __blkcache_verbose(
-                  session, WT_VERBOSE_DEBUG_2, "block already in cache", hash, addr, addr_size);
-                goto err;
+        if (__blkcache_bucket_find(bucket1, hash, fid, addr, addr_size) ||
+          __blkcache_bucket_find(bucket2, hash, fid, addr, addr_size)) {
+            __wt_spin_unlock(session, &bucket2->lock);
+            __wt_spin_unlock(session, &bucket1->lock);
+            WT_ASSERT(session, !write);
+
+            WT_STAT_CONN_INCRV(session, block_cache_bytes_update, data->size);
+            WT_STAT_CONN_INCR(session, block_cache_blocks_update);
+            __blkcache_verbose(
+              session, WT_VERBOSE_DEBUG_2, "block already in cache", hash, addr, addr_size);
+            goto err;
+        }
+
+    /* Find a free slot, and the unpinned block eviction would choose first, in either bucket. */
+    free_bucket = victim_bucket = NULL;
+    victim = NULL;
+    free_slot = victim_slot = 0;
+    for (i = 0; i < 2; i++) {
+        bucket = i == 0 ? bucket1 : bucket2;
+        for (slot = 0; slot < WT_BLKCACHE_BUCKET_SLOTS; slot++)
+            if ((blkcache_item = bucket->item[slot]) == NULL) {
+                if (free_bucket == NULL) {
+                    free_bucket = bucket;
+                    free_slot = slot;
+                }
+            } else if (blkcache_item->ref_count == 0 &&
+              (victim == NULL || blkcache_item->freq_rec_counter < victim->freq_rec_counter)) {
+                victim = blkcache_item;
+                victim_bucket = bucket;
+                victim_slot = slot;
             }
+    }
 
     /*
-     * Set the recency timestamp on newly inserted blocks to the maximum value to reduce the chance
-     * of them being evicted before they are reused.
+     * Blocks written by the application are cached by configuration, only blocks read from disk go
+     * through the admission filter. The filter is consulted once the cache is full, or when there's
+     * no free slot for the block and it would have to displace another block.
      */
-    blkcache_store->freq_rec_counter = 1;
+    if (!write && blkcache->admission == WT_BLKCACHE_ADMIT_TINYLFU &&
+      (free_bucket == NULL ||
+        __wt_atomic_load64(&blkcache->bytes_used) >= blkcache->full_target) &&
+      !__blkcache_admit(session, __blkcache_sketch_key(hash, fid), victim,
+        victim == NULL ? 0 : victim_bucket->hash[victim_slot])) {
+        __wt_spin_unlock(session, &bucket2->lock);
+        __wt_spin_unlock(session, &bucket1->lock);
+        WT_STAT_CONN_INCR(session, block_cache_admission_rejected);
+        __blkcache_verbose(
+          session, WT_VERBOSE_DEBUG_2, "block rejected by admission filter", hash, addr, addr_size);
+        goto err;
+    }
 
-    TAILQ_INSERT_HEAD(&blkcache->hash[bucket], blkcache_store, hashq);
+    /*
+     * If both buckets are full, the block replaces the victim if the admission filter chose it over
+     * the victim. Otherwise, don't cache the block.
+     */
+    if (free_bucket != NULL)
+        victim = NULL;
+    else if (write || blkcache->admission != WT_BLKCACHE_ADMIT_TINYLFU || victim == NULL) {
+        __wt_spin_unlock(session, &bucket2->lock);
+        __wt_spin_unlock(session, &bucket1->lock);
+        WT_STAT_CONN_INCR(session, block_cache_bypass_bucket_full);
+        goto err;
+    } else {
+        free_bucket = victim_bucket;
+        free_slot = victim_slot;
+    }
+
+    __blkcache_bucket_modify_begin(free_bucket);
 
-    (void)__wt_atomic_add64(&blkcache->bytes_used, data->size);
+    /* Readers don't lock the bucket, check the victim wasn't pinned before we marked the bucket. */
+    if (victim != NULL && victim->ref_count != 0) {
+        __blkcache_bucket_modify_end(free_bucket);
+        __wt_spin_unlock(session, &bucket2->lock);
+        __wt_spin_unlock(session, &bucket1->lock);
+        WT_STAT_CONN_INCR(session, block_cache_bypass_bucket_full);
+        goto err;
+    }
+    free_bucket->hash[free_slot] = hash;
+    free_bucket->item[free_slot] = blkcache_store;
+    __blkcache_bucket_modify_end(free_bucket);
+
+    (void)__wt_atomic_add64(&blkcache->bytes_used, store->size);
+    (void)__wt_atomic_add64(&blkcache->bytes_logical, data->size);
     blkcache->inserts++;
 
-    __wt_spin_unlock(session, &blkcache->hash_locks[bucket]);
+    __wt_spin_unlock(session, &bucket2->lock);
+    __wt_spin_unlock(session, &bucket1->lock);
 
-    WT_STAT_CONN_INCRV(session, block_cache_bytes, data->size);
+    if (victim != NULL) {
+        WT_STAT_CONN_DECRV(session, block_cache_bytes, victim->data_size);
+        __blkcache_item_discard(session, victim, WT_BLKCACHE_RM_EVICTION);
+        blkcache->removals++;
+        WT_STAT_CONN_INCR(session, block_cache_blocks_evicted);
+        WT_STAT_CONN_DECR(session, block_cache_blocks);
+    }
+
+    WT_STAT_CONN_INCRV(session, block_cache_bytes, store->size);
     WT_STAT_CONN_INCR(session, block_cache_blocks);
+    if (store != data)
+        WT_STAT_CONN_INCR(session, block_cache_blocks_compressed);
+    if (blkcache->admission == WT_BLKCACHE_ADMIT_TINYLFU && !write)
+        WT_STAT_CONN_INCR(session, block_cache_admission_admitted);
     if (write) {
         WT_STAT_CONN_INCRV(session, block_cache_bytes_insert_write, data->size);
         WT_STAT_CONN_INCR(session, block_cache_blocks_insert_write);
@@ -494,11 +1058,14 @@ __wt_blkcache_put(
 
     __blkcache_verbose(
       session, WT_VERBOSE_DEBUG_1, "block inserted in cache", hash, addr, addr_size);
+    __wt_scr_free(session, &tmp);
     return (0);
 
 err:
     __blkcache_free(session, data_ptr);
-    __blkcache_free(session, blkcache_store);
+    if (blkcache_store != NULL)
+        __blkcache_item_free(session, blkcache_store);
+    __wt_scr_free(session, &tmp);
     return (ret);
 }
 
@@ -510,22 +1077,30 @@ void
 __wt_blkcache_remove(WT_SESSION_IMPL *session, const uint8_t *addr, size_t addr_size)
 {
     WT_BLKCACHE *blkcache;
+    WT_BLKCACHE_BUCKET *bucket;
     WT_BLKCACHE_ITEM *blkcache_item;
-    uint64_t bucket, hash, sleep_usecs, total_usecs, yield_count;
+    uint64_t b[2], hash, sleep_usecs, total_usecs, yield_count;
+    uint32_t fid;
+    u_int i, slot;
 
     blkcache = &S2C(session)->blkcache;
     hash = __wt_hash_city64(addr, addr_size);
-    bucket = hash % blkcache->hash_size;
+    fid = S2BT(session)->id;
+    __blkcache_buckets(blkcache, hash, &b[0], &b[1]);
     sleep_usecs = total_usecs = yield_count = 0;
 
-    __wt_spin_lock(session, &blkcache->hash_locks[bucket]);
-    TAILQ_FOREACH (blkcache_item, &blkcache->hash[bucket], hashq) {
-        if (blkcache_item->addr_size == addr_size && blkcache_item->fid == S2BT(session)->id &&
-          memcmp(blkcache_item->addr, addr, addr_size) == 0) {
-            TAILQ_REMOVE(&blkcache->hash[bucket], blkcache_item, hashq);
-            __blkcache_update_ref_histogram(session, blkcache_item, WT_BLKCACHE_RM_FREE);
-            __wt_spin_unlock(session, &blkcache->hash_locks[bucket]);
-            (void)__wt_atomic_sub64(&blkcache->bytes_used, blkcache_item->data_size);
+    for (i = 0; i < 2; i++) {
+        bucket = &blkcache->buckets[b[i]];
+        __wt_spin_lock(session, &bucket->lock);
+        for (slot = 0; slot < WT_BLKCACHE_BUCKET_SLOTS; slot++) {
+            if (bucket->hash[slot] != hash || (blkcache_item = bucket->item[slot]) == NULL ||
+              !__blkcache_item_match(blkcache_item, fid, addr, addr_size))
+                continue;
+
+            __blkcache_bucket_modify_begin(bucket);
+            bucket->item[slot] = NULL;
+            __blkcache_bucket_modify_end(bucket);
+            __wt_spin_unlock(session, &bucket->lock);
             WT_STAT_CONN_DECRV(session, block_cache_bytes, blkcache_item->data_size);
             /*
              * The block might be in use by another thread, wait for it to be released before
@@ -536,8 +1111,7 @@ __wt_blkcache_remove(WT_SESSION_IMPL *session, const uint8_t *addr, size_t addr_
                 total_usecs += sleep_usecs;
             }
             WT_STAT_CONN_INCRV(session, block_cache_blocks_removed_blocked, total_usecs);
-            __blkcache_free(session, blkcache_item->data);
-            __wt_overwrite_and_free(session, blkcache_item);
+            __blkcache_item_discard(session, blkcache_item, WT_BLKCACHE_RM_FREE);
             blkcache->removals++;
             WT_STAT_CONN_INCR(session, block_cache_blocks_removed);
             WT_STAT_CONN_DECR(session, block_cache_blocks);
@@ -545,8 +1119,8 @@ __wt_blkcache_remove(WT_SESSION_IMPL *session, const uint8_t *addr, size_t addr_
               session, WT_VERBOSE_DEBUG_1, "block removed from cache", hash, addr, addr_size);
             return;
         }
+        __wt_spin_unlock(session, &bucket->lock);
     }
-    __wt_spin_unlock(session, &blkcache->hash_locks[bucket]);
 }
 
 /*
@@ -556,11 +1130,12 @@ __wt_blkcache_remove(WT_SESSION_IMPL *session, const uint8_t *addr, size_t addr_
 static int
 __blkcache_init(WT_SESSION_IMPL *session, size_t cache_size, u_int hash_size, u_int type,
   char *nvram_device_path, size_t system_ram, u_int percent_file_in_os_cache, bool cache_on_writes,
-  u_int overhead_pct, u_int evict_aggressive, uint64_t full_target, bool cache_on_checkpoint)
+  u_int overhead_pct, u_int evict_aggressive, uint64_t full_target, bool cache_on_checkpoint,
+  u_int admission, char *compressor_name, u_int promote_references)
 {
     WT_BLKCACHE *blkcache;
     WT_DECL_RET;
-    uint64_t i;
+    uint64_t i, target, width;
 
     blkcache = &S2C(session)->blkcache;
     blkcache->cache_on_checkpoint = cache_on_checkpoint;
@@ -572,6 +1147,10 @@ __blkcache_init(WT_SESSION_IMPL *session, size_t cache_size, u_int hash_size, u_
     blkcache->overhead_pct = overhead_pct;
     blkcache->system_ram = system_ram;
 
+    /* Compressors are extensions, the compressor is looked up once they're loaded. */
+    blkcache->compressor_name = compressor_name;
+    blkcache->promote_references = promote_references;
+
     if (type == WT_BLKCACHE_NVRAM) {
 #ifdef ENABLE_MEMKIND
         if ((ret = memkind_create_pmem(nvram_device_path, 0, &blkcache->pmem_kind)) != 0)
@@ -586,12 +1165,30 @@ __blkcache_init(WT_SESSION_IMPL *session, size_t cache_size, u_int hash_size, u_
 #endif
     }
 
-    WT_RET(__wt_calloc_def(session, blkcache->hash_size, &blkcache->hash));
-    WT_RET(__wt_calloc_def(session, blkcache->hash_size, &blkcache->hash_locks));
+    /*
+     * Buckets hold a fixed number of blocks, make sure there are enough of them for a cache full of
+     * small blocks.
+     */
+    blkcache->bucket_count = WT_MAX(
+      hash_size, cache_size / (WT_BLKCACHE_BUCKET_SLOTS * WT_BLKCACHE_BUCKET_BLOCK_SIZE));
+    WT_RET(__wt_calloc_def(session, blkcache->bucket_count, &blkcache->buckets));
+    for (i = 0; i < blkcache->bucket_count; i++)
+        WT_RET(__wt_spin_init(session, &blkcache->buckets[i].lock, "block cache bucket locks"));
+    WT_RET(__wt_spin_init(session, &blkcache->slab_lock, "block cache slabs"));
 
-    for (i = 0; i < blkcache->hash_size; i++) {
-        TAILQ_INIT(&blkcache->hash[i]); /* Block cache hash lists */
-        WT_RET(__wt_spin_init(session, &blkcache->hash_locks[i], "block cache bucket locks"));
+    /*
+     * Size the admission sketch to have a counter per row for each block the cache could hold,
+     * rounded up to a power-of-two so the row index is a mask.
+     */
+    blkcache->admission = admission;
+    if (admission == WT_BLKCACHE_ADMIT_TINYLFU) {
+        target = cache_size / WT_BLKCACHE_SKETCH_BLOCK_SIZE;
+        for (width = WT_BLKCACHE_SKETCH_WIDTH_MIN;
+             width < target && width < WT_BLKCACHE_SKETCH_WIDTH_MAX; width <<= 1)
+            ;
+        WT_RET(__wt_calloc_def(session, WT_BLKCACHE_SKETCH_DEPTH * width, &blkcache->sketch));
+        blkcache->sketch_mask = width - 1;
+        blkcache->sketch_sample = WT_BLKCACHE_SKETCH_SAMPLE * width;
     }
 
     /* Create the eviction thread */
@@ -620,9 +1217,12 @@ void
 __wt_blkcache_destroy(WT_SESSION_IMPL *session)
 {
     WT_BLKCACHE *blkcache;
+    WT_BLKCACHE_BUCKET *bucket;
     WT_BLKCACHE_ITEM *blkcache_item;
+    WT_BLKCACHE_SLAB *slab;
     WT_DECL_RET;
     uint64_t i;
+    u_int slot;
 
     blkcache = &S2C(session)->blkcache;
 
@@ -636,11 +1236,12 @@ __wt_blkcache_destroy(WT_SESSION_IMPL *session)
     WT_TRET(__wt_thread_join(session, &blkcache->evict_thread_tid));
     __wt_verbose(session, WT_VERB_BLKCACHE, "%s", "block cache eviction thread exited");
 
-    for (i = 0; i < blkcache->hash_size; i++) {
-        __wt_spin_lock(session, &blkcache->hash_locks[i]);
-        while (!TAILQ_EMPTY(&blkcache->hash[i])) {
-            blkcache_item = TAILQ_FIRST(&blkcache->hash[i]);
-            TAILQ_REMOVE(&blkcache->hash[i], blkcache_item, hashq);
+    for (i = 0; i < blkcache->bucket_count; i++) {
+        bucket = &blkcache->buckets[i];
+        for (slot = 0; slot < WT_BLKCACHE_BUCKET_SLOTS; slot++) {
+            if ((blkcache_item = bucket->item[slot]) == NULL)
+                continue;
+            bucket->item[slot] = NULL;
 
             /* Assert we never left a block pinned. */
             if (blkcache_item->ref_count != 0)
@@ -652,15 +1253,18 @@ __wt_blkcache_destroy(WT_SESSION_IMPL *session)
              * Some workloads crash on freeing NVRAM arenas. If that occurs the call to free can be
              * removed and the library/OS will clean up for us once the process exits.
              */
-            __blkcache_free(session, blkcache_item->data);
-            __blkcache_update_ref_histogram(session, blkcache_item, WT_BLKCACHE_RM_EXIT);
-            (void)__wt_atomic_sub64(&blkcache->bytes_used, blkcache_item->data_size);
-            __wt_free(session, blkcache_item);
+            __blkcache_item_discard(session, blkcache_item, WT_BLKCACHE_RM_EXIT);
         }
-        __wt_spin_unlock(session, &blkcache->hash_locks[i]);
+        __wt_spin_destroy(session, &bucket->lock);
     }
     WT_ASSERT(session, blkcache->bytes_used == 0);
 
+    while ((slab = blkcache->slabs) != NULL) {
+        blkcache->slabs = slab->next;
+        __wt_free(session, slab);
+    }
+    __wt_spin_destroy(session, &blkcache->slab_lock);
+
     /* Print reference histograms */
     __blkcache_print_reference_hist(session, "All blocks", blkcache->cache_references);
     __blkcache_print_reference_hist(
@@ -674,14 +1278,44 @@ __wt_blkcache_destroy(WT_SESSION_IMPL *session)
         __wt_free(session, blkcache->nvram_device_path);
     }
 #endif
-    __wt_free(session, blkcache->hash);
-    __wt_free(session, blkcache->hash_locks);
+    __wt_free(session, blkcache->buckets);
+    __wt_free(session, blkcache->sketch);
+    __wt_free(session, blkcache->compressor_name);
     /*
      * Zeroing the structure has the effect of setting the block cache type to unconfigured.
      */
     memset((void *)blkcache, 0, sizeof(WT_BLKCACHE));
 }
 
+/*
+ * __wt_blkcache_stats_update --
+ *     Update the block cache statistics for return to the application.
+ */
+void
+__wt_blkcache_stats_update(WT_SESSION_IMPL *session)
+{
+    WT_BLKCACHE *blkcache;
+    WT_CONNECTION_STATS **stats;
+    uint64_t bytes_logical, bytes_used, hits, lookups;
+
+    blkcache = &S2C(session)->blkcache;
+    stats = S2C(session)->stats;
+    if (blkcache->type == WT_BLKCACHE_UNCONFIGURED)
+        return;
+
+    /* The counters are updated without synchronization, be paranoid about the ratio. */
+    hits = blkcache->hits;
+    lookups = blkcache->lookups;
+    WT_STATP_CONN_SET(session, stats, block_cache_hit_ratio,
+      lookups == 0 ? 0 : WT_MIN(hits, lookups) * 100 / lookups);
+
+    /* The effective capacity multiplier is the ratio of the uncompressed bytes to bytes used. */
+    bytes_logical = blkcache->bytes_logical;
+    bytes_used = blkcache->bytes_used;
+    WT_STATP_CONN_SET(session, stats, block_cache_capacity_multiplier,
+      bytes_used == 0 ? 100 : bytes_logical * 100 / bytes_used);
+}
+
 /*
  * __blkcache_reconfig --
  *     We currently disallow reconfiguration. If and when we do, this function will destroy the
@@ -691,7 +1325,7 @@ static int
 __blkcache_reconfig(WT_SESSION_IMPL *session, bool reconfig, size_t cache_size, size_t hash_size,
   u_int type, char *nvram_device_path, size_t system_ram, u_int percent_file_in_os_cache,
   bool cache_on_writes, u_int overhead_pct, u_int evict_aggressive, uint64_t full_target,
-  bool cache_on_checkpoint)
+  bool cache_on_checkpoint, u_int admission, const char *compressor_name, u_int promote_references)
 {
     WT_BLKCACHE *blkcache;
 
@@ -706,6 +1340,9 @@ __blkcache_reconfig(WT_SESSION_IMPL *session, bool reconfig, size_t cache_size,
       blkcache->full_target != full_target || blkcache->max_bytes != cache_size ||
       blkcache->overhead_pct != overhead_pct || blkcache->system_ram != system_ram ||
       blkcache->evict_aggressive != -((int)evict_aggressive) || blkcache->type != type ||
+      blkcache->admission != admission || blkcache->promote_references != promote_references ||
+      (compressor_name == NULL) != (blkcache->compressor_name == NULL) ||
+      (compressor_name != NULL && strcmp(compressor_name, blkcache->compressor_name) != 0) ||
       (nvram_device_path != NULL && blkcache->nvram_device_path == NULL) ||
       (nvram_device_path == NULL && blkcache->nvram_device_path != NULL) ||
       (nvram_device_path != NULL && blkcache->nvram_device_path != NULL &&
@@ -729,12 +1366,14 @@ __wt_blkcache_setup(WT_SESSION_IMPL *session, const char *cfg[], bool reconfig)
     WT_CONFIG_ITEM cval;
     WT_DECL_RET;
     uint64_t cache_size, full_target, system_ram;
-    u_int cache_type, evict_aggressive, hash_size, overhead_pct, percent_file_in_os_cache;
-    char *nvram_device_path;
+    u_int admission, cache_type, evict_aggressive, hash_size, overhead_pct,
+      percent_file_in_os_cache, promote_references;
+    char *compressor_name, *nvram_device_path;
     bool cache_on_checkpoint, cache_on_writes;
 
     blkcache = &S2C(session)->blkcache;
     cache_on_checkpoint = cache_on_writes = true;
+    compressor_name = NULL;
     nvram_device_path = (char *)"";
 
     if (blkcache->type != WT_BLKCACHE_UNCONFIGURED && !reconfig)
@@ -801,11 +1440,53 @@ __wt_blkcache_setup(WT_SESSION_IMPL *session, const char *cfg[], bool reconfig)
     WT_RET(__wt_config_gets(session, cfg, "block_cache.max_percent_overhead", &cval));
     overhead_pct = (u_int)cval.val;
 
-    WT_RET(__blkcache_reconfig(session, reconfig, cache_size, hash_size, cache_type,
+    WT_RET(__wt_config_gets(session, cfg, "block_cache.admission", &cval));
+    if (WT_CONFIG_LIT_MATCH("tinylfu", cval))
+        admission = WT_BLKCACHE_ADMIT_TINYLFU;
+    else
+        admission = WT_BLKCACHE_ADMIT_NONE;
+
+    WT_RET(__wt_config_gets(session, cfg, "block_cache.promote_references", &cval));
+    promote_references = (u_int)cval.val;
+
+    WT_RET(__wt_config_gets_none(session, cfg, "block_cache.compressor", &cval));
+    if (cval.len != 0)
+        WT_RET(__wt_strndup(session, cval.str, cval.len, &compressor_name));
+
+    WT_ERR(__blkcache_reconfig(session, reconfig, cache_size, hash_size, cache_type,
       nvram_device_path, system_ram, percent_file_in_os_cache, cache_on_writes, overhead_pct,
-      evict_aggressive, full_target, cache_on_checkpoint));
+      evict_aggressive, full_target, cache_on_checkpoint, admission, compressor_name,
+      promote_references));
+    if (reconfig && blkcache->type != WT_BLKCACHE_UNCONFIGURED)
+        goto err;
 
     return (__blkcache_init(session, cache_size, hash_size, cache_type, nvram_device_path,
       system_ram, percent_file_in_os_cache, cache_on_writes, overhead_pct, evict_aggressive,
-      full_target, cache_on_checkpoint));
+      full_target, cache_on_checkpoint, admission, compressor_name, promote_references));
+
+err:
+    __wt_free(session, compressor_name);
+    return (ret);
+}
+
+/*
+ * __wt_blkcache_compressor_config --
+ *     Look up the block cache compressor, once extensions are loaded.
+ */
+int
+__wt_blkcache_compressor_config(WT_SESSION_IMPL *session, const char *cfg[])
+{
+    WT_BLKCACHE *blkcache;
+    WT_CONFIG_ITEM cval;
+
+    blkcache = &S2C(session)->blkcache;
+    if (blkcache->type == WT_BLKCACHE_UNCONFIGURED || blkcache->compressor_name == NULL)
+        return (0);
+
+    WT_RET(__wt_config_gets_none(session, cfg, "block_cache.compressor", &cval));
+    WT_RET(__wt_compressor_config(session, &cval, &blkcache->compressor));
+    if (blkcache->compressor != NULL && blkcache->compressor->decompress == NULL)
+        WT_RET_MSG(session, EINVAL, "block cache compressor %s does not support decompression",
+          blkcache->compressor_name);
+    return (0);
 }
@@ -20,6 +20,8 @@
 #define WT_CHUNK_OFFSET(chunkcache, offset) \
     (wt_off_t)(((size_t)offset / (chunkcache)->chunk_size) * (chunkcache)->chunk_size)
 
+static void __chunkcache_prefetch_run(WT_SESSION_IMPL *);
+
 /*
  * __chunkcache_bitmap_find_free --
  *     Iterate through the bitmap to find a free chunk in the cache.
@@ -283,6 +285,8 @@ __delete_update_stats(WT_SESSION_IMPL *session, WT_CHUNKCACHE_CHUNK *chunk)
         WT_STAT_CONN_DECR(session, chunkcache_chunks_pinned);
         WT_STAT_CONN_DECRV(session, chunkcache_bytes_inuse_pinned, chunk->chunk_size);
     }
+    if (F_ISSET(chunk, WT_CHUNK_PREFETCHED))
+        WT_STAT_CONN_INCR(session, chunkcache_prefetch_wasted);
 }
 
 /*
@@ -563,7 +567,8 @@ __chunkcache_should_evict(WT_CHUNKCACHE_CHUNK *chunk)
 
 /*
  * __chunkcache_eviction_thread --
- *     Periodically sweep the cache and evict chunks with a zero access count.
+ *     Periodically sweep the cache and evict chunks with a zero access count. Read in chunks queued
+ *     for read-ahead.
  *
  * This strategy is a clock eviction algorithm, which is an approximation of LRU.
  */
@@ -579,10 +584,12 @@ __chunkcache_eviction_thread(void *arg)
     chunkcache = &S2C(session)->chunkcache;
 
     while (!F_ISSET(chunkcache, WT_CHUNK_CACHE_EXITING)) {
+        __chunkcache_prefetch_run(session);
+
         /* Do not evict if we are not close to exceeding capacity. */
         if ((chunkcache->bytes_used + chunkcache->chunk_size) <
           chunkcache->evict_trigger * chunkcache->capacity / 100) {
-            __wt_sleep(1, 0);
+            __wt_cond_wait(session, chunkcache->evict_cond, WT_MILLION, NULL);
             continue;
         }
         for (i = 0; i < (int)chunkcache->hashtable_size; i++) {
@@ -764,6 +771,163 @@ __chunkcache_read_into_chunk(
     return (0);
 }
 
+/*
+ * __chunkcache_prefetch_queue --
+ *     Queue a chunk for read-ahead.
+ */
+static int
+__chunkcache_prefetch_queue(WT_SESSION_IMPL *session, WT_BLOCK *block, const char *object_name,
+  uint32_t objectid, wt_off_t offset)
+{
+    WT_CHUNKCACHE *chunkcache;
+    WT_CHUNKCACHE_PREFETCH_WORK_UNIT *entry;
+    WT_CONNECTION_IMPL *conn;
+    WT_DECL_RET;
+
+    conn = S2C(session);
+    chunkcache = &conn->chunkcache;
+
+    WT_RET(__wt_calloc_one(session, &entry));
+    WT_ERR(__wt_strdup(session, object_name, &entry->name));
+    entry->objectid = objectid;
+    entry->offset = offset;
+
+    /* The object can be closed before the chunk is read, hold a reference to its block handle. */
+    __wt_spin_lock(session, &conn->block_lock);
+    ++block->ref;
+    __wt_spin_unlock(session, &conn->block_lock);
+    entry->block = block;
+
+    __wt_spin_lock(session, &chunkcache->prefetch_lock);
+    TAILQ_INSERT_TAIL(&chunkcache->prefetch_qh, entry, q);
+    ++chunkcache->prefetch_queue_len;
+    WT_STAT_CONN_SET(session, chunkcache_prefetch_queue_depth, chunkcache->prefetch_queue_len);
+    __wt_spin_unlock(session, &chunkcache->prefetch_lock);
+    __wt_cond_signal(session, chunkcache->evict_cond);
+
+    WT_STAT_CONN_INCR(session, chunkcache_prefetch_queued);
+
+    if (0) {
+err:
+        __wt_free(session, entry);
+    }
+    return (ret);
+}
+
+/*
+ * __chunkcache_prefetch_detect --
+ *     Track an object's reads and queue the following chunks once the object is being read
+ *     sequentially.
+ */
+static int
+__chunkcache_prefetch_detect(WT_SESSION_IMPL *session, WT_BLOCK *block, const char *object_name,
+  uint32_t objectid, wt_off_t offset, uint32_t size)
+{
+    WT_CHUNKCACHE *chunkcache;
+    wt_off_t chunk_size, end, first, last, next, prev;
+
+    chunkcache = &S2C(session)->chunkcache;
+    chunk_size = (wt_off_t)chunkcache->chunk_size;
+
+    /*
+     * A read extending past the furthest chunk read continues a sequential run if it starts no
+     * further ahead than the next chunk, or the chunks already read ahead. Pages of a file are
+     * rarely written in perfect key order, so reads a little behind the furthest chunk read leave
+     * the run alone. Anything else starts a new run. Concurrent readers of an object race updating
+     * the run, that only costs accuracy.
+     */
+    first = WT_CHUNK_OFFSET(chunkcache, offset);
+    last = WT_CHUNK_OFFSET(chunkcache, (offset + (wt_off_t)size - 1));
+    prev = block->chunkcache_last;
+    if (first + WT_CHUNKCACHE_PREFETCH_WINDOW * chunk_size < prev ||
+      first > WT_MAX(prev + chunk_size, block->chunkcache_ahead)) {
+        block->chunkcache_seq = 0;
+        block->chunkcache_ahead = 0;
+        block->chunkcache_last = last;
+    } else if (last > prev) {
+        ++block->chunkcache_seq;
+        block->chunkcache_last = last;
+    }
+    if (block->chunkcache_seq < WT_CHUNKCACHE_PREFETCH_TRIGGER)
+        return (0);
+
+    /* Queue the chunks following the furthest chunk read, skipping chunks already queued. */
+    last = block->chunkcache_last;
+    end = WT_MIN(last + (wt_off_t)(chunkcache->prefetch_chunks + 1) * chunk_size, block->size);
+    next = WT_MAX(last + chunk_size, block->chunkcache_ahead);
+    for (; next < end; next += chunk_size) {
+        if (__wt_atomic_load32(&chunkcache->prefetch_queue_len) >=
+          WT_CHUNKCACHE_PREFETCH_QUEUE_MAX)
+            break;
+        WT_RET(__chunkcache_prefetch_queue(session, block, object_name, objectid, next));
+        block->chunkcache_ahead = next + chunk_size;
+    }
+    return (0);
+}
+
+/*
+ * __chunkcache_prefetch_run --
+ *     Read the chunks queued for read-ahead into the cache.
+ */
+static void
+__chunkcache_prefetch_run(WT_SESSION_IMPL *session)
+{
+    WT_BLOCK *block;
+    WT_CHUNKCACHE *chunkcache;
+    WT_CHUNKCACHE_CHUNK *chunk;
+    WT_CHUNKCACHE_HASHID hash_id;
+    WT_CHUNKCACHE_PREFETCH_WORK_UNIT *entry;
+    WT_DECL_RET;
+    uint64_t bucket_id;
+    bool cached;
+
+    chunkcache = &S2C(session)->chunkcache;
+
+    while (!F_ISSET(chunkcache, WT_CHUNK_CACHE_EXITING)) {
+        __wt_spin_lock(session, &chunkcache->prefetch_lock);
+        if ((entry = TAILQ_FIRST(&chunkcache->prefetch_qh)) != NULL) {
+            TAILQ_REMOVE(&chunkcache->prefetch_qh, entry, q);
+            --chunkcache->prefetch_queue_len;
+            WT_STAT_CONN_SET(
+              session, chunkcache_prefetch_queue_depth, chunkcache->prefetch_queue_len);
+        }
+        __wt_spin_unlock(session, &chunkcache->prefetch_lock);
+        if (entry == NULL)
+            break;
+
+        /* Insert the chunk unless it's already cached, or being read by an application thread. */
+        block = entry->block;
+        bucket_id =
+          __chunkcache_tmp_hash(chunkcache, &hash_id, entry->name, entry->objectid, entry->offset);
+        cached = false;
+        __wt_spin_lock(session, WT_BUCKET_LOCK(chunkcache, bucket_id));
+        TAILQ_FOREACH (chunk, WT_BUCKET_CHUNKS(chunkcache, bucket_id), next_chunk)
+            if (__hash_id_eq(&chunk->hash_id, &hash_id)) {
+                cached = true;
+                break;
+            }
+        if (!cached &&
+          (ret = __chunkcache_insert(
+             session, entry->offset, block->size, &hash_id, bucket_id, &chunk)) == 0)
+            F_SET(chunk, WT_CHUNK_PREFETCHED);
+        __wt_spin_unlock(session, WT_BUCKET_LOCK(chunkcache, bucket_id));
+
+        /* Read-ahead is advisory: skip the chunk if the cache is full or the read fails. */
+        if (!cached && ret == 0 &&
+          __chunkcache_read_into_chunk(session, bucket_id, block->fh, chunk) == 0) {
+            WT_STAT_CONN_INCR(session, chunkcache_prefetch_read);
+            __wt_verbose(session, WT_VERB_CHUNKCACHE,
+              "read-ahead: %s(%u), offset=%" PRId64 ", size=%" PRIu64, entry->name,
+              entry->objectid, chunk->chunk_offset, (uint64_t)chunk->chunk_size);
+        }
+        ret = 0;
+
+        WT_IGNORE_RET(__wt_bm_close_block(session, block));
+        __wt_free(session, entry->name);
+        __wt_free(session, entry);
+    }
+}
+
 /*
  * __chunkcache_unpin_old_versions --
  *     Unpin the old versions of newly added chunks so eviction can remove them.
@@ -888,6 +1052,11 @@ retry:
                   (size_t)chunk->chunk_offset + chunk->chunk_size - (size_t)offset;
                 size_copied = WT_MIN(readable_in_chunk, remains_to_read);
 
+                if (F_ISSET(chunk, WT_CHUNK_PREFETCHED)) {
+                    F_CLR(chunk, WT_CHUNK_PREFETCHED);
+                    WT_STAT_CONN_INCR(session, chunkcache_prefetch_hits);
+                }
+
                 /* Accessing this chunk's data is likely to cause a disk read - throttle. */
                 if (F_ISSET(chunk, WT_CHUNK_FROM_METADATA)) {
                     __wt_capacity_throttle(session, size_copied, WT_THROTTLE_CHUNKCACHE);
@@ -937,6 +1106,11 @@ retry:
         }
     }
 
+    /* Read-ahead is advisory, don't fail the read. */
+    if (chunkcache->prefetch_chunks != 0)
+        WT_IGNORE_RET(
+          __chunkcache_prefetch_detect(session, block, object_name, objectid, offset, size));
+
     *cache_hit = true;
     return (0);
 }
@@ -1219,6 +1393,9 @@ __wt_chunkcache_setup(WT_SESSION_IMPL *session, const char *cfg[])
     if ((chunkcache->chunk_size = (uint64_t)cval.val) <= 0)
         chunkcache->chunk_size = WT_CHUNKCACHE_DEFAULT_CHUNKSIZE;
 
+    WT_RET(__wt_config_gets(session, cfg, "chunk_cache.prefetch_chunks", &cval));
+    chunkcache->prefetch_chunks = (u_int)cval.val;
+
     WT_RET(__wt_config_gets(session, cfg, "chunk_cache.hashsize", &cval));
     if ((chunkcache->hashtable_size = (u_int)cval.val) == 0)
         chunkcache->hashtable_size = WT_CHUNKCACHE_DEFAULT_HASHSIZE;
@@ -1280,6 +1457,10 @@ __wt_chunkcache_setup(WT_SESSION_IMPL *session, const char *cfg[])
           session, &chunkcache->hashtable[i].bucket_lock, "chunk cache bucket lock"));
     }
 
+    TAILQ_INIT(&chunkcache->prefetch_qh);
+    WT_ERR(__wt_spin_init(session, &chunkcache->prefetch_lock, "chunk cache read-ahead"));
+    WT_ERR(__wt_cond_alloc(session, "chunk cache thread", &chunkcache->evict_cond));
+
     WT_ERR(__wt_thread_create(
       session, &chunkcache->evict_thread_tid, __chunkcache_eviction_thread, (void *)session));
 
@@ -1302,6 +1483,7 @@ int
 __wt_chunkcache_teardown(WT_SESSION_IMPL *session)
 {
     WT_CHUNKCACHE *chunkcache;
+    WT_CHUNKCACHE_PREFETCH_WORK_UNIT *entry;
     WT_DECL_RET;
 
     chunkcache = &S2C(session)->chunkcache;
@@ -1309,9 +1491,23 @@ __wt_chunkcache_teardown(WT_SESSION_IMPL *session)
     if (!F_ISSET(chunkcache, WT_CHUNKCACHE_CONFIGURED))
         return (0);
 
+    /* Teardown can be called more than once, the condition variable is freed the first time. */
     F_SET(chunkcache, WT_CHUNK_CACHE_EXITING);
+    if (chunkcache->evict_cond != NULL)
+        __wt_cond_signal(session, chunkcache->evict_cond);
     WT_TRET(__wt_thread_join(session, &chunkcache->evict_thread_tid));
 
+    /* Discard chunks still queued for read-ahead, releasing their block handles. */
+    while ((entry = TAILQ_FIRST(&chunkcache->prefetch_qh)) != NULL) {
+        TAILQ_REMOVE(&chunkcache->prefetch_qh, entry, q);
+        WT_TRET(__wt_bm_close_block(session, entry->block));
+        __wt_free(session, entry->name);
+        __wt_free(session, entry);
+    }
+    chunkcache->prefetch_queue_len = 0;
+    __wt_spin_destroy(session, &chunkcache->prefetch_lock);
+    __wt_cond_destroy(session, &chunkcache->evict_cond);
+
     __chunkcache_arr_free(session, &chunkcache->pinned_objects.array);
     __wt_rwlock_destroy(session, &chunkcache->pinned_objects.array_lock);
 
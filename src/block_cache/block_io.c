@@ -57,19 +57,20 @@ __wt_blkcache_read(WT_SESSION_IMPL *session, WT_ITEM *buf, const uint8_t *addr,
     WT_DECL_ITEM(tmp);
     WT_DECL_RET;
     WT_ENCRYPTOR *encryptor;
-    WT_ITEM *ip;
+    WT_ITEM *blkcache_image, *ip;
     const WT_PAGE_HEADER *dsk;
     size_t compression_ratio, result_len;
     uint64_t time_diff, time_start, time_stop;
-    bool blkcache_found, expect_conversion, found, skip_cache_put, timer;
+    bool blkcache_found, blkcache_promote, expect_conversion, found, skip_cache_put, timer;
 
     blkcache = &S2C(session)->blkcache;
+    blkcache_image = NULL;
     blkcache_item = NULL;
     btree = S2BT(session);
     bm = btree->bm;
     compressor = btree->compressor;
     encryptor = btree->kencryptor == NULL ? NULL : btree->kencryptor->encryptor;
-    blkcache_found = found = false;
+    blkcache_found = blkcache_promote = found = false;
     skip_cache_put = (blkcache->type == WT_BLKCACHE_UNCONFIGURED);
 
     WT_ASSERT_ALWAYS(session, session->dhandle != NULL, "The block cache requires a dhandle");
@@ -97,8 +98,16 @@ __wt_blkcache_read(WT_SESSION_IMPL *session, WT_ITEM *buf, const uint8_t *addr,
         __wt_blkcache_get(session, addr, addr_size, &blkcache_item, &found, &skip_cache_put);
         if (found) {
             blkcache_found = true;
-            ip->data = blkcache_item->data;
-            ip->size = blkcache_item->data_size;
+            if (blkcache_item->mem_size != 0) {
+                /* The block is stored compressed, decompress it into our buffer. */
+                WT_ERR(__wt_blkcache_decompress(session, blkcache_item, ip, &blkcache_promote));
+                blkcache_image = ip;
+                if (!expect_conversion)
+                    goto verify;
+            } else {
+                ip->data = blkcache_item->data;
+                ip->size = blkcache_item->data_size;
+            }
             if (!expect_conversion) {
                 /* Copy to the caller's buffer before releasing our reference. */
                 WT_ERR(__wt_buf_set(session, buf, ip->data, ip->size));
@@ -224,6 +233,10 @@ err:
     if (blkcache_found)
         (void)__wt_atomic_subv32(&blkcache_item->ref_count, 1);
 
+    /* A hot block stored compressed is worth storing uncompressed. */
+    if (blkcache_promote && ret == 0)
+        WT_TRET(__wt_blkcache_promote(session, addr, addr_size, blkcache_image));
+
     __wt_scr_free(session, &tmp);
     __wt_scr_free(session, &etmp);
     return (ret);
@@ -40,6 +40,9 @@ __wt_bm_close_block(WT_SESSION_IMPL *session, WT_BLOCK *block)
     WT_ASSERT(
       session, block->ckpt_state == WT_CKPT_NONE || block->ckpt_state == WT_CKPT_PANIC_ON_FAILURE);
 
+    /* Write any batched checkpoint writes. */
+    WT_RET(__wt_block_write_batch_flush(session, block, true));
+
     if (block->sync_on_checkpoint) {
         WT_RET(__wt_fsync(session, block->fh, true));
         block->sync_on_checkpoint = false;
@@ -741,11 +744,17 @@ __bm_sync(WT_BM *bm, WT_SESSION_IMPL *session, bool block)
     if (bm->is_multi_handle)
         WT_RET(__bm_sync_tiered_handles(bm, session));
 
-    /* If we have made a switch from the older file, sync the older one instead. */
-    if (bm->prev_block != NULL)
+    /*
+     * If we have made a switch from the older file, sync the older one instead. Write any batched
+     * checkpoint writes first.
+     */
+    if (bm->prev_block != NULL) {
+        WT_RET(__wt_block_write_batch_flush(session, bm->prev_block, false));
         return (__wt_fsync(session, bm->prev_block->fh, block));
-    else
+    } else {
+        WT_RET(__wt_block_write_batch_flush(session, bm->block, false));
         return (__wt_fsync(session, bm->block->fh, block));
+    }
 }
 
 /*
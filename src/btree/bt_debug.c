@@ -271,7 +271,7 @@ __debug_config(WT_SESSION_IMPL *session, WT_DBG *ds, const char *ofile, uint32_t
      */
     if (!F_ISSET(conn, WT_CONN_IN_MEMORY) && !WT_IS_HS(session->dhandle) &&
       !(WT_READING_CHECKPOINT(session) && session->hs_checkpoint == NULL))
-        WT_ERR(__wt_curhs_open(session, NULL, &ds->hs_cursor));
+        WT_ERR(__wt_curhs_open(session, S2BT(session)->hs_id, NULL, &ds->hs_cursor));
 
     if (ds->hs_cursor != NULL) {
         /*
@@ -1097,7 +1097,7 @@ __wt_debug_cursor_tree_hs(void *cursor_arg, const char *ofile)
     WT_SESSION_IMPL *session;
 
     session = CUR2S(cursor_arg);
-    WT_RET(__wt_curhs_open(session, NULL, &hs_cursor));
+    WT_RET(__wt_curhs_open(session, 0, NULL, &hs_cursor));
     hs_btree = __wt_curhs_get_btree(hs_cursor);
     WT_WITH_BTREE(session, hs_btree, ret = __wt_debug_tree_all(session, NULL, NULL, ofile));
     WT_TRET(hs_cursor->close(hs_cursor));
@@ -43,10 +43,30 @@ __btree_clear(WT_SESSION_IMPL *session)
     /* Free allocated memory. */
     __wt_free(session, btree->key_format);
     __wt_free(session, btree->value_format);
+    __wt_hs_bloom_free(session, btree);
 
     return (ret);
 }
 
+/*
+ * __btree_hs_open --
+ *     Open the history store of a tree with a history store of its own. Eviction writes to it and
+ *     can't open it itself, open it while the schema lock is held, it stays open because history
+ *     store handles aren't swept.
+ */
+static int
+__btree_hs_open(WT_SESSION_IMPL *session)
+{
+    WT_DECL_RET;
+    char hs_uri[WT_HS_URI_SIZE];
+
+    WT_RET(__wt_hs_uri(S2BT(session)->hs_id, hs_uri, sizeof(hs_uri)));
+    WT_WITHOUT_DHANDLE(session,
+      if ((ret = __wt_session_get_dhandle(session, hs_uri, NULL, NULL, 0)) == 0)
+        ret = __wt_session_release_dhandle(session));
+    return (ret);
+}
+
 /*
  * __wt_btree_open --
  *     Open a Btree.
@@ -172,6 +192,9 @@ __wt_btree_open(WT_SESSION_IMPL *session, const char *op_cfg[])
         btree->evict_disabled_open = true;
     }
 
+    if (btree->hs_id != 0 && !F_ISSET(btree, WT_BTREE_READONLY | WT_BTREE_SPECIAL_FLAGS))
+        WT_ERR(__btree_hs_open(session));
+
     if (0) {
 err:
         WT_TRET(__wt_btree_close(session));
@@ -329,6 +352,12 @@ __btree_conf(WT_SESSION_IMPL *session, WT_CKPT *ckpt, bool is_ckpt)
     WT_RET(__wt_config_gets(session, cfg, "id", &cval));
     btree->id = (uint32_t)cval.val;
 
+    /* Get the ID of the history store holding the file's history. */
+    WT_RET(__wt_config_gets(session, cfg, "history_store.separate", &cval));
+    btree->hs_id = cval.val != 0 && !F_ISSET(conn, WT_CONN_IN_MEMORY) ? btree->id : 0;
+    WT_RET(__wt_config_gets(session, cfg, "history_store.reverse_modify_max", &cval));
+    btree->hs_reverse_modify_max = (u_int)cval.val;
+
     /* Validate file types and check the data format plan. */
     WT_RET(__wt_config_gets(session, cfg, "key_format", &cval));
     WT_RET(__wt_struct_confchk(session, &cval));
@@ -413,8 +442,8 @@ __btree_conf(WT_SESSION_IMPL *session, WT_CKPT *ckpt, bool is_ckpt)
         F_SET(btree, WT_BTREE_LOGGED);
     }
 
-    /* The history store file is never logged and supports timestamps. */
-    if (strcmp(session->dhandle->name, WT_HS_URI) == 0) {
+    /* The history store files are never logged and support timestamps. */
+    if (WT_IS_HS_URI(session->dhandle->name)) {
         F_SET(btree->dhandle, WT_DHANDLE_HS);
         F_CLR(btree, WT_BTREE_LOGGED);
     }
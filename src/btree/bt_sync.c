@@ -173,6 +173,17 @@ __wt_sync_file(WT_SESSION_IMPL *session, WT_CACHE_OP syncop)
          */
         oldest_id = __wt_txn_oldest_id(session);
 
+        /*
+         * The pages stay in cache and are marked clean, write older values to the history store so
+         * they aren't lost if the pages are evicted. As in eviction, fail rather than fix history
+         * store timestamps if a checkpoint is running.
+         */
+        rec_flags = WT_REC_CHECKPOINT;
+        if (!WT_IS_HS(btree->dhandle) && !WT_IS_METADATA(btree->dhandle))
+            rec_flags |= WT_REC_HS;
+        if (__wt_atomic_loadvbool(&conn->txn_global.checkpoint_running))
+            rec_flags |= WT_REC_CHECKPOINT_RUNNING;
+
         LF_SET(WT_READ_CACHE | WT_READ_NO_WAIT | WT_READ_SKIP_INTL);
         if (!F_ISSET(txn, WT_TXN_HAS_SNAPSHOT))
             LF_SET(WT_READ_VISIBLE_ALL);
@@ -193,9 +204,10 @@ __wt_sync_file(WT_SESSION_IMPL *session, WT_CACHE_OP syncop)
                     __wt_txn_get_snapshot(session);
                 leaf_bytes += page->memory_footprint;
                 ++leaf_pages;
-                WT_ERR(__wt_reconcile(session, walk, NULL, WT_REC_CHECKPOINT));
+                WT_ERR_ERROR_OK(__wt_reconcile(session, walk, NULL, rec_flags), EBUSY, false);
             }
         }
+        WT_STAT_CONN_INCRV(session, checkpoint_flush_pages, leaf_pages);
         break;
     case WT_SYNC_CHECKPOINT:
         /*
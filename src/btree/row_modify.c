@@ -332,9 +332,77 @@ __wt_row_insert_alloc(WT_SESSION_IMPL *session, const WT_ITEM *key, u_int skipde
     return (0);
 }
 
+/*
+ * __update_consolidate --
+ *     Insert a full value in front of a globally visible modify update, so readers stop there
+ *     rather than rebuilding the value from the rest of the chain. Called with the page locked.
+ */
+static int
+__update_consolidate(
+  WT_SESSION_IMPL *session, WT_CURSOR_BTREE *cbt, WT_UPDATE *prev, WT_UPDATE *modify)
+{
+    WT_DECL_ITEM(value);
+    WT_DECL_RET;
+    WT_UPDATE *upd;
+    WT_UPDATE_VECTOR modifies;
+    size_t size, skipped;
+
+    WT_ASSERT(session, modify->type == WT_UPDATE_MODIFY);
+
+    __wt_update_vector_init(session, &modifies);
+    for (upd = modify; upd != NULL; upd = upd->next) {
+        if (upd->txnid == WT_TXN_ABORTED)
+            continue;
+        if (WT_UPDATE_DATA_VALUE(upd))
+            break;
+        WT_ERR(__wt_update_vector_push(&modifies, upd));
+    }
+
+    /*
+     * Only consolidate chains that are long enough to be worth a full copy of the value, and that
+     * hold their own base value: reading the on-page value isn't something to do with the page
+     * locked.
+     */
+    if (upd == NULL || upd->type != WT_UPDATE_STANDARD || modifies.size < WT_MODIFY_UPDATE_MIN)
+        goto err;
+    skipped = modifies.size;
+
+    WT_ERR(__wt_scr_alloc(session, upd->size, &value));
+    WT_ERR(__wt_buf_set(session, value, upd->data, upd->size));
+    while (modifies.size > 0) {
+        __wt_update_vector_pop(&modifies, &upd);
+        WT_ERR(__wt_modify_apply_item(session, cbt->iface.value_format, value, upd->data));
+    }
+
+    /*
+     * The new update stands in for the modify: copy its identity, and the flags saying where
+     * reconciliation has already written that version.
+     */
+    WT_ERR(__wt_upd_alloc(session, value, WT_UPDATE_STANDARD, &upd, &size));
+    upd->txnid = modify->txnid;
+    upd->durable_ts = modify->durable_ts;
+    upd->start_ts = modify->start_ts;
+    upd->prev_durable_ts = modify->prev_durable_ts;
+    upd->flags = modify->flags;
+    upd->next = modify;
+
+    /* Readers walking the chain see either the modify or the full value, both are correct. */
+    WT_RELEASE_WRITE_WITH_BARRIER(prev->next, upd);
+    __wt_cache_page_inmem_incr(session, cbt->ref->page, size);
+
+    WT_STAT_CONN_DSRC_INCR(session, cache_update_chain_consolidate);
+    WT_STAT_CONN_DSRC_INCRV(session, cache_update_chain_consolidate_modify, skipped);
+
+err:
+    __wt_update_vector_free(&modifies);
+    __wt_scr_free(session, &value);
+    return (ret);
+}
+
 /*
  * __wt_update_obsolete_check --
- *     Check for obsolete updates and force evict the page if the update list is too long.
+ *     Check for obsolete updates following the given update and force evict the page if the update
+ *     list is too long.
  */
 void
 __wt_update_obsolete_check(
@@ -342,9 +410,10 @@ __wt_update_obsolete_check(
 {
     WT_PAGE *page;
     WT_TXN_GLOBAL *txn_global;
-    WT_UPDATE *first, *next;
+    WT_UPDATE *first, *next, *prev, *visible, *visible_prev;
     size_t size;
     u_int count;
+    bool truncate;
 
     next = NULL;
     page = cbt->ref->page;
@@ -355,6 +424,15 @@ __wt_update_obsolete_check(
     if (WT_PAGE_TRYLOCK(session, page) != 0)
         return;
 
+    /* Wait for readers of any earlier consolidation to finish before truncating. */
+    truncate = true;
+    if (page->modify->consolidate_txn != WT_TXN_NONE) {
+        if (__wt_txn_visible_all(session, page->modify->consolidate_txn, WT_TS_NONE))
+            page->modify->consolidate_txn = WT_TXN_NONE;
+        else
+            truncate = false;
+    }
+
     /*
      * This function identifies obsolete updates, and truncates them from the rest of the chain;
      * because this routine is called from inside a serialization function, the caller has
@@ -363,8 +441,12 @@ __wt_update_obsolete_check(
      * Walk the list of updates, looking for obsolete updates at the end.
      *
      * Only updates with globally visible, self-contained data can terminate update chains.
+     *
+     * Also track the newest update of the globally visible run at the end of the chain, and the
+     * update in front of it: if it's a modify, it can be replaced by a full value.
      */
-    for (first = NULL, count = 0; upd != NULL; upd = upd->next, count++) {
+    for (first = visible = visible_prev = NULL, prev = upd, upd = upd->next, count = 0; upd != NULL;
+         prev = upd, upd = upd->next, count++) {
         if (upd->txnid == WT_TXN_ABORTED)
             continue;
 
@@ -385,14 +467,29 @@ __wt_update_obsolete_check(
         if (__wt_txn_upd_visible_all(session, upd)) {
             if (first == NULL && WT_UPDATE_DATA_VALUE(upd))
                 first = upd;
+            if (visible == NULL) {
+                visible = upd;
+                visible_prev = prev;
+            }
         } else
-            first = NULL;
+            first = visible = NULL;
 
         /* Cannot truncate the updates if we need to remove the updates from the history store. */
         if (F_ISSET(upd, WT_UPDATE_TO_DELETE_FROM_HS))
-            first = NULL;
+            first = visible = NULL;
     }
 
+    if (count < 10)
+        WT_STAT_CONN_DSRC_INCR(session, cache_update_chain_lt10);
+    else if (count < 100)
+        WT_STAT_CONN_DSRC_INCR(session, cache_update_chain_lt100);
+    else if (count < WT_THOUSAND)
+        WT_STAT_CONN_DSRC_INCR(session, cache_update_chain_lt1000);
+    else
+        WT_STAT_CONN_DSRC_INCR(session, cache_update_chain_ge1000);
+    if (!truncate)
+        first = NULL;
+
     /*
      * We cannot discard this WT_UPDATE structure, we can only discard WT_UPDATE structures
      * subsequent to it, other threads of control will terminate their walk in this element. Save a
@@ -428,6 +525,16 @@ __wt_update_obsolete_check(
         __wt_page_evict_soon(session, cbt->ref);
     }
 
+    /*
+     * If the globally visible run starts with a modify, put a full value in front of it. The
+     * updates it replaces can be truncated once every reader that might be walking them has gone.
+     */
+    if (truncate && visible != NULL && visible_prev != NULL && visible->type == WT_UPDATE_MODIFY &&
+      F_MASK(visible, WT_UPDATE_DS | WT_UPDATE_HS) == visible->flags &&
+      __update_consolidate(session, cbt, visible_prev, visible) == 0 &&
+      visible_prev->next != visible)
+        page->modify->consolidate_txn = __wt_atomic_loadv64(&txn_global->current);
+
     if (next != NULL)
         __wt_free_update_list(session, &next);
     else {
@@ -3217,6 +3217,9 @@ wiredtiger_open(const char *home, WT_EVENT_HANDLER *event_handler, const char *c
      */
     WT_ERR(__wt_tiered_conn_config(session, cfg, false));
 
+    /* The block cache compressor is configured after extensions, which may load compressors. */
+    WT_ERR(__wt_blkcache_compressor_config(session, cfg));
+
     /*
      * The metadata/log encryptor is configured after extensions, since extensions may load
      * encryptors. We have to do this before creating the metadata file.
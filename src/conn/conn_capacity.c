@@ -333,6 +333,73 @@ __throttle_chunkcache(WT_SESSION_IMPL *session, WT_CAPACITY *cap, uint64_t bytes
     }
 }
 
+/*
+ * __throttle_ckpt_pace --
+ *     Reserve a time to perform a paced checkpoint write, and wait until then. The rate is the one
+ *     needed to write the cache's remaining dirty bytes by the checkpoint's target completion time,
+ *     recomputed on every write so it follows the checkpoint's progress and the application's
+ *     updates. In-memory sizes overstate the bytes left to write, which errs on the side of the
+ *     checkpoint finishing early.
+ */
+static void
+__throttle_ckpt_pace(WT_SESSION_IMPL *session, WT_CAPACITY *cap, uint64_t bytes)
+{
+    struct timespec now;
+    uint64_t end_ns, now_ns, rate, res_value, sleep_us;
+
+    if ((end_ns = __wt_atomic_load64(&cap->ckpt_pace_end)) == 0 ||
+      F_ISSET(S2C(session), WT_CONN_CLOSING | WT_CONN_RECOVERING))
+        return;
+
+    __wt_epoch(session, &now);
+    now_ns = (uint64_t)now.tv_sec * WT_BILLION + (uint64_t)now.tv_nsec;
+
+    /* If the checkpoint has run past its target, write as fast as possible. */
+    if (now_ns >= end_ns)
+        return;
+
+    rate = __wt_cache_dirty_inuse(S2C(session)->cache) * WT_THOUSAND /
+      WT_MAX((end_ns - now_ns) / WT_MILLION, 1);
+    rate = WT_MAX(rate, WT_THROTTLE_MIN);
+    WT_STAT_CONN_SET(session, capacity_ckpt_pace_rate, rate);
+
+    /* If we get sizes larger than this, later calculations may overflow. */
+    WT_ASSERT(session, bytes < 16 * (uint64_t)WT_GIGABYTE);
+
+    __capacity_reserve(&cap->reservation_ckpt_pace, bytes, rate, now_ns, &res_value);
+    if (res_value > now_ns) {
+        sleep_us = WT_MIN((res_value - now_ns), end_ns - now_ns) / WT_THOUSAND;
+        WT_STAT_CONN_INCRV(session, capacity_time_ckpt_pace, sleep_us);
+        if (sleep_us > WT_CAPACITY_SLEEP_CUTOFF_US)
+            /* Sleep handles large usec values. */
+            __wt_sleep(0, sleep_us);
+    }
+}
+
+/*
+ * __wt_capacity_ckpt_pace --
+ *     Start pacing checkpoint writes to complete within the given time, or stop if it is zero.
+ */
+void
+__wt_capacity_ckpt_pace(WT_SESSION_IMPL *session, uint64_t usecs)
+{
+    struct timespec now;
+    WT_CAPACITY *cap;
+    uint64_t now_ns;
+
+    cap = &S2C(session)->capacity;
+    if (usecs == 0) {
+        __wt_atomic_store64(&cap->ckpt_pace_end, 0);
+        WT_STAT_CONN_SET(session, capacity_ckpt_pace_rate, 0);
+        return;
+    }
+
+    __wt_epoch(session, &now);
+    now_ns = (uint64_t)now.tv_sec * WT_BILLION + (uint64_t)now.tv_nsec;
+    __wt_atomic_store64(&cap->reservation_ckpt_pace, now_ns);
+    __wt_atomic_store64(&cap->ckpt_pace_end, now_ns + usecs * WT_THOUSAND);
+}
+
 /*
  * __wt_capacity_throttle --
  *     Reserve a time to perform a write operation for the subsystem, and wait until that time. The
@@ -367,6 +434,7 @@ __wt_capacity_throttle(WT_SESSION_IMPL *session, uint64_t bytes, WT_THROTTLE_TYP
         __throttle_chunkcache(session, cap, bytes);
         return;
     case WT_THROTTLE_CKPT:
+        __throttle_ckpt_pace(session, cap, bytes);
         capacity = cap->ckpt;
         reservation = &cap->reservation_ckpt;
         WT_STAT_CONN_INCRV(session, capacity_bytes_ckpt, bytes);
@@ -28,6 +28,12 @@ __ckpt_server_config(WT_SESSION_IMPL *session, const char **cfg, bool *startp)
     WT_RET(__wt_config_gets(session, cfg, "checkpoint.wait", &cval));
     conn->ckpt_usecs = (uint64_t)cval.val * WT_MILLION;
 
+    WT_RET(__wt_config_gets(session, cfg, "checkpoint.flush_wait", &cval));
+    conn->ckpt_flush_usecs = (uint64_t)cval.val * WT_MILLION;
+
+    WT_RET(__wt_config_gets(session, cfg, "checkpoint.pacing", &cval));
+    conn->ckpt_pace_usecs = (conn->ckpt_usecs / 100) * (uint64_t)cval.val;
+
     WT_RET(__wt_config_gets(session, cfg, "checkpoint.log_size", &cval));
     ckpt_logsize = (wt_off_t)cval.val;
     __wt_atomic_storei64(&conn->ckpt_logsize, ckpt_logsize);
@@ -68,6 +74,67 @@ __ckpt_server_run_chk(WT_SESSION_IMPL *session)
     return (FLD_ISSET(S2C(session)->server_flags, WT_CONN_SERVER_CHECKPOINT));
 }
 
+/*
+ * __ckpt_server_flush --
+ *     Write a tree's dirty leaf pages between checkpoints.
+ */
+static int
+__ckpt_server_flush(WT_SESSION_IMPL *session, const char *cfg[])
+{
+    WT_UNUSED(cfg);
+
+    /* Leave the pages to a running checkpoint. */
+    if (__wt_atomic_loadvbool(&S2C(session)->txn_global.checkpoint_running))
+        return (0);
+
+    return (__wt_sync_file(session, WT_SYNC_WRITE_LEAVES));
+}
+
+/*
+ * __ckpt_server_wait --
+ *     Wait until it's time for the next checkpoint. If configured, write the dirty leaf pages of
+ *     all open trees at intervals while waiting, so the checkpoint has less to write.
+ */
+static int
+__ckpt_server_wait(WT_SESSION_IMPL *session)
+{
+    WT_CONNECTION_IMPL *conn;
+    WT_DECL_RET;
+    uint64_t elapsed, time_start, wait_usecs;
+    bool flush, signalled;
+
+    conn = S2C(session);
+    time_start = __wt_clock(session);
+
+    for (;;) {
+        /*
+         * NOTE: If the user only configured logsize, then usecs will be 0 and this wait won't
+         * return until signalled.
+         */
+        wait_usecs = conn->ckpt_usecs;
+        flush = false;
+        if (conn->ckpt_usecs != 0 && conn->ckpt_flush_usecs != 0) {
+            elapsed = WT_CLOCKDIFF_US(__wt_clock(session), time_start);
+            if (elapsed + conn->ckpt_flush_usecs < conn->ckpt_usecs) {
+                wait_usecs = conn->ckpt_flush_usecs;
+                flush = true;
+            } else
+                wait_usecs = conn->ckpt_usecs > elapsed ? conn->ckpt_usecs - elapsed : 1;
+        }
+        __wt_cond_wait_signal(
+          session, conn->ckpt_cond, wait_usecs, __ckpt_server_run_chk, &signalled);
+
+        /* Checkpoint if it's time, or if we were signalled: we may be quitting. */
+        if (!flush || signalled || !__ckpt_server_run_chk(session))
+            return (0);
+
+        WT_WITH_TXN_ISOLATION(session, WT_ISO_READ_COMMITTED,
+          ret = __wt_conn_btree_apply(session, NULL, __ckpt_server_flush, NULL, NULL));
+        WT_RET(ret);
+        WT_STAT_CONN_INCR(session, checkpoint_flush);
+    }
+}
+
 /*
  * __ckpt_server --
  *     The checkpoint server thread.
@@ -86,18 +153,19 @@ __ckpt_server(void *arg)
     wt_session = (WT_SESSION *)session;
 
     for (;;) {
-        /*
-         * Wait... NOTE: If the user only configured logsize, then usecs will be 0 and this wait
-         * won't return until signalled.
-         */
-        __wt_cond_wait(session, conn->ckpt_cond, conn->ckpt_usecs, __ckpt_server_run_chk);
+        /* Wait... */
+        WT_ERR(__ckpt_server_wait(session));
 
         /* Check if we're quitting or being reconfigured. */
         if (!__ckpt_server_run_chk(session))
             break;
 
+        /* Spread the checkpoint's writes over part of the interval until the next checkpoint. */
         checkpoint_gen = __wt_gen(session, WT_GEN_CHECKPOINT);
-        WT_ERR(wt_session->checkpoint(wt_session, NULL));
+        __wt_capacity_ckpt_pace(session, conn->ckpt_pace_usecs);
+        ret = wt_session->checkpoint(wt_session, NULL);
+        __wt_capacity_ckpt_pace(session, 0);
+        WT_ERR(ret);
 
         /*
          * Reset the log file size counters if the checkpoint wasn't skipped.
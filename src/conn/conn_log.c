@@ -41,6 +41,9 @@ __logmgr_sync_cfg(WT_SESSION_IMPL *session, const char **cfg)
     else if (WT_CONFIG_LIT_MATCH("none", cval))
         FLD_SET(txn_logsync, WT_LOG_FLUSH);
     WT_RELEASE_WRITE_WITH_BARRIER(conn->txn_logsync, txn_logsync);
+
+    WT_RET(__wt_config_gets(session, cfg, "transaction_sync.latency_target", &cval));
+    conn->txn_logsync_target = (uint64_t)cval.val;
     return (0);
 }
 
@@ -257,6 +260,8 @@ __wt_logmgr_config(WT_SESSION_IMPL *session, const char **cfg, bool reconfig)
         conn->log_compressor = NULL;
         WT_RET(__wt_config_gets_none(session, cfg, "log.compressor", &cval));
         WT_RET(__wt_compressor_config(session, &cval, &conn->log_compressor));
+        WT_RET(__wt_config_gets(session, cfg, "log.dictionary_size", &cval));
+        conn->log_dict_size = (size_t)cval.val;
 
         conn->log_path = NULL;
         WT_RET(__wt_config_gets(session, cfg, "log.path", &cval));
@@ -330,6 +335,9 @@ __wt_logmgr_config(WT_SESSION_IMPL *session, const char **cfg, bool reconfig)
         WT_RET(__wt_config_gets_def(session, cfg, "log.recover", 0, &cval));
         if (WT_CONFIG_LIT_MATCH("error", cval))
             FLD_SET(conn->log_flags, WT_CONN_LOG_RECOVER_ERR);
+
+        WT_RET(__wt_config_gets_def(session, cfg, "log.recover_threads", 0, &cval));
+        conn->log_recover_threads = (u_int)cval.val;
     }
 
     WT_RET(__wt_config_gets(session, cfg, "log.zero_fill", &cval));
@@ -688,13 +696,13 @@ typedef struct {
         __wt_lsn_offset(&(entry1).lsn) < __wt_lsn_offset(&(entry2).lsn)))
 
 /*
- * __wt_log_wrlsn --
+ * __log_wrlsn_process --
  *     Process written log slots and attempt to coalesce them if the LSNs are contiguous. The
  *     purpose of this function is to advance the write_lsn in LSN order after the buffer is written
- *     to the log file.
+ *     to the log file. Must be called holding the write LSN lock.
  */
-void
-__wt_log_wrlsn(WT_SESSION_IMPL *session, int *yield)
+static void
+__log_wrlsn_process(WT_SESSION_IMPL *session, int *yield)
 {
     WT_CONNECTION_IMPL *conn;
     WT_LOG *log;
@@ -706,7 +714,7 @@ __wt_log_wrlsn(WT_SESSION_IMPL *session, int *yield)
 
     conn = S2C(session);
     log = conn->log;
-    __wt_spin_lock(session, &log->log_writelsn_lock);
+    WT_ASSERT_SPINLOCK_OWNED(session, &log->log_writelsn_lock);
 restart:
     coalescing = NULL;
     WT_INIT_LSN(&save_lsn);
@@ -806,9 +814,41 @@ restart:
             __wt_log_slot_free(session, slot);
         }
     }
+}
+
+/*
+ * __wt_log_wrlsn --
+ *     Advance the write_lsn over any written log slots.
+ */
+void
+__wt_log_wrlsn(WT_SESSION_IMPL *session, int *yield)
+{
+    WT_LOG *log;
+
+    log = S2C(session)->log;
+    __wt_spin_lock(session, &log->log_writelsn_lock);
+    __log_wrlsn_process(session, yield);
     __wt_spin_unlock(session, &log->log_writelsn_lock);
 }
 
+/*
+ * __wt_log_wrlsn_try --
+ *     Advance the write_lsn over any written log slots unless another thread is already doing it.
+ *     Return if the slots were processed.
+ */
+bool
+__wt_log_wrlsn_try(WT_SESSION_IMPL *session)
+{
+    WT_LOG *log;
+
+    log = S2C(session)->log;
+    if (__wt_spin_trylock(session, &log->log_writelsn_lock) != 0)
+        return (false);
+    __log_wrlsn_process(session, NULL);
+    __wt_spin_unlock(session, &log->log_writelsn_lock);
+    return (true);
+}
+
 /*
  * __log_wrlsn_server --
  *     The log wrlsn server thread.
@@ -919,6 +959,17 @@ __log_server(void *arg)
          */
         if (timediff >= WT_THOUSAND || signalled) {
 
+            /*
+             * Adjust the slot buffers to the size of the records being written.
+             */
+            WT_WITH_SLOT_LOCK(session, log, __wt_log_slot_resize(session));
+
+            /*
+             * Track the compression ratio and build the next compression dictionary.
+             */
+            if (conn->log_compressor != NULL)
+                WT_ERR(__wt_log_compress_server(session));
+
             /*
              * Perform log pre-allocation.
              */
@@ -1012,6 +1063,7 @@ __wt_logmgr_create(WT_SESSION_IMPL *session)
 
     WT_RET(__wt_cond_alloc(session, "log sync", &log->log_sync_cond));
     WT_RET(__wt_cond_alloc(session, "log write", &log->log_write_cond));
+    WT_RET(__wt_log_dict_init(session));
     WT_RET(__wt_log_open(session));
     WT_RET(__wt_log_slot_init(session, true));
 
@@ -1146,6 +1198,7 @@ __wt_logmgr_destroy(WT_SESSION_IMPL *session)
 
     WT_TRET(__wt_log_slot_destroy(session));
     WT_TRET(__wt_log_close(session));
+    WT_TRET(__wt_log_dict_destroy(session));
 
     /* Close the server thread's session. */
     if (conn->log_session != NULL) {
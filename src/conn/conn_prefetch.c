@@ -8,6 +8,446 @@
 
 #include "wt_internal.h"
 
+/*
+ * __prefetch_warm_hotness_cmp --
+ *     Qsort comparison function, sorting warm restart pages hottest first.
+ */
+static int WT_CDECL
+__prefetch_warm_hotness_cmp(const void *a, const void *b)
+{
+    const WT_PREFETCH_WARM_PAGE *pa, *pb;
+
+    pa = a;
+    pb = b;
+    return (pa->hotness > pb->hotness ? -1 : (pa->hotness < pb->hotness ? 1 : 0));
+}
+
+/*
+ * __prefetch_warm_addr_cmp --
+ *     Qsort and bsearch comparison function, sorting warm restart pages by address cookie.
+ */
+static int WT_CDECL
+__prefetch_warm_addr_cmp(const void *a, const void *b)
+{
+    const WT_PREFETCH_WARM_PAGE *pa, *pb;
+    int cmp;
+
+    pa = a;
+    pb = b;
+    if ((cmp = memcmp(pa->addr, pb->addr, WT_MIN(pa->addr_size, pb->addr_size))) != 0)
+        return (cmp);
+    return ((int)pa->addr_size - (int)pb->addr_size);
+}
+
+/*
+ * __prefetch_warm_save_tree --
+ *     Write the hottest leaf pages of a tree in cache to the warm restart file.
+ */
+static int
+__prefetch_warm_save_tree(WT_SESSION_IMPL *session, WT_FSTREAM *fs, WT_PREFETCH_WARM *warm)
+{
+    WT_ADDR_COPY addr;
+    WT_DATA_HANDLE *dhandle;
+    WT_DECL_ITEM(tmp);
+    WT_DECL_RET;
+    WT_PAGE *page;
+    WT_PREFETCH_WARM_PAGE *wp;
+    WT_REF *ref;
+    size_t i, max;
+    bool has_addr;
+
+    dhandle = session->dhandle;
+    max = S2C(session)->prefetch_warm_pages;
+    warm->entries = 0;
+
+    /*
+     * Gather the tree's leaf pages in cache that have a disk address, along with their read
+     * generation. Bound the memory we use: when the list fills up, sort it and keep the hottest
+     * pages.
+     */
+    ref = NULL;
+    while ((ret = __wt_tree_walk(session, &ref,
+              WT_READ_CACHE | WT_READ_NO_EVICT | WT_READ_NO_WAIT | WT_READ_SKIP_INTL |
+                WT_READ_VISIBLE_ALL)) == 0 &&
+      ref != NULL) {
+        page = ref->page;
+        if (page->read_gen == WT_READGEN_WONT_NEED)
+            continue;
+        WT_WITH_PAGE_INDEX(session, has_addr = __wt_ref_addr_copy(session, ref, &addr));
+        if (!has_addr)
+            continue;
+
+        if (warm->entries == 2 * max) {
+            __wt_qsort(warm->pages, warm->entries, sizeof(WT_PREFETCH_WARM_PAGE),
+              __prefetch_warm_hotness_cmp);
+            warm->entries = max;
+        }
+        WT_ERR(
+          __wt_realloc_def(session, &warm->pages_allocated, warm->entries + 1, &warm->pages));
+        wp = &warm->pages[warm->entries++];
+        wp->hotness = page->read_gen;
+        memcpy(wp->addr, addr.addr, addr.size);
+        wp->addr_size = addr.size;
+    }
+    WT_ERR(ret);
+
+    if (warm->entries == 0)
+        return (0);
+    __wt_qsort(
+      warm->pages, warm->entries, sizeof(WT_PREFETCH_WARM_PAGE), __prefetch_warm_hotness_cmp);
+    warm->entries = WT_MIN(warm->entries, max);
+
+    /* The tree's URI, the number of pages, then the pages' address cookies, hottest first. */
+    WT_ERR(__wt_scr_alloc(session, 0, &tmp));
+    WT_ERR(__wt_fprintf(session, fs, "%s\n%" WT_SIZET_FMT "\n", dhandle->name, warm->entries));
+    for (i = 0; i < warm->entries; ++i) {
+        WT_ERR(__wt_raw_to_hex(session, warm->pages[i].addr, warm->pages[i].addr_size, tmp));
+        WT_ERR(__wt_fprintf(session, fs, "%s\n", (const char *)tmp->data));
+    }
+    WT_STAT_CONN_INCRV(session, prefetch_warm_pages_recorded, warm->entries);
+
+err:
+    if (ref != NULL)
+        WT_TRET(__wt_page_release(session, ref, 0));
+    __wt_scr_free(session, &tmp);
+    return (ret);
+}
+
+/*
+ * __prefetch_warm_save_apply --
+ *     Write the warm restart list of each open tree. The caller holds the handle list lock.
+ */
+static int
+__prefetch_warm_save_apply(WT_SESSION_IMPL *session, WT_FSTREAM *fs, WT_PREFETCH_WARM *warm)
+{
+    WT_CONNECTION_IMPL *conn;
+    WT_DATA_HANDLE *dhandle;
+    WT_DECL_RET;
+
+    conn = S2C(session);
+    for (dhandle = NULL;;) {
+        WT_DHANDLE_NEXT(session, dhandle, &conn->dhqh, q);
+        if (dhandle == NULL)
+            break;
+
+        /*
+         * Skip trees we can't or needn't walk: the metadata is always read at open, checkpoints
+         * are opened on demand, and a tree held exclusively may be changing underneath us.
+         */
+        if (!WT_DHANDLE_BTREE(dhandle) || !F_ISSET(dhandle, WT_DHANDLE_OPEN) ||
+          F_ISSET(dhandle, WT_DHANDLE_DISCARD | WT_DHANDLE_EXCLUSIVE) ||
+          WT_IS_METADATA(dhandle) || WT_DHANDLE_IS_CHECKPOINT(dhandle))
+            continue;
+
+        WT_WITH_DHANDLE(session, dhandle, ret = __prefetch_warm_save_tree(session, fs, warm));
+        WT_RET(ret);
+    }
+    return (0);
+}
+
+/*
+ * __wt_prefetch_warm_save --
+ *     Record the hottest pages of each open tree for warm restart.
+ */
+int
+__wt_prefetch_warm_save(WT_SESSION_IMPL *session)
+{
+    WT_CONNECTION_IMPL *conn;
+    WT_DECL_RET;
+    WT_FSTREAM *fs;
+    WT_PREFETCH_WARM warm;
+
+    conn = S2C(session);
+    fs = NULL;
+    WT_CLEAR(warm);
+
+    /*
+     * The checkpoint at the end of recovery runs with a cold cache: don't let it replace the list
+     * we're about to load. Don't replace the list while it's being loaded either, if we crash
+     * before the cache is warm, we want to reload the same list.
+     */
+    if (!conn->prefetch_warm_restart ||
+      F_ISSET(conn, WT_CONN_IN_MEMORY | WT_CONN_READONLY | WT_CONN_RECOVERING) ||
+      __wt_atomic_loadbool(&conn->prefetch_warm_loading))
+        return (0);
+
+    WT_RET(__wt_remove_if_exists(session, WT_WARM_RESTART_SET, false));
+    WT_RET(__wt_fopen(session, WT_WARM_RESTART_SET, WT_FS_OPEN_CREATE | WT_FS_OPEN_EXCLUSIVE,
+      WT_STREAM_WRITE, &fs));
+    WT_WITH_HANDLE_LIST_READ_LOCK(session, ret = __prefetch_warm_save_apply(session, fs, &warm));
+    WT_ERR(ret);
+
+    /* Flush the stream and rename the file into place. */
+    ret = __wt_sync_and_rename(session, &fs, WT_WARM_RESTART_SET, WT_WARM_RESTART);
+
+    if (0) {
+err:
+        WT_TRET(__wt_fclose(session, &fs));
+        WT_TRET(__wt_remove_if_exists(session, WT_WARM_RESTART_SET, false));
+    }
+    __wt_free(session, warm.pages);
+    return (ret);
+}
+
+/*
+ * __prefetch_warm_walk_skip --
+ *     Tree walk skip function for warm restart: only internal pages are read, leaf pages on the
+ *     list are flagged for pre-fetch as the walk goes past them.
+ */
+static int
+__prefetch_warm_walk_skip(
+  WT_SESSION_IMPL *session, WT_REF *ref, void *context, bool visible_all, bool *skipp)
+{
+    WT_ADDR_COPY addr;
+    WT_CONNECTION_IMPL *conn;
+    WT_PREFETCH_WARM *warm;
+    WT_PREFETCH_WARM_PAGE key, *wp;
+
+    WT_UNUSED(visible_all);
+
+    conn = S2C(session);
+    warm = context;
+
+    *skipp = F_ISSET(ref, WT_REF_FLAG_LEAF);
+    if (!*skipp)
+        return (0);
+
+    /* Ignore pages already in cache or queued, and fast-truncated pages. */
+    if (WT_REF_GET_STATE(ref) != WT_REF_DISK || ref->page_del != NULL ||
+      F_ISSET_ATOMIC_8(ref, WT_REF_FLAG_PREFETCH) || !__wt_ref_addr_copy(session, ref, &addr))
+        return (0);
+
+    memcpy(key.addr, addr.addr, addr.size);
+    key.addr_size = addr.size;
+    if ((wp = bsearch(&key, warm->pages, warm->entries, sizeof(WT_PREFETCH_WARM_PAGE),
+           __prefetch_warm_addr_cmp)) == NULL ||
+      wp->ref != NULL)
+        return (0);
+
+    /*
+     * The walk holds the parent page. Flagging the ref as queued for pre-fetch keeps the parent
+     * from being evicted, and so the ref from being freed, until the page is queued and read, or
+     * the flag is cleared.
+     */
+    __wt_spin_lock(session, &conn->prefetch_lock);
+    if (!F_ISSET_ATOMIC_8(ref, WT_REF_FLAG_PREFETCH)) {
+        F_SET_ATOMIC_8(ref, WT_REF_FLAG_PREFETCH);
+        wp->ref = ref;
+    }
+    __wt_spin_unlock(session, &conn->prefetch_lock);
+    return (0);
+}
+
+/*
+ * __prefetch_warm_queue --
+ *     Find a tree's warm restart pages and queue them for pre-fetch, hottest first.
+ */
+static int
+__prefetch_warm_queue(WT_SESSION_IMPL *session, WT_PREFETCH_WARM *warm, bool *fullp)
+{
+    WT_CONNECTION_IMPL *conn;
+    WT_DECL_RET;
+    WT_REF *ref;
+    size_t i;
+
+    conn = S2C(session);
+
+    /* Walk the tree's internal pages, reading them in, and look up the leaf pages on the list. */
+    __wt_qsort(warm->pages, warm->entries, sizeof(WT_PREFETCH_WARM_PAGE), __prefetch_warm_addr_cmp);
+    ref = NULL;
+    while (F_ISSET(conn, WT_CONN_PREFETCH_RUN) &&
+      (ret = __wt_tree_walk_custom_skip(
+         session, &ref, __prefetch_warm_walk_skip, warm, WT_READ_VISIBLE_ALL)) == 0 &&
+      ref != NULL)
+        ;
+    if (ref != NULL)
+        WT_TRET(__wt_page_release(session, ref, 0));
+
+    /*
+     * Queue the pages we found, hottest first. Don't run ahead of the pre-fetch threads, the queue
+     * is shared with application pre-fetch. The pre-fetch threads' reads are subject to the
+     * connection's I/O capacity. Once the cache is close to its eviction trigger, pre-fetch is
+     * refused and we're done. Clear the flag on pages we don't queue.
+     */
+    __wt_qsort(
+      warm->pages, warm->entries, sizeof(WT_PREFETCH_WARM_PAGE), __prefetch_warm_hotness_cmp);
+    for (i = 0; i < warm->entries; ++i) {
+        if ((ref = warm->pages[i].ref) == NULL) {
+            WT_STAT_CONN_INCR(session, prefetch_warm_pages_missing);
+            continue;
+        }
+        warm->pages[i].ref = NULL;
+
+        while (ret == 0 && !*fullp && F_ISSET(conn, WT_CONN_PREFETCH_RUN) &&
+          conn->prefetch_queue_count > WT_MAX_PREFETCH_QUEUE)
+            __wt_sleep(0, 10 * WT_THOUSAND);
+        if (ret == 0 && !*fullp && F_ISSET(conn, WT_CONN_PREFETCH_RUN)) {
+            if ((ret = __wt_conn_prefetch_queue_push(session, ref)) == 0) {
+                WT_STAT_CONN_INCR(session, prefetch_warm_pages_queued);
+                continue;
+            }
+            if (ret == EBUSY) {
+                *fullp = __wt_eviction_clean_pressure(session);
+                ret = 0;
+            }
+        }
+
+        __wt_spin_lock(session, &conn->prefetch_lock);
+        F_CLR_ATOMIC_8(ref, WT_REF_FLAG_PREFETCH);
+        __wt_spin_unlock(session, &conn->prefetch_lock);
+    }
+    return (ret);
+}
+
+/*
+ * __prefetch_warm_load --
+ *     Read the warm restart file and queue each tree's pages for pre-fetch.
+ */
+static int
+__prefetch_warm_load(WT_SESSION_IMPL *session)
+{
+    WT_CONNECTION_IMPL *conn;
+    WT_DECL_ITEM(line);
+    WT_DECL_ITEM(tmp);
+    WT_DECL_ITEM(uri);
+    WT_DECL_RET;
+    WT_FSTREAM *fs;
+    WT_PREFETCH_WARM warm;
+    WT_PREFETCH_WARM_PAGE *wp;
+    uint64_t count, i;
+    char *p;
+    bool full;
+
+    conn = S2C(session);
+    fs = NULL;
+    full = false;
+    WT_CLEAR(warm);
+
+    WT_ERR(__wt_fopen(session, WT_WARM_RESTART, 0, WT_STREAM_READ, &fs));
+    WT_ERR(__wt_scr_alloc(session, 0, &line));
+    WT_ERR(__wt_scr_alloc(session, 0, &tmp));
+    WT_ERR(__wt_scr_alloc(session, 0, &uri));
+    while (!full && F_ISSET(conn, WT_CONN_PREFETCH_RUN)) {
+        /* Each tree's list is its URI, the number of pages, then the pages' address cookies. */
+        WT_ERR(__wt_getline(session, fs, uri));
+        if (uri->size == 0)
+            break;
+        WT_ERR(__wt_getline(session, fs, line));
+        count = __wt_strtouq(line->data, &p, 10);
+        if (line->size == 0 || *p != '\0')
+            WT_ERR_MSG(session, EINVAL, "%s: corrupted warm restart file", WT_WARM_RESTART);
+
+        warm.entries = 0;
+        for (i = 0; i < count; ++i) {
+            WT_ERR(__wt_getline(session, fs, line));
+            WT_ERR(__wt_hex_to_raw(session, line->data, tmp));
+            if (tmp->size == 0 || tmp->size > WT_BTREE_MAX_ADDR_COOKIE)
+                WT_ERR_MSG(session, EINVAL, "%s: corrupted warm restart file", WT_WARM_RESTART);
+            WT_ERR(
+              __wt_realloc_def(session, &warm.pages_allocated, warm.entries + 1, &warm.pages));
+            wp = &warm.pages[warm.entries++];
+            wp->ref = NULL;
+            wp->hotness = count - i;
+            memcpy(wp->addr, tmp->data, tmp->size);
+            wp->addr_size = (uint8_t)tmp->size;
+        }
+
+        /* The tree may have been dropped since the list was written. */
+        ret = __wt_session_get_dhandle(session, uri->data, NULL, NULL, 0);
+        if (ret == ENOENT || ret == WT_NOTFOUND) {
+            ret = 0;
+            continue;
+        }
+        WT_ERR(ret);
+        ret = __prefetch_warm_queue(session, &warm, &full);
+        WT_TRET(__wt_session_release_dhandle(session));
+        WT_ERR(ret);
+    }
+
+err:
+    WT_TRET(__wt_fclose(session, &fs));
+    __wt_scr_free(session, &line);
+    __wt_scr_free(session, &tmp);
+    __wt_scr_free(session, &uri);
+    __wt_free(session, warm.pages);
+    return (ret);
+}
+
+/*
+ * __prefetch_warm_server --
+ *     The warm restart thread: queue the pages recorded before the restart for pre-fetch.
+ */
+static WT_THREAD_RET
+__prefetch_warm_server(void *arg)
+{
+    WT_CONNECTION_IMPL *conn;
+    WT_DECL_RET;
+    WT_SESSION_IMPL *session;
+
+    session = arg;
+    conn = S2C(session);
+
+    /* Warm restart is an optimization, a failure isn't fatal. */
+    if ((ret = __prefetch_warm_load(session)) != 0)
+        __wt_err(session, ret, "warm restart pre-fetch failed");
+
+    __wt_atomic_storebool(&conn->prefetch_warm_loading, false);
+    return (WT_THREAD_RET_VALUE);
+}
+
+/*
+ * __prefetch_warm_create --
+ *     Start the warm restart thread, if there's a list of pages to load.
+ */
+static int
+__prefetch_warm_create(WT_SESSION_IMPL *session)
+{
+    WT_CONNECTION_IMPL *conn;
+    bool exist;
+
+    conn = S2C(session);
+
+    if (!conn->prefetch_warm_restart || F_ISSET(conn, WT_CONN_IN_MEMORY))
+        return (0);
+    WT_RET(__wt_fs_exist(session, WT_WARM_RESTART, &exist));
+    if (!exist)
+        return (0);
+
+    WT_RET(__wt_open_internal_session(
+      conn, "prefetch-warm", true, WT_SESSION_CAN_WAIT, 0, &conn->prefetch_warm_session));
+
+    /* Set first, a checkpoint might run before the thread starts. */
+    __wt_atomic_storebool(&conn->prefetch_warm_loading, true);
+    WT_RET(__wt_thread_create(
+      session, &conn->prefetch_warm_tid, __prefetch_warm_server, conn->prefetch_warm_session));
+    conn->prefetch_warm_tid_set = true;
+    return (0);
+}
+
+/*
+ * __prefetch_warm_destroy --
+ *     Stop the warm restart thread. The caller has cleared the pre-fetch run flag.
+ */
+static int
+__prefetch_warm_destroy(WT_SESSION_IMPL *session)
+{
+    WT_CONNECTION_IMPL *conn;
+    WT_DECL_RET;
+
+    conn = S2C(session);
+
+    if (conn->prefetch_warm_tid_set) {
+        WT_TRET(__wt_thread_join(session, &conn->prefetch_warm_tid));
+        conn->prefetch_warm_tid_set = false;
+    }
+    if (conn->prefetch_warm_session != NULL) {
+        WT_TRET(__wt_session_close_internal(conn->prefetch_warm_session));
+        conn->prefetch_warm_session = NULL;
+    }
+    __wt_atomic_storebool(&conn->prefetch_warm_loading, false);
+    return (ret);
+}
+
 /*
  * __wt_prefetch_create --
  *     Start the pre-fetch server.
@@ -29,6 +469,14 @@ __wt_prefetch_create(WT_SESSION_IMPL *session, const char *cfg[])
     WT_RET(__wt_config_gets(session, cfg, "prefetch.available", &cval));
     conn->prefetch_available = cval.val != 0;
 
+    /* Warm restart queues pages for the pre-fetch threads, it can't work without them. */
+    WT_RET(__wt_config_gets(session, cfg, "prefetch.warm_restart", &cval));
+    conn->prefetch_warm_restart = cval.val != 0;
+    if (conn->prefetch_warm_restart && !conn->prefetch_available)
+        WT_RET_MSG(session, EINVAL, "prefetch.warm_restart requires prefetch.available");
+    WT_RET(__wt_config_gets(session, cfg, "prefetch.warm_restart_pages", &cval));
+    conn->prefetch_warm_pages = (u_int)cval.val;
+
     /*
      * Pre-fetch functionality isn't runtime configurable, so don't bother starting utility threads
      * if it isn't available.
@@ -42,6 +490,8 @@ __wt_prefetch_create(WT_SESSION_IMPL *session, const char *cfg[])
     WT_ERR(__wt_thread_group_create(session, &conn->prefetch_threads, "prefetch-server",
       WT_PREFETCH_THREAD_COUNT, WT_PREFETCH_THREAD_COUNT, session_flags, __wt_prefetch_thread_chk,
       __wt_prefetch_thread_run, NULL));
+
+    WT_ERR(__prefetch_warm_create(session));
     return (0);
 
 err:
@@ -267,6 +717,9 @@ __wt_prefetch_destroy(WT_SESSION_IMPL *session)
 
     F_CLR(conn, WT_CONN_PREFETCH_RUN);
 
+    /* Stop queuing warm restart pages before draining the queue. */
+    WT_TRET(__prefetch_warm_destroy(session));
+
     /* Ensure that the pre-fetch queue is drained. */
     WT_TRET(__wt_conn_prefetch_clear_tree(session, true));
 
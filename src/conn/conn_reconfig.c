@@ -406,6 +406,7 @@ __wt_conn_reconfig(WT_SESSION_IMPL *session, const char **cfg)
     WT_WITH_CHECKPOINT_LOCK(session, ret = __wt_conn_compat_config(session, cfg, true));
     WT_ERR(ret);
     WT_ERR(__wt_blkcache_setup(session, cfg, true));
+    WT_ERR(__wt_blkcache_compressor_config(session, cfg));
     WT_ERR(__wt_chunkcache_reconfig(session, cfg));
     WT_ERR(__wt_conn_optrack_setup(session, cfg, true));
     WT_ERR(__wt_conn_statistics_config(session, cfg));
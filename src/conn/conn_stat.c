@@ -73,6 +73,7 @@ __wt_conn_stat_init(WT_SESSION_IMPL *session)
     conn = S2C(session);
     stats = conn->stats;
 
+    __wt_blkcache_stats_update(session);
     __wt_cache_stats_update(session);
     __wt_txn_stats_update(session);
 
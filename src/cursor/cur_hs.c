@@ -9,7 +9,7 @@
 #include "wt_internal.h"
 
 static int __curhs_file_cursor_next(WT_SESSION_IMPL *, WT_CURSOR *);
-static int __curhs_file_cursor_open(WT_SESSION_IMPL *, WT_CURSOR *, WT_CURSOR **);
+static int __curhs_file_cursor_open(WT_SESSION_IMPL *, const char *, WT_CURSOR *, WT_CURSOR **);
 static int __curhs_file_cursor_prev(WT_SESSION_IMPL *, WT_CURSOR *);
 static int __curhs_file_cursor_search_near(WT_SESSION_IMPL *, WT_CURSOR *, int *);
 static int __curhs_prev_visible(WT_SESSION_IMPL *, WT_CURSOR_HS *);
@@ -20,7 +20,8 @@ static int __curhs_search_near_helper(WT_SESSION_IMPL *, WT_CURSOR *, bool);
  *     Open a new history store table cursor, internal function.
  */
 static int
-__curhs_file_cursor_open(WT_SESSION_IMPL *session, WT_CURSOR *owner, WT_CURSOR **cursorp)
+__curhs_file_cursor_open(
+  WT_SESSION_IMPL *session, const char *uri, WT_CURSOR *owner, WT_CURSOR **cursorp)
 {
     WT_CURSOR *cursor;
     WT_DECL_RET;
@@ -43,7 +44,7 @@ __curhs_file_cursor_open(WT_SESSION_IMPL *session, WT_CURSOR *owner, WT_CURSOR *
         tmp = NULL;
 
     WT_WITHOUT_DHANDLE(
-      session, ret = __wt_open_cursor(session, WT_HS_URI, owner, open_cursor_cfg, &cursor));
+      session, ret = __wt_open_cursor(session, uri, owner, open_cursor_cfg, &cursor));
     WT_ERR(ret);
 
     /* History store cursors should always ignore tombstones. */
@@ -66,6 +67,9 @@ __wt_curhs_cache(WT_SESSION_IMPL *session)
 {
     WT_CONNECTION_IMPL *conn;
     WT_CURSOR *cursor;
+    WT_DECL_RET;
+    uint32_t hs_id;
+    char hs_uri[WT_HS_URI_SIZE];
 
     conn = S2C(session);
 
@@ -93,9 +97,17 @@ __wt_curhs_cache(WT_SESSION_IMPL *session)
       (session->dhandle != NULL && WT_IS_METADATA(S2BT(session)->dhandle)) ||
       session == conn->default_session)
         return (0);
-    WT_RET(__curhs_file_cursor_open(session, NULL, &cursor));
+    WT_RET(__curhs_file_cursor_open(session, WT_HS_URI, NULL, &cursor));
     WT_RET(cursor->close(cursor));
-    return (0);
+
+    /* If the session's tree has a history store of its own, cache a cursor for that one too. */
+    hs_id = session->dhandle == NULL ? 0 : S2BT(session)->hs_id;
+    if (hs_id == 0)
+        return (0);
+    WT_RET(__wt_hs_uri(hs_id, hs_uri, sizeof(hs_uri)));
+    WT_WITHOUT_DHANDLE(session, ret = __curhs_file_cursor_open(session, hs_uri, NULL, &cursor));
+    WT_RET(ret);
+    return (cursor->close(cursor));
 }
 
 /*
@@ -1223,10 +1235,11 @@ __wt_curhs_range_truncate(WT_TRUNCATE_INFO *trunc_info)
 
 /*
  * __wt_curhs_open --
- *     Initialize a history store cursor.
+ *     Initialize a history store cursor. A history store ID of zero opens the shared history
+ *     store, otherwise the history store of the file with that ID.
  */
 int
-__wt_curhs_open(WT_SESSION_IMPL *session, WT_CURSOR *owner, WT_CURSOR **cursorp)
+__wt_curhs_open(WT_SESSION_IMPL *session, uint32_t hs_id, WT_CURSOR *owner, WT_CURSOR **cursorp)
 {
     WT_CURSOR_STATIC_INIT(iface, __wt_cursor_get_key, /* get-key */
       __wt_cursor_get_value,                          /* get-value */
@@ -1255,8 +1268,10 @@ __wt_curhs_open(WT_SESSION_IMPL *session, WT_CURSOR *owner, WT_CURSOR **cursorp)
     WT_CURSOR *cursor;
     WT_CURSOR_HS *hs_cursor;
     WT_DECL_RET;
+    char hs_uri[WT_HS_URI_SIZE];
 
     *cursorp = NULL;
+    WT_RET(__wt_hs_uri(hs_id, hs_uri, sizeof(hs_uri)));
     WT_RET(__wt_calloc_one(session, &hs_cursor));
     ++session->hs_cursor_counter;
     cursor = (WT_CURSOR *)hs_cursor;
@@ -1264,13 +1279,13 @@ __wt_curhs_open(WT_SESSION_IMPL *session, WT_CURSOR *owner, WT_CURSOR **cursorp)
     cursor->session = (WT_SESSION *)session;
     cursor->key_format = WT_HS_KEY_FORMAT;
     cursor->value_format = WT_HS_VALUE_FORMAT;
-    WT_ERR(__wt_strdup(session, WT_HS_URI, &cursor->uri));
+    WT_ERR(__wt_strdup(session, hs_uri, &cursor->uri));
 
     /* Open the file cursor for operations on the regular history store .*/
-    WT_ERR(__curhs_file_cursor_open(session, owner, &hs_cursor->file_cursor));
+    WT_ERR(__curhs_file_cursor_open(session, hs_uri, owner, &hs_cursor->file_cursor));
 
     WT_WITH_BTREE(session, CUR2BT(hs_cursor->file_cursor),
-      ret = __wt_cursor_init(cursor, WT_HS_URI, owner, NULL, cursorp));
+      ret = __wt_cursor_init(cursor, hs_uri, owner, NULL, cursorp));
     WT_ERR(ret);
     WT_TIME_WINDOW_INIT(&hs_cursor->time_window);
     hs_cursor->btree_id = 0;
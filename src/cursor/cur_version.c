@@ -672,7 +672,8 @@ __wt_curversion_open(WT_SESSION_IMPL *session, const char *uri, WT_CURSOR *owner
 
     /* Open the history store cursor for operations on the regular history store .*/
     if (F_ISSET(S2C(session), WT_CONN_HS_OPEN)) {
-        WT_ERR(__wt_curhs_open(session, cursor, &version_cursor->hs_cursor));
+        WT_ERR(__wt_curhs_open(session, CUR2BT(version_cursor->file_cursor)->hs_id, cursor,
+          &version_cursor->hs_cursor));
         F_SET(version_cursor->hs_cursor, WT_CURSTD_HS_READ_COMMITTED);
     } else
         F_SET(version_cursor, WT_CURVERSION_HS_EXHAUSTED);
@@ -0,0 +1,192 @@
+/*-
+ * Copyright (c) 2014-present MongoDB, Inc.
+ * Copyright (c) 2008-2014 WiredTiger, Inc.
+ *	All rights reserved.
+ *
+ * See the file LICENSE for redistribution information.
+ */
+
+#include "wt_internal.h"
+
+/* Stop building a filter if the history store range is this much larger than the filter. */
+#define WT_HS_BLOOM_BUILD_MAX (8 * WT_HS_BLOOM_KEYS)
+
+/*
+ * __hs_bloom_add --
+ *     Add a key to the filter, return if it wasn't already there.
+ */
+static bool
+__hs_bloom_add(WT_HS_BLOOM *bloom, const WT_ITEM *key)
+{
+    uint64_t bit, h1, h2;
+    uint8_t mask;
+    u_int i;
+    bool added;
+
+    added = false;
+    h1 = __wt_hash_fnv64(key->data, key->size);
+    h2 = __wt_hash_city64(key->data, key->size);
+    for (i = 0; i < WT_HS_BLOOM_HASHES; i++, h1 += h2) {
+        bit = h1 % WT_HS_BLOOM_BITS;
+        mask = (uint8_t)(0x01 << (bit & 0x07));
+        if ((__wt_atomic_load8(&bloom->bits[bit >> 3]) & mask) == 0) {
+            (void)__wt_atomic_or_generic(&bloom->bits[bit >> 3], mask);
+            added = true;
+        }
+    }
+    return (added);
+}
+
+/*
+ * __hs_bloom_test --
+ *     Return if a key may be in the filter.
+ */
+static bool
+__hs_bloom_test(WT_HS_BLOOM *bloom, const WT_ITEM *key)
+{
+    uint64_t bit, h1, h2;
+    u_int i;
+
+    h1 = __wt_hash_fnv64(key->data, key->size);
+    h2 = __wt_hash_city64(key->data, key->size);
+    for (i = 0; i < WT_HS_BLOOM_HASHES; i++, h1 += h2) {
+        bit = h1 % WT_HS_BLOOM_BITS;
+        if ((__wt_atomic_load8(&bloom->bits[bit >> 3]) & (0x01 << (bit & 0x07))) == 0)
+            return (false);
+    }
+    return (true);
+}
+
+/*
+ * __hs_bloom_get --
+ *     Return a tree's filter, allocating it if it doesn't yet exist.
+ */
+static int
+__hs_bloom_get(WT_SESSION_IMPL *session, WT_BTREE *btree, WT_HS_BLOOM **bloomp)
+{
+    WT_HS_BLOOM *bloom;
+
+    if ((bloom = __wt_atomic_load_pointer(&btree->hs_bloom)) == NULL) {
+        WT_RET(__wt_calloc_one(session, &bloom));
+        if (!__wt_atomic_cas_ptr(&btree->hs_bloom, NULL, bloom)) {
+            __wt_free(session, bloom);
+            bloom = __wt_atomic_load_pointer(&btree->hs_bloom);
+        }
+    }
+    *bloomp = bloom;
+    return (0);
+}
+
+/*
+ * __hs_bloom_build --
+ *     Add the keys a tree already has in the history store to its filter.
+ */
+static int
+__hs_bloom_build(WT_SESSION_IMPL *session, WT_BTREE *btree, WT_HS_BLOOM *bloom)
+{
+    WT_CURSOR *hs_cursor;
+    WT_DECL_RET;
+    WT_ITEM key;
+    wt_timestamp_t hs_start_ts;
+    uint64_t hs_counter, records;
+    uint32_t btree_id;
+
+    WT_STAT_CONN_DSRC_INCR(session, cache_hs_bloom_build);
+
+    WT_RET(__wt_curhs_open(session, btree->hs_id, NULL, &hs_cursor));
+    F_SET(hs_cursor, WT_CURSTD_HS_READ_ALL);
+
+    /*
+     * Every record matters, including ones not visible to anybody: the filter outlives the search.
+     * Records inserted behind the scan were added to the filter by reconciliation.
+     */
+    records = 0;
+    hs_cursor->set_key(hs_cursor, 1, btree->id);
+    for (ret = __wt_curhs_search_near_after(session, hs_cursor); ret == 0;
+         ret = hs_cursor->next(hs_cursor)) {
+        WT_ERR(hs_cursor->get_key(hs_cursor, &btree_id, &key, &hs_start_ts, &hs_counter));
+        if (btree_id != btree->id)
+            break;
+
+        if (++records > WT_HS_BLOOM_BUILD_MAX ||
+          (__hs_bloom_add(bloom, &key) &&
+            __wt_atomic_add64(&bloom->keys, 1) > WT_HS_BLOOM_KEYS)) {
+            __wt_atomic_store32(&bloom->state, WT_HS_BLOOM_INVALID);
+            break;
+        }
+    }
+    WT_ERR_NOTFOUND_OK(ret, false);
+
+    /* Reconciliation may have found the filter saturated while we were building it. */
+    (void)__wt_atomic_cas32(&bloom->state, WT_HS_BLOOM_BUILDING, WT_HS_BLOOM_VALID);
+
+err:
+    /* Let a later search try again. */
+    if (ret != 0)
+        (void)__wt_atomic_cas32(&bloom->state, WT_HS_BLOOM_BUILDING, WT_HS_BLOOM_INIT);
+    WT_TRET(hs_cursor->close(hs_cursor));
+    return (ret);
+}
+
+/*
+ * __wt_hs_bloom_insert --
+ *     Add a key to a tree's filter before its history is written to the history store.
+ */
+int
+__wt_hs_bloom_insert(WT_SESSION_IMPL *session, WT_BTREE *btree, const WT_ITEM *key)
+{
+    WT_HS_BLOOM *bloom;
+
+    /*
+     * Create the filter if it doesn't exist: a search may be about to build it, and would miss the
+     * record we're inserting if the scan had already passed it.
+     */
+    WT_RET(__hs_bloom_get(session, btree, &bloom));
+    if (__wt_atomic_load32(&bloom->state) == WT_HS_BLOOM_INVALID)
+        return (0);
+
+    /* Once the filter is too full to be useful, stop using it. */
+    if (__hs_bloom_add(bloom, key) && __wt_atomic_add64(&bloom->keys, 1) > WT_HS_BLOOM_KEYS)
+        __wt_atomic_store32(&bloom->state, WT_HS_BLOOM_INVALID);
+    return (0);
+}
+
+/*
+ * __wt_hs_bloom_skip --
+ *     Return if a tree's filter shows there's no history store entry for a key, building the filter
+ *     on first use. Also return if the filter was used and the key may have an entry.
+ */
+int
+__wt_hs_bloom_skip(
+  WT_SESSION_IMPL *session, WT_BTREE *btree, const WT_ITEM *key, bool *skipp, bool *passedp)
+{
+    WT_HS_BLOOM *bloom;
+    uint32_t state;
+
+    *skipp = *passedp = false;
+
+    WT_RET(__hs_bloom_get(session, btree, &bloom));
+    WT_ACQUIRE_READ(state, bloom->state);
+    if (state == WT_HS_BLOOM_INIT &&
+      __wt_atomic_cas32(&bloom->state, WT_HS_BLOOM_INIT, WT_HS_BLOOM_BUILDING)) {
+        WT_RET(__hs_bloom_build(session, btree, bloom));
+        WT_ACQUIRE_READ(state, bloom->state);
+    }
+
+    /* Search the history store while the filter is being built, or if it isn't used. */
+    if (state == WT_HS_BLOOM_VALID) {
+        *passedp = __hs_bloom_test(bloom, key);
+        *skipp = !*passedp;
+    }
+    return (0);
+}
+
+/*
+ * __wt_hs_bloom_free --
+ *     Discard a tree's filter.
+ */
+void
+__wt_hs_bloom_free(WT_SESSION_IMPL *session, WT_BTREE *btree)
+{
+    __wt_free(session, btree->hs_bloom);
+}
@@ -64,13 +64,113 @@ __wt_hs_get_btree(WT_SESSION_IMPL *session, WT_BTREE **hs_btreep)
 
     *hs_btreep = NULL;
 
-    WT_RET(__wt_curhs_open(session, NULL, &hs_cursor));
+    WT_RET(__wt_curhs_open(session, 0, NULL, &hs_cursor));
     *hs_btreep = __wt_curhs_get_btree(hs_cursor);
     WT_ASSERT(session, *hs_btreep != NULL);
     WT_TRET(hs_cursor->close(hs_cursor));
     return (ret);
 }
 
+/*
+ * __wt_hs_uri --
+ *     Return the URI of a history store: the shared history store for an ID of zero, otherwise the
+ *     history store of the file with that ID.
+ */
+int
+__wt_hs_uri(uint32_t hs_id, char *buf, size_t len)
+{
+    if (hs_id == 0)
+        return (__wt_snprintf(buf, len, "%s", WT_HS_URI));
+    return (__wt_snprintf(buf, len, "%s%" PRIu32 ".wt", WT_HS_URI_PREFIX, hs_id));
+}
+
+/*
+ * __wt_hs_cache_dhandle --
+ *     Make sure the history store with the given ID is in the session's data handle cache, without
+ *     waiting on the handle list lock.
+ */
+int
+__wt_hs_cache_dhandle(WT_SESSION_IMPL *session, uint32_t hs_id)
+{
+    char hs_uri[WT_HS_URI_SIZE];
+
+    WT_RET(__wt_hs_uri(hs_id, hs_uri, sizeof(hs_uri)));
+    return (__wt_session_try_cache_dhandle(session, hs_uri));
+}
+
+/*
+ * __wt_hs_id_config --
+ *     Return the ID of the history store holding a file's history, given the file's metadata.
+ */
+int
+__wt_hs_id_config(WT_SESSION_IMPL *session, const char *config, uint32_t *hs_idp)
+{
+    WT_CONFIG_ITEM cval;
+    WT_DECL_RET;
+
+    *hs_idp = 0;
+
+    /* The history store is not available for in-memory configurations. */
+    if (F_ISSET(S2C(session), WT_CONN_IN_MEMORY))
+        return (0);
+
+    /* Files created before history stores could be separate don't have the setting. */
+    WT_RET_NOTFOUND_OK(ret = __wt_config_getones(session, config, "history_store.separate", &cval));
+    if (ret == WT_NOTFOUND || cval.val == 0)
+        return (0);
+
+    WT_RET(__wt_config_getones(session, config, "id", &cval));
+    *hs_idp = (uint32_t)cval.val;
+    return (0);
+}
+
+/*
+ * __wt_hs_separate_ids --
+ *     Return an allocated list of the IDs of files with a history store of their own, terminated by
+ *     a zero ID, or NULL if there are none.
+ */
+int
+__wt_hs_separate_ids(WT_SESSION_IMPL *session, uint32_t **idsp)
+{
+    WT_CURSOR *cursor;
+    WT_DECL_RET;
+    size_t allocated, cnt;
+    uint32_t hs_id, *ids;
+    int exact;
+    const char *uri;
+
+    *idsp = ids = NULL;
+    allocated = cnt = 0;
+
+    /* The history store files sort together in the metadata. */
+    WT_RET(__wt_metadata_cursor(session, &cursor));
+    cursor->set_key(cursor, WT_HS_URI_PREFIX);
+    if ((ret = cursor->search_near(cursor, &exact)) == 0 && exact < 0)
+        ret = cursor->next(cursor);
+    for (; ret == 0; ret = cursor->next(cursor)) {
+        WT_ERR(cursor->get_key(cursor, &uri));
+        if (!WT_IS_HS_URI(uri))
+            break;
+
+        /* Skip the shared history store. */
+        if (sscanf(uri + strlen(WT_HS_URI_PREFIX), "%" SCNu32 ".wt", &hs_id) != 1 || hs_id == 0)
+            continue;
+
+        WT_ERR(__wt_realloc_def(session, &allocated, cnt + 2, &ids));
+        ids[cnt++] = hs_id;
+        ids[cnt] = 0;
+    }
+    WT_ERR_NOTFOUND_OK(ret, false);
+
+    *idsp = ids;
+    ids = NULL;
+
+err:
+    WT_TRET(__wt_metadata_cursor_release(session, &cursor));
+    __wt_free(session, ids);
+    return (ret);
+}
+
 /*
  * __wt_hs_config --
  *     Configure the history store table.
@@ -65,7 +65,7 @@ __wt_hs_find_upd(WT_SESSION_IMPL *session, uint32_t btree_id, WT_ITEM *key,
     wt_timestamp_t hs_stop_durable_ts, hs_stop_durable_ts_tmp, read_timestamp;
     uint64_t upd_type_full;
     uint8_t *p, recno_key_buf[WT_INTPACK64_MAXSIZE], upd_type;
-    bool upd_found;
+    bool bloom_passed, bloom_skip, upd_found;
 
     hs_cursor = NULL;
     mod_upd = NULL;
@@ -73,7 +73,7 @@ __wt_hs_find_upd(WT_SESSION_IMPL *session, uint32_t btree_id, WT_ITEM *key,
     WT_CLEAR(hs_key);
     __wt_update_vector_init(session, &modifies);
     txn_shared = WT_SESSION_TXN_SHARED(session);
-    upd_found = false;
+    bloom_passed = upd_found = false;
 
     WT_STAT_CONN_DSRC_INCR(session, cursor_search_hs);
 
@@ -102,7 +102,19 @@ __wt_hs_find_upd(WT_SESSION_IMPL *session, uint32_t btree_id, WT_ITEM *key,
         goto done;
     }
 
-    WT_ERR_NOTFOUND_OK(__wt_curhs_open(session, NULL, &hs_cursor), true);
+    /*
+     * Skip the search if the tree's filter shows the key has no history. The filter describes the
+     * current history store, a checkpoint's history store can hold history since removed.
+     */
+    if (!WT_READING_CHECKPOINT(session)) {
+        WT_ERR(__wt_hs_bloom_skip(session, S2BT(session), key, &bloom_skip, &bloom_passed));
+        if (bloom_skip) {
+            WT_STAT_CONN_DSRC_INCR(session, cache_hs_bloom_skip);
+            goto done;
+        }
+    }
+
+    WT_ERR_NOTFOUND_OK(__wt_curhs_open(session, S2BT(session)->hs_id, NULL, &hs_cursor), true);
     /* Do this separately for now because the behavior below is confusing if it triggers. */
     WT_ASSERT(session, ret != WT_NOTFOUND);
     WT_ERR(ret);
@@ -125,6 +137,8 @@ __wt_hs_find_upd(WT_SESSION_IMPL *session, uint32_t btree_id, WT_ITEM *key,
     hs_cursor->set_key(hs_cursor, 4, btree_id, key, read_timestamp, UINT64_MAX);
     WT_ERR_NOTFOUND_OK(__wt_curhs_search_near_before(session, hs_cursor), true);
     if (ret == WT_NOTFOUND) {
+        if (bloom_passed)
+            WT_STAT_CONN_DSRC_INCR(session, cache_hs_bloom_false_positive);
         ret = 0;
         goto done;
     }
@@ -193,6 +207,7 @@ __wt_hs_find_upd(WT_SESSION_IMPL *session, uint32_t btree_id, WT_ITEM *key,
             upd_type = (uint8_t)upd_type_full;
         }
         WT_ASSERT(session, upd_type == WT_UPDATE_STANDARD);
+        WT_STAT_CONN_DSRC_INCRV(session, cache_hs_read_squash_modify, modifies.size);
         while (modifies.size > 0) {
             __wt_update_vector_pop(&modifies, &mod_upd);
             WT_ERR(__wt_modify_apply_item(session, value_format, hs_value, mod_upd->data));
@@ -335,8 +335,6 @@ __wt_hs_insert_updates(WT_SESSION_IMPL *session, WT_RECONCILE *r, WT_MULTI *mult
     WT_DECL_ITEM(prev_full_value);
     WT_DECL_ITEM(tmp);
     WT_DECL_RET;
-/* Limit the number of consecutive reverse modifies. */
-#define WT_MAX_CONSECUTIVE_REVERSE_MODIFY 10
 /* If the limit is exceeded, we will insert a full update to the history store */
 #define MAX_REVERSE_MODIFY_NUM 16
     WT_MODIFY entries[MAX_REVERSE_MODIFY_NUM];
@@ -346,7 +344,8 @@ __wt_hs_insert_updates(WT_SESSION_IMPL *session, WT_RECONCILE *r, WT_MULTI *mult
     WT_TIME_WINDOW tw;
     wt_off_t hs_size;
     uint64_t insert_cnt, max_hs_size, modify_cnt;
-    uint64_t cache_hs_insert_full_update, cache_hs_insert_reverse_modify, cache_hs_write_squash;
+    uint64_t cache_hs_insert_full_update, cache_hs_insert_reverse_modify;
+    uint64_t cache_hs_insert_reverse_modify_saved, cache_hs_write_squash;
     uint32_t i;
     int nentries;
     bool enable_reverse_modify, error_on_ts_ordering, hs_inserted, squashed;
@@ -357,9 +356,10 @@ __wt_hs_insert_updates(WT_SESSION_IMPL *session, WT_RECONCILE *r, WT_MULTI *mult
     WT_TIME_WINDOW_INIT(&tw);
     insert_cnt = 0;
     error_on_ts_ordering = F_ISSET(r, WT_REC_CHECKPOINT_RUNNING);
-    cache_hs_insert_full_update = cache_hs_insert_reverse_modify = cache_hs_write_squash = 0;
+    cache_hs_insert_full_update = cache_hs_insert_reverse_modify = 0;
+    cache_hs_insert_reverse_modify_saved = cache_hs_write_squash = 0;
 
-    WT_RET(__wt_curhs_open(session, NULL, &hs_cursor));
+    WT_RET(__wt_curhs_open(session, btree->hs_id, NULL, &hs_cursor));
     F_SET(hs_cursor, WT_CURSTD_HS_READ_COMMITTED);
 
     __wt_update_vector_init(session, &updates);
@@ -395,6 +395,7 @@ __wt_hs_insert_updates(WT_SESSION_IMPL *session, WT_RECONCILE *r, WT_MULTI *mult
 
         /* History store table key component: source key. */
         WT_ERR(__hs_pack_key(session, btree, r, list->ins, list->rip, key));
+        WT_ERR(__wt_hs_bloom_insert(session, btree, key));
 
         no_ts_upd = newest_hs = NULL;
         ref_upd = list->onpage_upd;
@@ -690,13 +691,15 @@ __wt_hs_insert_updates(WT_SESSION_IMPL *session, WT_RECONCILE *r, WT_MULTI *mult
              */
             nentries = MAX_REVERSE_MODIFY_NUM;
             if (upd != newest_hs && enable_reverse_modify &&
-              modify_cnt < WT_MAX_CONSECUTIVE_REVERSE_MODIFY &&
+              modify_cnt < btree->hs_reverse_modify_max &&
               __wt_calc_modify(session, prev_full_value, full_value, prev_full_value->size / 10,
                 entries, &nentries) == 0) {
                 WT_ERR(__wt_modify_pack(hs_cursor, entries, nentries, &modify_value));
                 WT_ERR(__hs_insert_record(session, hs_cursor, btree, key, WT_UPDATE_MODIFY,
                   modify_value, &tw, error_on_ts_ordering));
                 ++cache_hs_insert_reverse_modify;
+                if (full_value->size > modify_value->size)
+                    cache_hs_insert_reverse_modify_saved += full_value->size - modify_value->size;
                 __wt_scr_free(session, &modify_value);
                 ++modify_cnt;
             } else {
@@ -757,6 +760,8 @@ err:
     WT_STAT_CONN_DSRC_INCRV(session, cache_hs_insert_full_update, cache_hs_insert_full_update);
     WT_STAT_CONN_DSRC_INCRV(
       session, cache_hs_insert_reverse_modify, cache_hs_insert_reverse_modify);
+    WT_STAT_CONN_DSRC_INCRV(
+      session, cache_hs_insert_reverse_modify_saved, cache_hs_insert_reverse_modify_saved);
     WT_STAT_CONN_DSRC_INCRV(session, cache_hs_write_squash, cache_hs_write_squash);
 
     return (ret);
@@ -997,7 +1002,7 @@ __hs_delete_reinsert_from_pos(WT_SESSION_IMPL *session, WT_CURSOR *hs_cursor, ui
              * case, we'll never get here.
              */
             if (hs_insert_cursor == NULL)
-                WT_ERR(__wt_curhs_open(session, NULL, &hs_insert_cursor));
+                WT_ERR(__wt_curhs_open(session, S2BT(session)->hs_id, NULL, &hs_insert_cursor));
 
             /*
              * If these history store records are resolved prepared updates, their durable
@@ -1091,7 +1096,7 @@ __hs_delete_record(
     WT_TIME_WINDOW *hs_tw;
 
     if (r->hs_cursor == NULL)
-        WT_RET(__wt_curhs_open(session, NULL, &r->hs_cursor));
+        WT_RET(__wt_curhs_open(session, S2BT(session)->hs_id, NULL, &r->hs_cursor));
     hs_read_committed = F_ISSET(r->hs_cursor, WT_CURSTD_HS_READ_COMMITTED);
     /* Ensure we can see all the content in the history store. */
     F_SET(r->hs_cursor, WT_CURSTD_HS_READ_COMMITTED);
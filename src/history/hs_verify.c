@@ -110,7 +110,7 @@ __wt_hs_verify_one(WT_SESSION_IMPL *session, uint32_t btree_id)
 
     hs_cursor = NULL;
 
-    WT_ERR(__wt_curhs_open(session, NULL, &hs_cursor));
+    WT_ERR(__wt_curhs_open(session, S2BT(session)->hs_id, NULL, &hs_cursor));
     F_SET(hs_cursor, WT_CURSTD_HS_READ_COMMITTED);
 
     /* Position the hs cursor on the requested btree id, there could be nothing in the HS yet. */
@@ -141,12 +141,11 @@ err:
 }
 
 /*
- * __wt_hs_verify --
- *     Verify the history store. There can't be an entry in the history store without having the
- *     latest value for the respective key in the data store.
+ * __hs_verify_store --
+ *     Verify one history store, the shared history store or the history store of a single file.
  */
-int
-__wt_hs_verify(WT_SESSION_IMPL *session)
+static int
+__hs_verify_store(WT_SESSION_IMPL *session, uint32_t hs_id)
 {
     WT_CURSOR *ds_cursor, *hs_cursor;
     WT_DECL_ITEM(buf);
@@ -165,7 +164,7 @@ __wt_hs_verify(WT_SESSION_IMPL *session)
     uri_data = NULL;
 
     WT_ERR(__wt_scr_alloc(session, 0, &buf));
-    WT_ERR(__wt_curhs_open(session, NULL, &hs_cursor));
+    WT_ERR(__wt_curhs_open(session, hs_id, NULL, &hs_cursor));
     F_SET(hs_cursor, WT_CURSTD_HS_READ_COMMITTED);
 
     /* Position the hs cursor on the first record. */
@@ -214,3 +213,26 @@ err:
         WT_TRET(hs_cursor->close(hs_cursor));
     return (ret);
 }
+
+/*
+ * __wt_hs_verify --
+ *     Verify the history stores. There can't be an entry in a history store without having the
+ *     latest value for the respective key in the data store.
+ */
+int
+__wt_hs_verify(WT_SESSION_IMPL *session)
+{
+    WT_DECL_RET;
+    size_t i;
+    uint32_t *hs_ids;
+
+    WT_RET(__hs_verify_store(session, 0));
+
+    WT_RET(__wt_hs_separate_ids(session, &hs_ids));
+    for (i = 0; hs_ids != NULL && hs_ids[i] != 0; ++i)
+        WT_ERR(__hs_verify_store(session, hs_ids[i]));
+
+err:
+    __wt_free(session, hs_ids);
+    return (ret);
+}
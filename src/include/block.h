@@ -41,6 +41,12 @@
  *
  * One final complication: we only maintain the per-size skiplist for the avail
  * list, the alloc and discard extent lists are not searched based on size.
+ *
+ * When segregated size-class allocation is configured, the live avail list
+ * replaces the by-size skiplist with a WT_SIZE_CLASS structure: extents are
+ * binned by the base-2 logarithm of their size, each bin is a by-offset
+ * skiplist using the same WT_EXT.next[WT_EXT.depth] entries the per-size
+ * lists use, and a bitmap records which bins are non-empty.
  */
 
 /*
@@ -64,6 +70,8 @@ struct __wt_extlist {
 
     WT_EXT *off[WT_SKIP_MAXDEPTH]; /* Size/offset skiplists */
     WT_SIZE *sz[WT_SKIP_MAXDEPTH];
+
+    WT_SIZE_CLASS *szc; /* Segregated size classes */
 };
 
 /*
@@ -104,6 +112,19 @@ struct __wt_size {
     WT_SIZE *next[WT_SKIP_MAXDEPTH]; /* Size skiplist */
 };
 
+/*
+ * WT_SIZE_CLASS --
+ *	Segregated size-class lists for an extent list: extents of size [2^N, 2^(N+1)) are on the
+ * Nth per-class offset skiplist.
+ */
+#define WT_BLOCK_SIZE_CLASSES 64
+#define WT_BLOCK_SIZE_CLASS_PROBE 8 /* Own-class extents checked before a larger class */
+struct __wt_size_class {
+    uint64_t bitmap; /* Non-empty classes */
+
+    WT_EXT *off[WT_BLOCK_SIZE_CLASSES][WT_SKIP_MAXDEPTH]; /* Per-class offset skiplists */
+};
+
 /*
  * WT_EXT_FOREACH --
  *	Walk a block manager skiplist.
@@ -132,6 +153,7 @@ struct __wt_size {
  * Version #1 checkpoint cookie format:
  *	[1] [root addr] [alloc addr] [avail addr] [discard addr]
  *	    [file size] [checkpoint size] [write generation]
+ *	    optionally followed by a flags byte, [object ID] and [avail base addr]
  */
 #define WT_BM_CHECKPOINT_VERSION 1   /* Checkpoint format version */
 #define WT_BLOCK_EXTLIST_MAGIC 71002 /* Identify a list */
@@ -143,11 +165,20 @@ struct __wt_size {
 #define WT_BLOCK_EXTLIST_VERSION_ORIG 0 /* Original version */
 #define WT_BLOCK_EXTLIST_VERSION_CKPT 1 /* Checkpoint in avail output */
 
+/*
+ * The live system's avail list can be written incrementally, as the changes against a base list
+ * written by an earlier checkpoint. Incremental lists have a different value in the initial magic
+ * pair (so releases that don't understand them fail rather than misread them), then the ranges
+ * added since the base was written, a WT_BLOCK_EXTLIST_MAGIC/0 pair, and the ranges removed since
+ * the base was written. The base list's address is stored in the checkpoint cookie.
+ */
+#define WT_BLOCK_EXTLIST_INCREMENTAL 1 /* Changes against a base list */
+
 /*
  * Maximum buffer required to store a checkpoint: 1 version byte followed by
- * 14 packed 8B values.
+ * 14 packed 8B values, then a flags byte followed by 4 packed 8B values.
  */
-#define WT_BLOCK_CHECKPOINT_BUFFER (1 + 14 * WT_INTPACK64_MAXSIZE)
+#define WT_BLOCK_CHECKPOINT_BUFFER (2 + 18 * WT_INTPACK64_MAXSIZE)
 
 struct __wt_block_ckpt {
     uint8_t version; /* Version */
@@ -165,6 +196,12 @@ struct __wt_block_ckpt {
 
     WT_EXTLIST ckpt_avail; /* Checkpoint free'd extents */
 
+    /*
+     * The base of an incremental avail list. For the live system, this is also a copy of the list
+     * as it was written, the changes in the next checkpoint are calculated against it.
+     */
+    WT_EXTLIST avail_base; /* Incremental avail list base */
+
     /*
      * Checkpoint archive: the block manager may potentially free a lot of memory from the
      * allocation and discard extent lists when checkpoint completes. Put it off until the
@@ -268,6 +305,9 @@ struct __wt_block {
 
     /* Configuration information, set when the file is opened. */
     wt_shared uint32_t allocfirst; /* Allocation is first-fit */
+    bool allocsizeclass;           /* Allocation uses segregated size classes */
+    bool extlist_incremental;      /* Checkpoint avail lists are incremental */
+    u_int extlist_consolidate;     /* Incremental avail list consolidation percentage */
     uint32_t allocsize;            /* Allocation size */
     size_t os_cache;               /* System buffer cache flush max */
     size_t os_cache_max;
@@ -291,6 +331,21 @@ struct __wt_block {
 
     WT_CKPT *final_ckpt; /* Final live checkpoint write */
 
+/*
+ * Checkpoints write adjacent blocks through a per-file batch, flushed when it fills, when a block
+ * doesn't follow it, and before anything that depends on the blocks being on disk.
+ */
+#define WT_BLOCK_WRITE_BATCH_MAX (256 * WT_KILOBYTE)
+    WT_SPINLOCK write_batch_lock;      /* Write batch lock */
+    WT_ITEM write_batch;               /* Write batch buffer */
+    wt_off_t write_batch_off;          /* Write batch file offset */
+    wt_shared size_t write_batch_size; /* Write batch length */
+
+    /* Chunk cache read-ahead: sequential reads of the object are detected here. */
+    wt_shared wt_off_t chunkcache_last;  /* Offset of the last chunk read */
+    wt_shared wt_off_t chunkcache_ahead; /* End of the chunks queued for read-ahead */
+    wt_shared u_int chunkcache_seq;      /* Consecutive chunks read */
+
     /* Compaction support */
     bool compact_estimated;                    /* If compaction work has been estimated */
     int compact_pct_tenths;                    /* Percent to compact */
@@ -27,6 +27,17 @@
 #define WT_BLKCACHE_HASHSIZE_MIN 512
 #define WT_BLKCACHE_HASHSIZE_MAX WT_GIGABYTE
 
+/*
+ * Each hash bucket holds a fixed number of blocks. The bucket array is never sized smaller than
+ * needed to hold a full cache of blocks of the expected minimum size.
+ */
+#define WT_BLKCACHE_BUCKET_SLOTS 8
+#define WT_BLKCACHE_BUCKET_BLOCK_SIZE (16 * WT_KILOBYTE)
+
+/* Item metadata is allocated in slabs, address cookies are stored in the item. */
+#define WT_BLKCACHE_SLAB_ITEMS 1024
+#define WT_BLKCACHE_ADDR_MAX 48
+
 /* How often we compute the total size of the files open in the block manager. */
 #define WT_BLKCACHE_FILESIZE_EST_FREQ (5 * WT_THOUSAND)
 
@@ -34,6 +45,21 @@
 #define WT_BLKCACHE_EVICT_OTHER 0            /* Not evicting for various reasons */
 #define WT_BLKCACHE_NOT_EVICTION_CANDIDATE 1 /* Not evicting because of frequency counter */
 
+/*
+ * Admission filter: a count-min sketch of recent block accesses. Counters saturate at 15 and are
+ * halved once the number of recorded accesses reaches a multiple of the sample size, so the sketch
+ * reflects recent popularity rather than all-time popularity.
+ */
+#define WT_BLKCACHE_ADMIT_NONE 0
+#define WT_BLKCACHE_ADMIT_TINYLFU 1
+
+#define WT_BLKCACHE_SKETCH_BLOCK_SIZE (4 * WT_KILOBYTE) /* Expected block size for sizing */
+#define WT_BLKCACHE_SKETCH_DEPTH 4                      /* Rows (hash functions) */
+#define WT_BLKCACHE_SKETCH_MAX 15                       /* Saturating counter value */
+#define WT_BLKCACHE_SKETCH_SAMPLE 10                    /* Accesses per counter before aging */
+#define WT_BLKCACHE_SKETCH_WIDTH_MIN 1024
+#define WT_BLKCACHE_SKETCH_WIDTH_MAX (16 * WT_MILLION)
+
 /* Block access operations. */
 #define WT_BLKCACHE_RM_EXIT 1
 #define WT_BLKCACHE_RM_FREE 2
@@ -41,13 +67,15 @@
 
 /*
  * WT_BLKCACHE_ITEM --
- *     Block cache item. It links with other items in the same hash bucket.
+ *     Block cache item. Items are allocated from slabs and are never returned to the system while
+ *     the cache exists, so a reader that raced with the item's removal can still safely read it.
  */
 struct __wt_blkcache_item {
-    TAILQ_ENTRY(__wt_blkcache_item) hashq;
+    WT_BLKCACHE_ITEM *next_free; /* Slab free list */
 
     void *data;
     uint32_t data_size;
+    uint32_t mem_size; /* Uncompressed size, 0 if the block is stored uncompressed */
     uint32_t num_references;
 
     /*
@@ -62,7 +90,31 @@ struct __wt_blkcache_item {
 
     uint32_t fid;      /* File ID */
     uint8_t addr_size; /* Address cookie */
-    uint8_t addr[];
+    uint8_t addr[WT_BLKCACHE_ADDR_MAX];
+};
+
+/*
+ * WT_BLKCACHE_BUCKET --
+ *     A block cache hash bucket: a fixed-size, open-addressed group of slots. Each block hashes to
+ *     two buckets and is stored in whichever had a free slot. Writers hold the bucket lock and make
+ *     the sequence number odd while they modify the slots. Readers don't lock: they search the
+ *     slots, pin the item they find, and retry if the sequence number changed in the meantime.
+ */
+struct __wt_blkcache_bucket {
+    WT_SPINLOCK lock;
+    wt_shared volatile uint64_t seq; /* Odd while the slots are being modified */
+
+    uint64_t hash[WT_BLKCACHE_BUCKET_SLOTS];
+    wt_shared WT_BLKCACHE_ITEM *volatile item[WT_BLKCACHE_BUCKET_SLOTS];
+};
+
+/*
+ * WT_BLKCACHE_SLAB --
+ *     A slab of block cache items.
+ */
+struct __wt_blkcache_slab {
+    WT_BLKCACHE_SLAB *next;
+    WT_BLKCACHE_ITEM items[WT_BLKCACHE_SLAB_ITEMS];
 };
 
 /*
@@ -71,9 +123,14 @@ struct __wt_blkcache_item {
  * and the total amount of space they occupy.
  */
 struct __wt_blkcache {
-    /* Locked: Block manager cache. Locks are per-bucket. */
-    TAILQ_HEAD(__wt_blkcache_hash, __wt_blkcache_item) * hash;
-    WT_SPINLOCK *hash_locks;
+    /* Block manager cache. Writers lock per-bucket, readers use the bucket sequence numbers. */
+    WT_BLKCACHE_BUCKET *buckets;
+    uint64_t bucket_count; /* Number of hash buckets */
+
+    /* Locked: Item slabs and free list. */
+    WT_SPINLOCK slab_lock;
+    WT_BLKCACHE_SLAB *slabs;
+    WT_BLKCACHE_ITEM *free_items;
 
     wt_thread_t evict_thread_tid;
     wt_shared volatile bool blkcache_exiting; /* If destroying the cache */
@@ -82,6 +139,16 @@ struct __wt_blkcache {
     bool cache_on_checkpoint; /* Don't cache blocks written by checkpoints */
     bool cache_on_writes;     /* Cache blocks on writes */
 
+    /*
+     * Compressed tier: with a compressor configured, blocks are stored compressed when it saves
+     * space and decompressed on every hit. A compressed block that is read often enough is stored
+     * uncompressed again, as long as the cache has free space.
+     */
+    WT_COMPRESSOR *compressor;        /* Block compressor */
+    char *compressor_name;            /* Block compressor name */
+    u_int promote_references;         /* References before a block is stored uncompressed */
+    wt_shared uint64_t bytes_logical; /* Uncompressed bytes in the block cache */
+
 #ifdef ENABLE_MEMKIND
     struct memkind *pmem_kind; /* NVRAM connection */
 #endif
@@ -105,7 +172,7 @@ struct __wt_blkcache {
      */
     u_int percent_file_in_os_cache;
 
-    u_int hash_size;               /* Number of block cache hash buckets */
+    u_int hash_size;               /* Configured number of block cache hash buckets */
     u_int type;                    /* Type of block cache (NVRAM or DRAM) */
     wt_shared uint64_t bytes_used; /* Bytes in the block cache */
     uint64_t max_bytes;            /* Block cache size */
@@ -113,6 +180,19 @@ struct __wt_blkcache {
 
     uint32_t min_num_references; /* The per-block number of references triggering eviction. */
 
+    /*
+     * W-TinyLFU admission filter. Until the cache reaches its eviction target every block is
+     * admitted, that free space plays the part of the admission window. Once the cache is full, a
+     * block read from disk is only admitted if the sketch estimates it to be more popular than the
+     * coldest block in the hash bucket it would be inserted into, which keeps a scan from flushing
+     * frequently used blocks. Sketch updates race, the counters are only estimates.
+     */
+    u_int admission;                    /* Admission policy */
+    uint8_t *sketch;                    /* Count-min sketch, depth rows of width counters */
+    uint64_t sketch_mask;               /* Sketch width - 1 */
+    uint64_t sketch_sample;             /* Accesses between agings */
+    wt_shared uint64_t sketch_accesses; /* Accesses recorded */
+
     /*
      * Various metrics helping us measure the overhead and decide if to bypass the cache. We access
      * some of them without synchronization despite races. These serve as heuristics, and we don't
@@ -121,6 +201,7 @@ struct __wt_blkcache {
      * remain roughly accurate. We care about the ratio.
      */
     uint64_t lookups;
+    uint64_t hits;
     uint64_t inserts;
     uint64_t removals;
 
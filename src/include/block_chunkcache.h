@@ -33,6 +33,15 @@ struct __wt_chunkcache_metadata_work_unit {
     size_t data_sz;
 };
 
+/* A chunk queued for read-ahead. The work unit holds a reference to the object's block handle. */
+struct __wt_chunkcache_prefetch_work_unit {
+    TAILQ_ENTRY(__wt_chunkcache_prefetch_work_unit) q;
+    WT_BLOCK *block;
+    char *name;
+    uint32_t objectid;
+    wt_off_t offset;
+};
+
 struct __wt_chunkcache_hashid {
     const char *objectname;
     uint32_t objectid;
@@ -64,6 +73,7 @@ struct __wt_chunkcache_chunk {
 /* AUTOMATIC FLAG VALUE GENERATION START 0 */
 #define WT_CHUNK_FROM_METADATA 0x1u
 #define WT_CHUNK_PINNED 0x2u
+#define WT_CHUNK_PREFETCHED 0x4u
     /* AUTOMATIC FLAG VALUE GENERATION STOP 8 */
     uint8_t flags;
 };
@@ -118,6 +128,20 @@ struct __wt_chunkcache {
     wt_thread_t evict_thread_tid;
     unsigned int evict_trigger; /* When this percent of cache is full, we trigger eviction. */
     WT_CHUNKCACHE_PINNED_LIST pinned_objects;
+    WT_CONDVAR *evict_cond; /* Wakes the chunk cache thread */
+
+    /*
+     * Read-ahead. Once an object has been read sequentially across this many chunks, the chunks
+     * following the read are queued, and the chunk cache thread reads them in. Reads within the
+     * window behind the furthest chunk read don't interrupt a sequential run.
+     */
+#define WT_CHUNKCACHE_PREFETCH_TRIGGER 2
+#define WT_CHUNKCACHE_PREFETCH_WINDOW 2
+#define WT_CHUNKCACHE_PREFETCH_QUEUE_MAX 256
+    TAILQ_HEAD(__wt_chunkcache_prefetch_qh, __wt_chunkcache_prefetch_work_unit) prefetch_qh;
+    WT_SPINLOCK prefetch_lock;             /* Read-ahead queue lock */
+    wt_shared uint32_t prefetch_queue_len; /* Read-ahead queue length */
+    u_int prefetch_chunks;                 /* Chunks to read ahead */
 
 /* AUTOMATIC FLAG VALUE GENERATION START 0 */
 #define WT_CHUNKCACHE_CONFIGURED 0x1u
@@ -318,6 +318,13 @@ struct __wt_page_modify {
     uint64_t obsolete_check_txn;
     wt_timestamp_t obsolete_check_timestamp;
 
+    /*
+     * Readers that were walking an update chain when it was consolidated can still be reading the
+     * updates the consolidated value replaced: don't truncate update chains on the page until the
+     * transaction ID current at the time is visible to everyone.
+     */
+    uint64_t consolidate_txn;
+
     /* The largest transaction seen on the page by reconciliation. */
     uint64_t rec_max_txn;
     wt_timestamp_t rec_max_timestamp;
@@ -93,6 +93,27 @@ typedef enum { /* Start position for eviction walk */
 /* An invalid btree file ID value. ID 0 is reserved for the metadata file. */
 #define WT_BTREE_ID_INVALID UINT32_MAX
 
+/*
+ * WT_HS_BLOOM --
+ *	An in-memory Bloom filter over the keys of a tree that have history store entries. History
+ * store searches for keys not in the filter can't find anything and are skipped. The filter is
+ * built from the history store on first use and then maintained by reconciliation as it writes
+ * the history store. Keys are never removed, removing history only costs false positives.
+ */
+#define WT_HS_BLOOM_BITS (128 * 1024)            /* Filter size in bits */
+#define WT_HS_BLOOM_HASHES 4                     /* Hash values per key */
+#define WT_HS_BLOOM_KEYS (WT_HS_BLOOM_BITS / 10) /* Keys before the filter saturates */
+struct __wt_hs_bloom {
+#define WT_HS_BLOOM_INIT 0     /* Not yet built */
+#define WT_HS_BLOOM_BUILDING 1 /* Being built from the history store */
+#define WT_HS_BLOOM_VALID 2    /* Usable */
+#define WT_HS_BLOOM_INVALID 3  /* Saturated, no longer used */
+    wt_shared uint32_t state;
+    wt_shared uint64_t keys; /* Keys added */
+
+    wt_shared uint8_t bits[WT_HS_BLOOM_BITS / 8];
+};
+
 /*
  * WT_BTREE --
  *	A btree handle.
@@ -112,7 +133,8 @@ struct __wt_btree {
     WT_COLLATOR *collator; /* Row-store comparator */
     int collator_owned;    /* The collator needs to be freed */
 
-    uint32_t id; /* File ID, for logging */
+    uint32_t id;    /* File ID, for logging */
+    uint32_t hs_id; /* History store ID: the file ID if it has its own, else 0 */
 
     uint32_t allocsize;             /* Allocation size */
     wt_shared uint32_t maxintlpage; /* Internal page max size */
@@ -165,8 +187,10 @@ struct __wt_btree {
     wt_shared uint8_t original; /* Newly created: bulk-load possible
                          (want a bool but needs atomic cas) */
 
-    bool hs_entries;  /* Has entries in the history store table */
-    bool lsm_primary; /* Handle is/was the LSM primary */
+    bool hs_entries;                 /* Has entries in the history store table */
+    wt_shared WT_HS_BLOOM *hs_bloom; /* History store key filter */
+    u_int hs_reverse_modify_max;     /* Consecutive history store deltas */
+    bool lsm_primary;                /* Handle is/was the LSM primary */
 
     WT_BM *bm;          /* Block manager reference */
     u_int block_header; /* WT_PAGE_HEADER_BYTE_SIZE */
@@ -71,4 +71,11 @@ struct __wt_capacity {
     wt_shared uint64_t reservation_log;        /* Atomic: next logging write */
     wt_shared uint64_t reservation_read;       /* Atomic: next read */
     wt_shared uint64_t reservation_total;      /* Atomic: next operation of any kind */
+
+    /*
+     * A paced checkpoint writes at the rate needed to write the remaining dirty data by its target
+     * completion time, in nanoseconds since the epoch, independent of the configured capacity.
+     */
+    wt_shared uint64_t ckpt_pace_end;         /* Paced checkpoint target, 0 if not pacing */
+    wt_shared uint64_t reservation_ckpt_pace; /* Atomic: next paced checkpoint write */
 };
@@ -142,7 +142,7 @@ WT_CONF_API_DECLARE(WT_CONNECTION, debug_info, 1, 7);
 WT_CONF_API_DECLARE(WT_CONNECTION, load_extension, 1, 4);
 WT_CONF_API_DECLARE(WT_CONNECTION, open_session, 3, 9);
 WT_CONF_API_DECLARE(WT_CONNECTION, query_timestamp, 1, 1);
-WT_CONF_API_DECLARE(WT_CONNECTION, reconfigure, 17, 99);
+WT_CONF_API_DECLARE(WT_CONNECTION, reconfigure, 17, 104);
 WT_CONF_API_DECLARE(WT_CONNECTION, rollback_to_stable, 1, 2);
 WT_CONF_API_DECLARE(WT_CONNECTION, set_timestamp, 1, 4);
 WT_CONF_API_DECLARE(WT_CURSOR, bound, 1, 3);
@@ -152,7 +152,7 @@ WT_CONF_API_DECLARE(WT_SESSION, begin_transaction, 2, 11);
 WT_CONF_API_DECLARE(WT_SESSION, checkpoint, 3, 12);
 WT_CONF_API_DECLARE(WT_SESSION, commit_transaction, 1, 4);
 WT_CONF_API_DECLARE(WT_SESSION, compact, 1, 6);
-WT_CONF_API_DECLARE(WT_SESSION, create, 8, 83);
+WT_CONF_API_DECLARE(WT_SESSION, create, 10, 89);
 WT_CONF_API_DECLARE(WT_SESSION, drop, 1, 5);
 WT_CONF_API_DECLARE(WT_SESSION, join, 1, 7);
 WT_CONF_API_DECLARE(WT_SESSION, log_flush, 1, 1);
@@ -165,18 +165,18 @@ WT_CONF_API_DECLARE(WT_SESSION, salvage, 1, 1);
 WT_CONF_API_DECLARE(WT_SESSION, timestamp_transaction, 1, 4);
 WT_CONF_API_DECLARE(WT_SESSION, verify, 1, 11);
 WT_CONF_API_DECLARE(colgroup, meta, 2, 12);
-WT_CONF_API_DECLARE(file, config, 5, 55);
-WT_CONF_API_DECLARE(file, meta, 5, 62);
+WT_CONF_API_DECLARE(file, config, 7, 61);
+WT_CONF_API_DECLARE(file, meta, 7, 68);
 WT_CONF_API_DECLARE(index, meta, 2, 17);
-WT_CONF_API_DECLARE(lsm, meta, 7, 74);
-WT_CONF_API_DECLARE(object, meta, 5, 64);
+WT_CONF_API_DECLARE(lsm, meta, 9, 80);
+WT_CONF_API_DECLARE(object, meta, 7, 70);
 WT_CONF_API_DECLARE(table, meta, 2, 13);
-WT_CONF_API_DECLARE(tier, meta, 5, 65);
-WT_CONF_API_DECLARE(tiered, meta, 5, 67);
-WT_CONF_API_DECLARE(GLOBAL, wiredtiger_open, 21, 162);
-WT_CONF_API_DECLARE(GLOBAL, wiredtiger_open_all, 21, 163);
-WT_CONF_API_DECLARE(GLOBAL, wiredtiger_open_basecfg, 21, 157);
-WT_CONF_API_DECLARE(GLOBAL, wiredtiger_open_usercfg, 21, 156);
+WT_CONF_API_DECLARE(tier, meta, 7, 71);
+WT_CONF_API_DECLARE(tiered, meta, 7, 73);
+WT_CONF_API_DECLARE(GLOBAL, wiredtiger_open, 21, 173);
+WT_CONF_API_DECLARE(GLOBAL, wiredtiger_open_all, 21, 174);
+WT_CONF_API_DECLARE(GLOBAL, wiredtiger_open_basecfg, 21, 168);
+WT_CONF_API_DECLARE(GLOBAL, wiredtiger_open_usercfg, 21, 167);
 
 #define WT_CONF_API_ELEMENTS 56
 
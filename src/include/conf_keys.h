@@ -16,320 +16,333 @@
  * API configuration keys: BEGIN
  */
 #define WT_CONF_ID_Assert 1ULL
-#define WT_CONF_ID_Block_cache 176ULL
-#define WT_CONF_ID_Checkpoint 191ULL
-#define WT_CONF_ID_Checkpoint_cleanup 194ULL
-#define WT_CONF_ID_Chunk_cache 196ULL
-#define WT_CONF_ID_Compatibility 198ULL
-#define WT_CONF_ID_Debug 122ULL
-#define WT_CONF_ID_Debug_mode 200ULL
-#define WT_CONF_ID_Encryption 19ULL
-#define WT_CONF_ID_Eviction 218ULL
-#define WT_CONF_ID_File_manager 230ULL
-#define WT_CONF_ID_Flush_tier 165ULL
-#define WT_CONF_ID_Hash 290ULL
-#define WT_CONF_ID_History_store 235ULL
-#define WT_CONF_ID_Import 104ULL
-#define WT_CONF_ID_Incremental 127ULL
-#define WT_CONF_ID_Io_capacity 237ULL
-#define WT_CONF_ID_Log 36ULL
-#define WT_CONF_ID_Lsm 68ULL
-#define WT_CONF_ID_Lsm_manager 247ULL
-#define WT_CONF_ID_Merge_custom 78ULL
-#define WT_CONF_ID_Operation_tracking 250ULL
-#define WT_CONF_ID_Prefetch 270ULL
-#define WT_CONF_ID_Roundup_timestamps 159ULL
-#define WT_CONF_ID_Shared_cache 252ULL
-#define WT_CONF_ID_Statistics_log 256ULL
-#define WT_CONF_ID_Tiered_storage 47ULL
-#define WT_CONF_ID_Transaction_sync 308ULL
+#define WT_CONF_ID_Block_cache 181ULL
+#define WT_CONF_ID_Checkpoint 199ULL
+#define WT_CONF_ID_Checkpoint_cleanup 204ULL
+#define WT_CONF_ID_Checkpoint_extent_lists 17ULL
+#define WT_CONF_ID_Chunk_cache 206ULL
+#define WT_CONF_ID_Compatibility 208ULL
+#define WT_CONF_ID_Debug 128ULL
+#define WT_CONF_ID_Debug_mode 210ULL
+#define WT_CONF_ID_Encryption 22ULL
+#define WT_CONF_ID_Eviction 228ULL
+#define WT_CONF_ID_File_manager 240ULL
+#define WT_CONF_ID_Flush_tier 170ULL
+#define WT_CONF_ID_Hash 300ULL
+#define WT_CONF_ID_History_store 26ULL
+#define WT_CONF_ID_Import 110ULL
+#define WT_CONF_ID_Incremental 133ULL
+#define WT_CONF_ID_Io_capacity 246ULL
+#define WT_CONF_ID_Log 42ULL
+#define WT_CONF_ID_Lsm 74ULL
+#define WT_CONF_ID_Lsm_manager 256ULL
+#define WT_CONF_ID_Merge_custom 84ULL
+#define WT_CONF_ID_Operation_tracking 259ULL
+#define WT_CONF_ID_Prefetch 279ULL
+#define WT_CONF_ID_Roundup_timestamps 164ULL
+#define WT_CONF_ID_Shared_cache 261ULL
+#define WT_CONF_ID_Statistics_log 265ULL
+#define WT_CONF_ID_Tiered_storage 53ULL
+#define WT_CONF_ID_Transaction_sync 321ULL
 #define WT_CONF_ID_access_pattern_hint 12ULL
-#define WT_CONF_ID_action 93ULL
+#define WT_CONF_ID_action 99ULL
+#define WT_CONF_ID_admission 182ULL
 #define WT_CONF_ID_allocation_size 13ULL
-#define WT_CONF_ID_api_call_count 201ULL
+#define WT_CONF_ID_api_call_count 211ULL
 #define WT_CONF_ID_app_metadata 0ULL
-#define WT_CONF_ID_append 90ULL
-#define WT_CONF_ID_archive 241ULL
-#define WT_CONF_ID_auth_token 48ULL
-#define WT_CONF_ID_auto_throttle 69ULL
-#define WT_CONF_ID_available 301ULL
-#define WT_CONF_ID_background 97ULL
-#define WT_CONF_ID_background_compact 202ULL
-#define WT_CONF_ID_backup 169ULL
-#define WT_CONF_ID_backup_restore_target 273ULL
-#define WT_CONF_ID_blkcache_eviction_aggression 179ULL
+#define WT_CONF_ID_append 96ULL
+#define WT_CONF_ID_archive 250ULL
+#define WT_CONF_ID_auth_token 54ULL
+#define WT_CONF_ID_auto_throttle 75ULL
+#define WT_CONF_ID_available 312ULL
+#define WT_CONF_ID_background 103ULL
+#define WT_CONF_ID_background_compact 212ULL
+#define WT_CONF_ID_backup 174ULL
+#define WT_CONF_ID_backup_restore_target 282ULL
+#define WT_CONF_ID_blkcache_eviction_aggression 186ULL
 #define WT_CONF_ID_block_allocation 14ULL
 #define WT_CONF_ID_block_compressor 15ULL
-#define WT_CONF_ID_bloom 70ULL
-#define WT_CONF_ID_bloom_bit_count 71ULL
-#define WT_CONF_ID_bloom_config 72ULL
-#define WT_CONF_ID_bloom_false_positives 114ULL
-#define WT_CONF_ID_bloom_hash_count 73ULL
-#define WT_CONF_ID_bloom_oldest 74ULL
-#define WT_CONF_ID_bound 94ULL
-#define WT_CONF_ID_bucket 49ULL
-#define WT_CONF_ID_bucket_prefix 50ULL
-#define WT_CONF_ID_buckets 291ULL
-#define WT_CONF_ID_buffer_alignment 274ULL
-#define WT_CONF_ID_builtin_extension_config 275ULL
-#define WT_CONF_ID_bulk 120ULL
-#define WT_CONF_ID_cache 170ULL
-#define WT_CONF_ID_cache_cursors 266ULL
-#define WT_CONF_ID_cache_directory 51ULL
-#define WT_CONF_ID_cache_max_wait_ms 187ULL
-#define WT_CONF_ID_cache_on_checkpoint 177ULL
-#define WT_CONF_ID_cache_on_writes 178ULL
-#define WT_CONF_ID_cache_overhead 188ULL
+#define WT_CONF_ID_bloom 76ULL
+#define WT_CONF_ID_bloom_bit_count 77ULL
+#define WT_CONF_ID_bloom_config 78ULL
+#define WT_CONF_ID_bloom_false_positives 120ULL
+#define WT_CONF_ID_bloom_hash_count 79ULL
+#define WT_CONF_ID_bloom_oldest 80ULL
+#define WT_CONF_ID_bound 100ULL
+#define WT_CONF_ID_bucket 55ULL
+#define WT_CONF_ID_bucket_prefix 56ULL
+#define WT_CONF_ID_buckets 301ULL
+#define WT_CONF_ID_buffer_alignment 283ULL
+#define WT_CONF_ID_builtin_extension_config 284ULL
+#define WT_CONF_ID_bulk 126ULL
+#define WT_CONF_ID_cache 175ULL
+#define WT_CONF_ID_cache_cursors 275ULL
+#define WT_CONF_ID_cache_directory 57ULL
+#define WT_CONF_ID_cache_max_wait_ms 195ULL
+#define WT_CONF_ID_cache_on_checkpoint 183ULL
+#define WT_CONF_ID_cache_on_writes 184ULL
+#define WT_CONF_ID_cache_overhead 196ULL
 #define WT_CONF_ID_cache_resident 16ULL
-#define WT_CONF_ID_cache_size 189ULL
-#define WT_CONF_ID_cache_stuck_timeout_ms 190ULL
-#define WT_CONF_ID_capacity 277ULL
-#define WT_CONF_ID_checkpoint 56ULL
-#define WT_CONF_ID_checkpoint_backup_info 57ULL
-#define WT_CONF_ID_checkpoint_cleanup 163ULL
-#define WT_CONF_ID_checkpoint_fail_before_turtle_update 267ULL
-#define WT_CONF_ID_checkpoint_lsn 58ULL
-#define WT_CONF_ID_checkpoint_read_timestamp 123ULL
-#define WT_CONF_ID_checkpoint_retention 204ULL
-#define WT_CONF_ID_checkpoint_sync 276ULL
-#define WT_CONF_ID_checkpoint_use_history 121ULL
-#define WT_CONF_ID_checkpoint_wait 109ULL
-#define WT_CONF_ID_checksum 17ULL
-#define WT_CONF_ID_chunk 253ULL
-#define WT_CONF_ID_chunk_cache 239ULL
-#define WT_CONF_ID_chunk_cache_evict_trigger 278ULL
-#define WT_CONF_ID_chunk_count_limit 75ULL
-#define WT_CONF_ID_chunk_max 76ULL
-#define WT_CONF_ID_chunk_size 77ULL
-#define WT_CONF_ID_chunks 66ULL
-#define WT_CONF_ID_close_handle_minimum 231ULL
-#define WT_CONF_ID_close_idle_time 232ULL
-#define WT_CONF_ID_close_scan_interval 233ULL
-#define WT_CONF_ID_colgroups 87ULL
+#define WT_CONF_ID_cache_size 197ULL
+#define WT_CONF_ID_cache_stuck_timeout_ms 198ULL
+#define WT_CONF_ID_capacity 286ULL
+#define WT_CONF_ID_checkpoint 62ULL
+#define WT_CONF_ID_checkpoint_backup_info 63ULL
+#define WT_CONF_ID_checkpoint_cleanup 168ULL
+#define WT_CONF_ID_checkpoint_fail_before_turtle_update 276ULL
+#define WT_CONF_ID_checkpoint_lsn 64ULL
+#define WT_CONF_ID_checkpoint_read_timestamp 129ULL
+#define WT_CONF_ID_checkpoint_retention 214ULL
+#define WT_CONF_ID_checkpoint_sync 285ULL
+#define WT_CONF_ID_checkpoint_use_history 127ULL
+#define WT_CONF_ID_checkpoint_wait 115ULL
+#define WT_CONF_ID_checksum 20ULL
+#define WT_CONF_ID_chunk 262ULL
+#define WT_CONF_ID_chunk_cache 248ULL
+#define WT_CONF_ID_chunk_cache_evict_trigger 287ULL
+#define WT_CONF_ID_chunk_count_limit 81ULL
+#define WT_CONF_ID_chunk_max 82ULL
+#define WT_CONF_ID_chunk_size 83ULL
+#define WT_CONF_ID_chunks 72ULL
+#define WT_CONF_ID_close_handle_minimum 241ULL
+#define WT_CONF_ID_close_idle_time 242ULL
+#define WT_CONF_ID_close_scan_interval 243ULL
+#define WT_CONF_ID_colgroups 93ULL
 #define WT_CONF_ID_collator 6ULL
 #define WT_CONF_ID_columns 7ULL
 #define WT_CONF_ID_commit_timestamp 2ULL
-#define WT_CONF_ID_compare 115ULL
-#define WT_CONF_ID_compare_timestamp 105ULL
-#define WT_CONF_ID_compile_configuration_count 283ULL
-#define WT_CONF_ID_compressor 295ULL
-#define WT_CONF_ID_config 262ULL
-#define WT_CONF_ID_config_base 284ULL
-#define WT_CONF_ID_consolidate 128ULL
-#define WT_CONF_ID_corruption_abort 203ULL
-#define WT_CONF_ID_count 116ULL
-#define WT_CONF_ID_create 285ULL
-#define WT_CONF_ID_cursor_copy 205ULL
-#define WT_CONF_ID_cursor_reposition 206ULL
-#define WT_CONF_ID_cursors 171ULL
-#define WT_CONF_ID_default 302ULL
-#define WT_CONF_ID_dhandle_buckets 292ULL
-#define WT_CONF_ID_dictionary 18ULL
-#define WT_CONF_ID_direct_io 286ULL
-#define WT_CONF_ID_do_not_clear_txn_id 143ULL
-#define WT_CONF_ID_drop 164ULL
-#define WT_CONF_ID_dryrun 98ULL
-#define WT_CONF_ID_dump 126ULL
-#define WT_CONF_ID_dump_address 144ULL
-#define WT_CONF_ID_dump_all_data 145ULL
-#define WT_CONF_ID_dump_blocks 146ULL
-#define WT_CONF_ID_dump_key_data 147ULL
-#define WT_CONF_ID_dump_layout 148ULL
-#define WT_CONF_ID_dump_offsets 149ULL
-#define WT_CONF_ID_dump_pages 150ULL
-#define WT_CONF_ID_dump_version 124ULL
+#define WT_CONF_ID_compare 121ULL
+#define WT_CONF_ID_compare_timestamp 111ULL
+#define WT_CONF_ID_compile_configuration_count 293ULL
+#define WT_CONF_ID_compressor 185ULL
+#define WT_CONF_ID_config 271ULL
+#define WT_CONF_ID_config_base 294ULL
+#define WT_CONF_ID_consolidate 19ULL
+#define WT_CONF_ID_corruption_abort 213ULL
+#define WT_CONF_ID_count 122ULL
+#define WT_CONF_ID_create 295ULL
+#define WT_CONF_ID_cursor_copy 215ULL
+#define WT_CONF_ID_cursor_reposition 216ULL
+#define WT_CONF_ID_cursors 176ULL
+#define WT_CONF_ID_default 313ULL
+#define WT_CONF_ID_dhandle_buckets 302ULL
+#define WT_CONF_ID_dictionary 21ULL
+#define WT_CONF_ID_dictionary_size 305ULL
+#define WT_CONF_ID_direct_io 296ULL
+#define WT_CONF_ID_do_not_clear_txn_id 148ULL
+#define WT_CONF_ID_drop 169ULL
+#define WT_CONF_ID_dryrun 104ULL
+#define WT_CONF_ID_dump 132ULL
+#define WT_CONF_ID_dump_address 149ULL
+#define WT_CONF_ID_dump_all_data 150ULL
+#define WT_CONF_ID_dump_blocks 151ULL
+#define WT_CONF_ID_dump_key_data 152ULL
+#define WT_CONF_ID_dump_layout 153ULL
+#define WT_CONF_ID_dump_offsets 154ULL
+#define WT_CONF_ID_dump_pages 155ULL
+#define WT_CONF_ID_dump_version 130ULL
 #define WT_CONF_ID_durable_timestamp 3ULL
-#define WT_CONF_ID_early_load 263ULL
-#define WT_CONF_ID_enabled 37ULL
-#define WT_CONF_ID_entry 264ULL
-#define WT_CONF_ID_error_prefix 217ULL
-#define WT_CONF_ID_evict_sample_inmem 221ULL
-#define WT_CONF_ID_eviction 207ULL
-#define WT_CONF_ID_eviction_checkpoint_target 222ULL
-#define WT_CONF_ID_eviction_dirty_target 223ULL
-#define WT_CONF_ID_eviction_dirty_trigger 224ULL
-#define WT_CONF_ID_eviction_target 225ULL
-#define WT_CONF_ID_eviction_trigger 226ULL
-#define WT_CONF_ID_eviction_updates_target 227ULL
-#define WT_CONF_ID_eviction_updates_trigger 228ULL
-#define WT_CONF_ID_exclude 99ULL
-#define WT_CONF_ID_exclusive 103ULL
-#define WT_CONF_ID_exclusive_refreshed 96ULL
-#define WT_CONF_ID_extensions 288ULL
-#define WT_CONF_ID_extra_diagnostics 229ULL
-#define WT_CONF_ID_extractor 63ULL
-#define WT_CONF_ID_file 129ULL
-#define WT_CONF_ID_file_extend 289ULL
-#define WT_CONF_ID_file_max 236ULL
-#define WT_CONF_ID_file_metadata 107ULL
-#define WT_CONF_ID_final_flush 167ULL
-#define WT_CONF_ID_flush_time 85ULL
-#define WT_CONF_ID_flush_timestamp 86ULL
-#define WT_CONF_ID_flushed_data_cache_insertion 280ULL
-#define WT_CONF_ID_force 110ULL
-#define WT_CONF_ID_force_stop 130ULL
-#define WT_CONF_ID_force_write_wait 296ULL
-#define WT_CONF_ID_format 22ULL
-#define WT_CONF_ID_free_space_target 100ULL
-#define WT_CONF_ID_full_target 180ULL
-#define WT_CONF_ID_generation_drain_timeout_ms 234ULL
-#define WT_CONF_ID_get 142ULL
-#define WT_CONF_ID_granularity 131ULL
-#define WT_CONF_ID_handles 172ULL
-#define WT_CONF_ID_hashsize 182ULL
-#define WT_CONF_ID_hazard_max 293ULL
-#define WT_CONF_ID_huffman_key 23ULL
-#define WT_CONF_ID_huffman_value 24ULL
-#define WT_CONF_ID_id 59ULL
-#define WT_CONF_ID_ignore_cache_size 269ULL
-#define WT_CONF_ID_ignore_in_memory_cache_size 25ULL
-#define WT_CONF_ID_ignore_prepare 154ULL
-#define WT_CONF_ID_immutable 64ULL
-#define WT_CONF_ID_in_memory 294ULL
-#define WT_CONF_ID_inclusive 95ULL
-#define WT_CONF_ID_index_key_columns 65ULL
-#define WT_CONF_ID_internal_item_max 26ULL
-#define WT_CONF_ID_internal_key_max 27ULL
-#define WT_CONF_ID_internal_key_truncate 28ULL
-#define WT_CONF_ID_internal_page_max 29ULL
-#define WT_CONF_ID_interval 307ULL
-#define WT_CONF_ID_isolation 155ULL
-#define WT_CONF_ID_json 257ULL
-#define WT_CONF_ID_json_output 240ULL
-#define WT_CONF_ID_key_format 30ULL
-#define WT_CONF_ID_key_gap 31ULL
-#define WT_CONF_ID_keyid 21ULL
-#define WT_CONF_ID_last 67ULL
-#define WT_CONF_ID_leaf_item_max 32ULL
-#define WT_CONF_ID_leaf_key_max 33ULL
-#define WT_CONF_ID_leaf_page_max 34ULL
-#define WT_CONF_ID_leaf_value_max 35ULL
-#define WT_CONF_ID_leak_memory 168ULL
-#define WT_CONF_ID_local_retention 52ULL
-#define WT_CONF_ID_lock_wait 111ULL
-#define WT_CONF_ID_log 173ULL
-#define WT_CONF_ID_log_retention 208ULL
-#define WT_CONF_ID_log_size 192ULL
-#define WT_CONF_ID_max_percent_overhead 183ULL
-#define WT_CONF_ID_memory_page_image_max 38ULL
-#define WT_CONF_ID_memory_page_max 39ULL
-#define WT_CONF_ID_merge 249ULL
-#define WT_CONF_ID_merge_max 82ULL
-#define WT_CONF_ID_merge_min 83ULL
-#define WT_CONF_ID_metadata_file 108ULL
-#define WT_CONF_ID_method 195ULL
-#define WT_CONF_ID_mmap 298ULL
-#define WT_CONF_ID_mmap_all 299ULL
-#define WT_CONF_ID_multiprocess 300ULL
-#define WT_CONF_ID_name 20ULL
-#define WT_CONF_ID_next_random 134ULL
-#define WT_CONF_ID_next_random_sample_size 135ULL
-#define WT_CONF_ID_next_random_seed 136ULL
-#define WT_CONF_ID_no_timestamp 156ULL
-#define WT_CONF_ID_nvram_path 184ULL
-#define WT_CONF_ID_object_target_size 53ULL
-#define WT_CONF_ID_old_chunks 84ULL
-#define WT_CONF_ID_oldest 88ULL
-#define WT_CONF_ID_oldest_timestamp 271ULL
-#define WT_CONF_ID_on_close 258ULL
-#define WT_CONF_ID_operation 117ULL
-#define WT_CONF_ID_operation_timeout_ms 157ULL
-#define WT_CONF_ID_os_cache_dirty_max 40ULL
-#define WT_CONF_ID_os_cache_dirty_pct 242ULL
-#define WT_CONF_ID_os_cache_max 41ULL
-#define WT_CONF_ID_overwrite 91ULL
-#define WT_CONF_ID_path 251ULL
-#define WT_CONF_ID_percent_file_in_dram 185ULL
-#define WT_CONF_ID_pinned 197ULL
-#define WT_CONF_ID_prealloc 243ULL
-#define WT_CONF_ID_prealloc_init_count 244ULL
-#define WT_CONF_ID_prefix 79ULL
-#define WT_CONF_ID_prefix_compression 42ULL
-#define WT_CONF_ID_prefix_compression_min 43ULL
-#define WT_CONF_ID_prefix_search 92ULL
-#define WT_CONF_ID_prepare_timestamp 162ULL
-#define WT_CONF_ID_prepared 160ULL
-#define WT_CONF_ID_priority 158ULL
-#define WT_CONF_ID_quota 254ULL
-#define WT_CONF_ID_raw 137ULL
-#define WT_CONF_ID_read 161ULL
-#define WT_CONF_ID_read_corrupt 151ULL
-#define WT_CONF_ID_read_once 138ULL
+#define WT_CONF_ID_early_load 272ULL
+#define WT_CONF_ID_enabled 43ULL
+#define WT_CONF_ID_entry 273ULL
+#define WT_CONF_ID_error_prefix 227ULL
+#define WT_CONF_ID_evict_sample_inmem 231ULL
+#define WT_CONF_ID_eviction 217ULL
+#define WT_CONF_ID_eviction_checkpoint_target 232ULL
+#define WT_CONF_ID_eviction_dirty_target 233ULL
+#define WT_CONF_ID_eviction_dirty_trigger 234ULL
+#define WT_CONF_ID_eviction_target 235ULL
+#define WT_CONF_ID_eviction_trigger 236ULL
+#define WT_CONF_ID_eviction_updates_target 237ULL
+#define WT_CONF_ID_eviction_updates_trigger 238ULL
+#define WT_CONF_ID_exclude 105ULL
+#define WT_CONF_ID_exclusive 109ULL
+#define WT_CONF_ID_exclusive_refreshed 102ULL
+#define WT_CONF_ID_extensions 298ULL
+#define WT_CONF_ID_extra_diagnostics 239ULL
+#define WT_CONF_ID_extractor 69ULL
+#define WT_CONF_ID_file 134ULL
+#define WT_CONF_ID_file_extend 299ULL
+#define WT_CONF_ID_file_max 245ULL
+#define WT_CONF_ID_file_metadata 113ULL
+#define WT_CONF_ID_final_flush 172ULL
+#define WT_CONF_ID_flush_time 91ULL
+#define WT_CONF_ID_flush_timestamp 92ULL
+#define WT_CONF_ID_flush_wait 200ULL
+#define WT_CONF_ID_flushed_data_cache_insertion 290ULL
+#define WT_CONF_ID_force 116ULL
+#define WT_CONF_ID_force_stop 135ULL
+#define WT_CONF_ID_force_write_wait 306ULL
+#define WT_CONF_ID_format 25ULL
+#define WT_CONF_ID_free_space_target 106ULL
+#define WT_CONF_ID_full_target 187ULL
+#define WT_CONF_ID_generation_drain_timeout_ms 244ULL
+#define WT_CONF_ID_get 147ULL
+#define WT_CONF_ID_granularity 136ULL
+#define WT_CONF_ID_handles 177ULL
+#define WT_CONF_ID_hashsize 189ULL
+#define WT_CONF_ID_hazard_max 303ULL
+#define WT_CONF_ID_huffman_key 29ULL
+#define WT_CONF_ID_huffman_value 30ULL
+#define WT_CONF_ID_id 65ULL
+#define WT_CONF_ID_ignore_cache_size 278ULL
+#define WT_CONF_ID_ignore_in_memory_cache_size 31ULL
+#define WT_CONF_ID_ignore_prepare 159ULL
+#define WT_CONF_ID_immutable 70ULL
+#define WT_CONF_ID_in_memory 304ULL
+#define WT_CONF_ID_inclusive 101ULL
+#define WT_CONF_ID_incremental 18ULL
+#define WT_CONF_ID_index_key_columns 71ULL
+#define WT_CONF_ID_internal_item_max 32ULL
+#define WT_CONF_ID_internal_key_max 33ULL
+#define WT_CONF_ID_internal_key_truncate 34ULL
+#define WT_CONF_ID_internal_page_max 35ULL
+#define WT_CONF_ID_interval 320ULL
+#define WT_CONF_ID_isolation 160ULL
+#define WT_CONF_ID_json 266ULL
+#define WT_CONF_ID_json_output 249ULL
+#define WT_CONF_ID_key_format 36ULL
+#define WT_CONF_ID_key_gap 37ULL
+#define WT_CONF_ID_keyid 24ULL
+#define WT_CONF_ID_last 73ULL
+#define WT_CONF_ID_latency_target 322ULL
+#define WT_CONF_ID_leaf_item_max 38ULL
+#define WT_CONF_ID_leaf_key_max 39ULL
+#define WT_CONF_ID_leaf_page_max 40ULL
+#define WT_CONF_ID_leaf_value_max 41ULL
+#define WT_CONF_ID_leak_memory 173ULL
+#define WT_CONF_ID_local_retention 58ULL
+#define WT_CONF_ID_lock_wait 117ULL
+#define WT_CONF_ID_log 178ULL
+#define WT_CONF_ID_log_retention 218ULL
+#define WT_CONF_ID_log_size 201ULL
+#define WT_CONF_ID_max_percent_overhead 190ULL
+#define WT_CONF_ID_memory_page_image_max 44ULL
+#define WT_CONF_ID_memory_page_max 45ULL
+#define WT_CONF_ID_merge 258ULL
+#define WT_CONF_ID_merge_max 88ULL
+#define WT_CONF_ID_merge_min 89ULL
+#define WT_CONF_ID_metadata_file 114ULL
+#define WT_CONF_ID_method 205ULL
+#define WT_CONF_ID_mmap 309ULL
+#define WT_CONF_ID_mmap_all 310ULL
+#define WT_CONF_ID_multiprocess 311ULL
+#define WT_CONF_ID_name 23ULL
+#define WT_CONF_ID_next_random 139ULL
+#define WT_CONF_ID_next_random_sample_size 140ULL
+#define WT_CONF_ID_next_random_seed 141ULL
+#define WT_CONF_ID_no_timestamp 161ULL
+#define WT_CONF_ID_nvram_path 191ULL
+#define WT_CONF_ID_object_target_size 59ULL
+#define WT_CONF_ID_old_chunks 90ULL
+#define WT_CONF_ID_oldest 94ULL
+#define WT_CONF_ID_oldest_timestamp 280ULL
+#define WT_CONF_ID_on_close 267ULL
+#define WT_CONF_ID_operation 123ULL
+#define WT_CONF_ID_operation_timeout_ms 162ULL
+#define WT_CONF_ID_os_cache_dirty_max 46ULL
+#define WT_CONF_ID_os_cache_dirty_pct 251ULL
+#define WT_CONF_ID_os_cache_max 47ULL
+#define WT_CONF_ID_overwrite 97ULL
+#define WT_CONF_ID_pacing 202ULL
+#define WT_CONF_ID_path 260ULL
+#define WT_CONF_ID_percent_file_in_dram 193ULL
+#define WT_CONF_ID_pinned 207ULL
+#define WT_CONF_ID_prealloc 252ULL
+#define WT_CONF_ID_prealloc_init_count 253ULL
+#define WT_CONF_ID_prefetch_chunks 288ULL
+#define WT_CONF_ID_prefix 85ULL
+#define WT_CONF_ID_prefix_compression 48ULL
+#define WT_CONF_ID_prefix_compression_min 49ULL
+#define WT_CONF_ID_prefix_search 98ULL
+#define WT_CONF_ID_prepare_timestamp 167ULL
+#define WT_CONF_ID_prepared 165ULL
+#define WT_CONF_ID_priority 163ULL
+#define WT_CONF_ID_promote_references 192ULL
+#define WT_CONF_ID_quota 263ULL
+#define WT_CONF_ID_raw 142ULL
+#define WT_CONF_ID_read 166ULL
+#define WT_CONF_ID_read_corrupt 156ULL
+#define WT_CONF_ID_read_once 143ULL
 #define WT_CONF_ID_read_timestamp 4ULL
-#define WT_CONF_ID_readonly 60ULL
-#define WT_CONF_ID_realloc_exact 209ULL
-#define WT_CONF_ID_realloc_malloc 210ULL
-#define WT_CONF_ID_recover 297ULL
-#define WT_CONF_ID_release 199ULL
-#define WT_CONF_ID_release_evict 125ULL
-#define WT_CONF_ID_release_evict_page 268ULL
-#define WT_CONF_ID_remove 245ULL
-#define WT_CONF_ID_remove_files 112ULL
-#define WT_CONF_ID_remove_shared 113ULL
-#define WT_CONF_ID_repair 106ULL
-#define WT_CONF_ID_require_max 281ULL
-#define WT_CONF_ID_require_min 282ULL
-#define WT_CONF_ID_reserve 255ULL
-#define WT_CONF_ID_rollback_error 211ULL
-#define WT_CONF_ID_run_once 101ULL
-#define WT_CONF_ID_salvage 303ULL
-#define WT_CONF_ID_secretkey 287ULL
-#define WT_CONF_ID_session_max 304ULL
-#define WT_CONF_ID_session_scratch_max 305ULL
-#define WT_CONF_ID_session_table_cache 306ULL
-#define WT_CONF_ID_sessions 174ULL
-#define WT_CONF_ID_shared 54ULL
-#define WT_CONF_ID_size 181ULL
-#define WT_CONF_ID_skip_sort_check 139ULL
-#define WT_CONF_ID_slow_checkpoint 212ULL
+#define WT_CONF_ID_readonly 66ULL
+#define WT_CONF_ID_realloc_exact 219ULL
+#define WT_CONF_ID_realloc_malloc 220ULL
+#define WT_CONF_ID_recover 307ULL
+#define WT_CONF_ID_recover_threads 308ULL
+#define WT_CONF_ID_release 209ULL
+#define WT_CONF_ID_release_evict 131ULL
+#define WT_CONF_ID_release_evict_page 277ULL
+#define WT_CONF_ID_remove 254ULL
+#define WT_CONF_ID_remove_files 118ULL
+#define WT_CONF_ID_remove_shared 119ULL
+#define WT_CONF_ID_repair 112ULL
+#define WT_CONF_ID_require_max 291ULL
+#define WT_CONF_ID_require_min 292ULL
+#define WT_CONF_ID_reserve 264ULL
+#define WT_CONF_ID_reverse_modify_max 28ULL
+#define WT_CONF_ID_rollback_error 221ULL
+#define WT_CONF_ID_run_once 107ULL
+#define WT_CONF_ID_salvage 316ULL
+#define WT_CONF_ID_secretkey 297ULL
+#define WT_CONF_ID_separate 27ULL
+#define WT_CONF_ID_session_max 317ULL
+#define WT_CONF_ID_session_scratch_max 318ULL
+#define WT_CONF_ID_session_table_cache 319ULL
+#define WT_CONF_ID_sessions 179ULL
+#define WT_CONF_ID_shared 60ULL
+#define WT_CONF_ID_size 188ULL
+#define WT_CONF_ID_skip_sort_check 144ULL
+#define WT_CONF_ID_slow_checkpoint 222ULL
 #define WT_CONF_ID_source 8ULL
-#define WT_CONF_ID_sources 259ULL
-#define WT_CONF_ID_split_deepen_min_child 44ULL
-#define WT_CONF_ID_split_deepen_per_child 45ULL
-#define WT_CONF_ID_split_pct 46ULL
-#define WT_CONF_ID_src_id 132ULL
-#define WT_CONF_ID_stable_timestamp 152ULL
-#define WT_CONF_ID_start_generation 80ULL
-#define WT_CONF_ID_statistics 140ULL
-#define WT_CONF_ID_storage_path 279ULL
-#define WT_CONF_ID_strategy 118ULL
-#define WT_CONF_ID_stress_skiplist 213ULL
-#define WT_CONF_ID_strict 153ULL
-#define WT_CONF_ID_suffix 81ULL
-#define WT_CONF_ID_sync 119ULL
-#define WT_CONF_ID_system_ram 186ULL
-#define WT_CONF_ID_table_logging 214ULL
-#define WT_CONF_ID_target 141ULL
-#define WT_CONF_ID_terminate 265ULL
-#define WT_CONF_ID_this_id 133ULL
-#define WT_CONF_ID_threads 272ULL
-#define WT_CONF_ID_threads_max 219ULL
-#define WT_CONF_ID_threads_min 220ULL
-#define WT_CONF_ID_tiered_flush_error_continue 215ULL
-#define WT_CONF_ID_tiered_object 61ULL
-#define WT_CONF_ID_tiers 89ULL
-#define WT_CONF_ID_timeout 102ULL
-#define WT_CONF_ID_timestamp 260ULL
-#define WT_CONF_ID_timing_stress_for_test 261ULL
-#define WT_CONF_ID_total 238ULL
-#define WT_CONF_ID_txn 175ULL
+#define WT_CONF_ID_sources 268ULL
+#define WT_CONF_ID_split_deepen_min_child 50ULL
+#define WT_CONF_ID_split_deepen_per_child 51ULL
+#define WT_CONF_ID_split_pct 52ULL
+#define WT_CONF_ID_src_id 137ULL
+#define WT_CONF_ID_stable_timestamp 157ULL
+#define WT_CONF_ID_start_generation 86ULL
+#define WT_CONF_ID_statistics 145ULL
+#define WT_CONF_ID_storage_path 289ULL
+#define WT_CONF_ID_strategy 124ULL
+#define WT_CONF_ID_stress_skiplist 223ULL
+#define WT_CONF_ID_strict 158ULL
+#define WT_CONF_ID_suffix 87ULL
+#define WT_CONF_ID_sync 125ULL
+#define WT_CONF_ID_system_ram 194ULL
+#define WT_CONF_ID_table_logging 224ULL
+#define WT_CONF_ID_target 146ULL
+#define WT_CONF_ID_terminate 274ULL
+#define WT_CONF_ID_this_id 138ULL
+#define WT_CONF_ID_threads 281ULL
+#define WT_CONF_ID_threads_max 229ULL
+#define WT_CONF_ID_threads_min 230ULL
+#define WT_CONF_ID_tiered_flush_error_continue 225ULL
+#define WT_CONF_ID_tiered_object 67ULL
+#define WT_CONF_ID_tiers 95ULL
+#define WT_CONF_ID_timeout 108ULL
+#define WT_CONF_ID_timestamp 269ULL
+#define WT_CONF_ID_timing_stress_for_test 270ULL
+#define WT_CONF_ID_total 247ULL
+#define WT_CONF_ID_txn 180ULL
 #define WT_CONF_ID_type 9ULL
-#define WT_CONF_ID_update_restore_evict 216ULL
-#define WT_CONF_ID_use_environment 309ULL
-#define WT_CONF_ID_use_environment_priv 310ULL
-#define WT_CONF_ID_use_timestamp 166ULL
-#define WT_CONF_ID_value_format 55ULL
+#define WT_CONF_ID_update_restore_evict 226ULL
+#define WT_CONF_ID_use_environment 323ULL
+#define WT_CONF_ID_use_environment_priv 324ULL
+#define WT_CONF_ID_use_timestamp 171ULL
+#define WT_CONF_ID_value_format 61ULL
 #define WT_CONF_ID_verbose 10ULL
-#define WT_CONF_ID_verify_metadata 311ULL
-#define WT_CONF_ID_version 62ULL
-#define WT_CONF_ID_wait 193ULL
-#define WT_CONF_ID_worker_thread_max 248ULL
-#define WT_CONF_ID_write_through 312ULL
+#define WT_CONF_ID_verify_metadata 325ULL
+#define WT_CONF_ID_version 68ULL
+#define WT_CONF_ID_wait 203ULL
+#define WT_CONF_ID_warm_restart 314ULL
+#define WT_CONF_ID_warm_restart_pages 315ULL
+#define WT_CONF_ID_worker_thread_max 257ULL
+#define WT_CONF_ID_write_through 326ULL
 #define WT_CONF_ID_write_timestamp 5ULL
 #define WT_CONF_ID_write_timestamp_usage 11ULL
-#define WT_CONF_ID_zero_fill 246ULL
-
-#define WT_CONF_ID_COUNT 313
+#define WT_CONF_ID_zero_fill 255ULL
+#define WT_CONF_ID_COUNT 327
 /*
  * API configuration keys: END
  */
@@ -349,27 +362,37 @@ static const struct {
         uint64_t write_timestamp;
     } Assert;
     struct {
-        uint64_t blkcache_eviction_aggression;
+        uint64_t admission;
+uint64_t blkcache_eviction_aggression;
         uint64_t cache_on_checkpoint;
         uint64_t cache_on_writes;
+        uint64_t compressor;
         uint64_t enabled;
         uint64_t full_target;
         uint64_t hashsize;
         uint64_t max_percent_overhead;
         uint64_t nvram_path;
         uint64_t percent_file_in_dram;
+        uint64_t promote_references;
         uint64_t size;
         uint64_t system_ram;
         uint64_t type;
     } Block_cache;
     struct {
-        uint64_t log_size;
+        uint64_t flush_wait;
+uint64_t log_size;
+        uint64_t pacing;
         uint64_t wait;
     } Checkpoint;
     struct {
         uint64_t method;
         uint64_t wait;
     } Checkpoint_cleanup;
+      struct {
+      uint64_t consolidate;
+      uint64_t incremental;
+      }
+      Checkpoint_extent_lists;
     struct {
         uint64_t capacity;
         uint64_t chunk_cache_evict_trigger;
@@ -378,6 +401,7 @@ static const struct {
         uint64_t flushed_data_cache_insertion;
         uint64_t hashsize;
         uint64_t pinned;
+        uint64_t prefetch_chunks;
         uint64_t storage_path;
         uint64_t type;
     } Chunk_cache;
@@ -459,6 +483,7 @@ static const struct {
     struct {
         uint64_t archive;
         uint64_t compressor;
+        uint64_t dictionary_size;
         uint64_t enabled;
         uint64_t file_max;
         uint64_t force_write_wait;
@@ -467,6 +492,7 @@ static const struct {
         uint64_t prealloc;
         uint64_t prealloc_init_count;
         uint64_t recover;
+        uint64_t recover_threads;
         uint64_t remove;
         uint64_t zero_fill;
     } Log;
@@ -499,6 +525,8 @@ static const struct {
     struct {
         uint64_t available;
         uint64_t _default;
+        uint64_t warm_restart;
+        uint64_t warm_restart_pages;
     } Prefetch;
     struct {
         uint64_t prepared;
@@ -531,6 +559,7 @@ static const struct {
     } Tiered_storage;
     struct {
         uint64_t enabled;
+        uint64_t latency_target;
         uint64_t method;
     } Transaction_sync;
     uint64_t access_pattern_hint;
@@ -717,39 +746,39 @@ static const struct {
     WT_CONF_ID_Assert | (WT_CONF_ID_read_timestamp << 16),
     WT_CONF_ID_Assert | (WT_CONF_ID_write_timestamp << 16),
   },
-  {
+  {WT_CONF_ID_Block_cache | (WT_CONF_ID_admission << 16),
     WT_CONF_ID_Block_cache | (WT_CONF_ID_blkcache_eviction_aggression << 16),
     WT_CONF_ID_Block_cache | (WT_CONF_ID_cache_on_checkpoint << 16),
     WT_CONF_ID_Block_cache | (WT_CONF_ID_cache_on_writes << 16),
+    WT_CONF_ID_Block_cache | (WT_CONF_ID_compressor << 16),
     WT_CONF_ID_Block_cache | (WT_CONF_ID_enabled << 16),
     WT_CONF_ID_Block_cache | (WT_CONF_ID_full_target << 16),
     WT_CONF_ID_Block_cache | (WT_CONF_ID_hashsize << 16),
     WT_CONF_ID_Block_cache | (WT_CONF_ID_max_percent_overhead << 16),
     WT_CONF_ID_Block_cache | (WT_CONF_ID_nvram_path << 16),
     WT_CONF_ID_Block_cache | (WT_CONF_ID_percent_file_in_dram << 16),
+    WT_CONF_ID_Block_cache | (WT_CONF_ID_promote_references << 16),
     WT_CONF_ID_Block_cache | (WT_CONF_ID_size << 16),
     WT_CONF_ID_Block_cache | (WT_CONF_ID_system_ram << 16),
-    WT_CONF_ID_Block_cache | (WT_CONF_ID_type << 16),
-  },
-  {
+    WT_CONF_ID_Block_cache | (WT_CONF_ID_type << 16),},
+  {WT_CONF_ID_Checkpoint | (WT_CONF_ID_flush_wait << 16),
     WT_CONF_ID_Checkpoint | (WT_CONF_ID_log_size << 16),
-    WT_CONF_ID_Checkpoint | (WT_CONF_ID_wait << 16),
-  },
-  {
-    WT_CONF_ID_Checkpoint_cleanup | (WT_CONF_ID_method << 16),
-    WT_CONF_ID_Checkpoint_cleanup | (WT_CONF_ID_wait << 16),
-  },
-  {
-    WT_CONF_ID_Chunk_cache | (WT_CONF_ID_capacity << 16),
+    WT_CONF_ID_Checkpoint | (WT_CONF_ID_pacing << 16),
+    WT_CONF_ID_Checkpoint | (WT_CONF_ID_wait << 16),},
+  {WT_CONF_ID_Checkpoint_cleanup | (WT_CONF_ID_method << 16),
+    WT_CONF_ID_Checkpoint_cleanup | (WT_CONF_ID_wait << 16),},
+  {WT_CONF_ID_Checkpoint_extent_lists | (WT_CONF_ID_consolidate << 16),
+    WT_CONF_ID_Checkpoint_extent_lists | (WT_CONF_ID_incremental << 16),},
+  {WT_CONF_ID_Chunk_cache | (WT_CONF_ID_capacity << 16),
     WT_CONF_ID_Chunk_cache | (WT_CONF_ID_chunk_cache_evict_trigger << 16),
     WT_CONF_ID_Chunk_cache | (WT_CONF_ID_chunk_size << 16),
     WT_CONF_ID_Chunk_cache | (WT_CONF_ID_enabled << 16),
     WT_CONF_ID_Chunk_cache | (WT_CONF_ID_flushed_data_cache_insertion << 16),
     WT_CONF_ID_Chunk_cache | (WT_CONF_ID_hashsize << 16),
     WT_CONF_ID_Chunk_cache | (WT_CONF_ID_pinned << 16),
+    WT_CONF_ID_Chunk_cache | (WT_CONF_ID_prefetch_chunks << 16),
     WT_CONF_ID_Chunk_cache | (WT_CONF_ID_storage_path << 16),
-    WT_CONF_ID_Chunk_cache | (WT_CONF_ID_type << 16),
-  },
+    WT_CONF_ID_Chunk_cache | (WT_CONF_ID_type << 16),},
   {
     WT_CONF_ID_Compatibility | (WT_CONF_ID_release << 16),
     WT_CONF_ID_Compatibility | (WT_CONF_ID_require_max << 16),
@@ -825,20 +854,16 @@ static const struct {
     WT_CONF_ID_Io_capacity | (WT_CONF_ID_chunk_cache << 16),
     WT_CONF_ID_Io_capacity | (WT_CONF_ID_total << 16),
   },
-  {
-    WT_CONF_ID_Log | (WT_CONF_ID_archive << 16),
-    WT_CONF_ID_Log | (WT_CONF_ID_compressor << 16),
-    WT_CONF_ID_Log | (WT_CONF_ID_enabled << 16),
-    WT_CONF_ID_Log | (WT_CONF_ID_file_max << 16),
+  {WT_CONF_ID_Log | (WT_CONF_ID_archive << 16), WT_CONF_ID_Log | (WT_CONF_ID_compressor << 16),
+    WT_CONF_ID_Log | (WT_CONF_ID_dictionary_size << 16),
+    WT_CONF_ID_Log | (WT_CONF_ID_enabled << 16), WT_CONF_ID_Log | (WT_CONF_ID_file_max << 16),
     WT_CONF_ID_Log | (WT_CONF_ID_force_write_wait << 16),
     WT_CONF_ID_Log | (WT_CONF_ID_os_cache_dirty_pct << 16),
-    WT_CONF_ID_Log | (WT_CONF_ID_path << 16),
-    WT_CONF_ID_Log | (WT_CONF_ID_prealloc << 16),
+    WT_CONF_ID_Log | (WT_CONF_ID_path << 16), WT_CONF_ID_Log | (WT_CONF_ID_prealloc << 16),
     WT_CONF_ID_Log | (WT_CONF_ID_prealloc_init_count << 16),
     WT_CONF_ID_Log | (WT_CONF_ID_recover << 16),
-    WT_CONF_ID_Log | (WT_CONF_ID_remove << 16),
-    WT_CONF_ID_Log | (WT_CONF_ID_zero_fill << 16),
-  },
+    WT_CONF_ID_Log | (WT_CONF_ID_recover_threads << 16), WT_CONF_ID_Log | (WT_CONF_ID_remove << 16),
+    WT_CONF_ID_Log | (WT_CONF_ID_zero_fill << 16),},
   {
     {
       WT_CONF_ID_Lsm | (WT_CONF_ID_Merge_custom << 16) | (WT_CONF_ID_prefix << 32),
@@ -865,10 +890,10 @@ static const struct {
     WT_CONF_ID_Operation_tracking | (WT_CONF_ID_enabled << 16),
     WT_CONF_ID_Operation_tracking | (WT_CONF_ID_path << 16),
   },
-  {
-    WT_CONF_ID_Prefetch | (WT_CONF_ID_available << 16),
+  {WT_CONF_ID_Prefetch | (WT_CONF_ID_available << 16),
     WT_CONF_ID_Prefetch | (WT_CONF_ID_default << 16),
-  },
+    WT_CONF_ID_Prefetch | (WT_CONF_ID_warm_restart << 16),
+    WT_CONF_ID_Prefetch | (WT_CONF_ID_warm_restart_pages << 16),},
   {
     WT_CONF_ID_Roundup_timestamps | (WT_CONF_ID_prepared << 16),
     WT_CONF_ID_Roundup_timestamps | (WT_CONF_ID_read << 16),
@@ -898,10 +923,9 @@ static const struct {
     WT_CONF_ID_Tiered_storage | (WT_CONF_ID_name << 16),
     WT_CONF_ID_Tiered_storage | (WT_CONF_ID_shared << 16),
   },
-  {
-    WT_CONF_ID_Transaction_sync | (WT_CONF_ID_enabled << 16),
-    WT_CONF_ID_Transaction_sync | (WT_CONF_ID_method << 16),
-  },
+  {WT_CONF_ID_Transaction_sync | (WT_CONF_ID_enabled << 16),
+    WT_CONF_ID_Transaction_sync | (WT_CONF_ID_latency_target << 16),
+    WT_CONF_ID_Transaction_sync | (WT_CONF_ID_method << 16),},
   WT_CONF_ID_access_pattern_hint,
   WT_CONF_ID_action,
   WT_CONF_ID_allocation_size,
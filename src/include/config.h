@@ -276,6 +276,7 @@ extern const char __WT_CONFIG_CHOICE_recovery[];
 extern const char __WT_CONFIG_CHOICE_recovery_progress[];
 extern const char __WT_CONFIG_CHOICE_rts[];
 extern const char __WT_CONFIG_CHOICE_salvage[];
+extern const char __WT_CONFIG_CHOICE_segregated[];
 extern const char __WT_CONFIG_CHOICE_sequential[];
 extern const char __WT_CONFIG_CHOICE_set[];
 extern const char __WT_CONFIG_CHOICE_shared_cache[];
@@ -299,6 +300,7 @@ extern const char __WT_CONFIG_CHOICE_thread_group[];
 extern const char __WT_CONFIG_CHOICE_tiered[];
 extern const char __WT_CONFIG_CHOICE_tiered_flush_finish[];
 extern const char __WT_CONFIG_CHOICE_timestamp[];
+extern const char __WT_CONFIG_CHOICE_tinylfu[];
 extern const char __WT_CONFIG_CHOICE_transaction[];
 extern const char __WT_CONFIG_CHOICE_tree_walk[];
 extern const char __WT_CONFIG_CHOICE_true[];
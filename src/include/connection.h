@@ -158,6 +158,28 @@ struct __wt_keyed_encryptor {
     TAILQ_ENTRY(__wt_keyed_encryptor) q;
 };
 
+/*
+ * WT_PREFETCH_WARM_PAGE --
+ *	A page on a tree's warm restart list.
+ */
+struct __wt_prefetch_warm_page {
+    WT_REF *ref;      /* Ref, once found in the tree */
+    uint64_t hotness; /* Read generation, or rank in the list */
+
+    uint8_t addr[WT_BTREE_MAX_ADDR_COOKIE]; /* Address cookie */
+    uint8_t addr_size;
+};
+
+/*
+ * WT_PREFETCH_WARM --
+ *	A tree's warm restart list.
+ */
+struct __wt_prefetch_warm {
+    WT_PREFETCH_WARM_PAGE *pages;
+    size_t pages_allocated;
+    size_t entries;
+};
+
 /*
  * WT_NAMED_COLLATOR --
  *	A collator list entry
@@ -494,6 +516,8 @@ struct __wt_connection_impl {
     uint64_t ckpt_skip;            /* Checkpoint handles skipped */
     uint64_t ckpt_skip_time;       /* Checkpoint skipped handles gather time */
     uint64_t ckpt_usecs;           /* Checkpoint timer */
+    uint64_t ckpt_pace_usecs;      /* Checkpoint write pacing period */
+    uint64_t ckpt_flush_usecs;     /* Checkpoint background flush timer */
 
     uint64_t ckpt_scrub_max; /* Checkpoint scrub time min/max */
     uint64_t ckpt_scrub_min;
@@ -587,6 +611,13 @@ struct __wt_connection_impl {
     bool prefetch_auto_on;
     bool prefetch_available;
 
+    bool prefetch_warm_restart;             /* Record and reload hot pages */
+    u_int prefetch_warm_pages;              /* Pages recorded per tree */
+    WT_SESSION_IMPL *prefetch_warm_session; /* Warm restart session */
+    wt_thread_t prefetch_warm_tid;          /* Warm restart thread */
+    bool prefetch_warm_tid_set;             /* Warm restart thread set */
+    wt_shared bool prefetch_warm_loading;   /* Warm restart pages being queued */
+
 #define WT_STATLOG_FILENAME "WiredTigerStat.%d.%H"
     WT_SESSION_IMPL *stat_session; /* Statistics log session */
     wt_thread_t stat_tid;          /* Statistics log thread */
@@ -648,15 +679,18 @@ struct __wt_connection_impl {
     WT_LOG *log;                           /* Logging structure */
     WT_COMPRESSOR *log_compressor;         /* Logging compressor */
     wt_shared uint32_t log_cursors;        /* Log cursor count */
+    size_t log_dict_size;                  /* Log compression dictionary size */
     wt_off_t log_dirty_max;                /* Log dirty system cache max size */
     wt_off_t log_file_max;                 /* Log file max size */
     uint32_t log_force_write_wait;         /* Log force write wait configuration */
     const char *log_path;                  /* Logging path format */
     uint32_t log_prealloc;                 /* Log file pre-allocation */
     uint32_t log_prealloc_init_count;      /* initial number of pre-allocated log files */
+    u_int log_recover_threads;             /* Recovery log apply threads */
     uint16_t log_req_max;                  /* Max required log version */
     uint16_t log_req_min;                  /* Min required log version */
     wt_shared uint32_t txn_logsync;        /* Log sync configuration */
+    uint64_t txn_logsync_target;           /* Log sync commit latency target (usecs) */
 
     WT_ROLLBACK_TO_STABLE *rts, _rts;   /* Rollback to stable subsystem */
     WT_SESSION_IMPL *meta_ckpt_session; /* Metadata checkpoint session */
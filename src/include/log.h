@@ -101,15 +101,37 @@ union __wt_lsn {
 #define WT_LOG_SKIP_HEADER(data) ((const uint8_t *)(data) + offsetof(WT_LOG_RECORD, record))
 #define WT_LOG_REC_SIZE(size) ((size)-offsetof(WT_LOG_RECORD, record))
 
+#define WT_LOG_COMPRESS_SKIP (offsetof(WT_LOG_RECORD, record))
+#define WT_LOG_ENCRYPT_SKIP (offsetof(WT_LOG_RECORD, record))
+
 /*
  * We allocate the buffer size, but trigger a slot switch when we cross the maximum size of half the
  * buffer. If a record is more than the buffer maximum then we trigger a slot switch and write that
  * record unbuffered. We use a larger buffer to provide overflow space so that we can switch once we
  * cross the threshold.
+ *
+ * Slot buffers start at WT_LOG_SLOT_BUF_SIZE and grow when records are written unbuffered, up to
+ * WT_LOG_SLOT_BUF_SIZE_MAX. Slots are resized as they're reused, so the limit is per slot.
+ */
+#define WT_LOG_SLOT_BUF_SIZE (256 * 1024)          /* Must be power of 2 */
+#define WT_LOG_SLOT_BUF_SIZE_MAX (4 * WT_MEGABYTE) /* Must be power of 2 */
+#define WT_LOG_SLOT_BUF_MAX(slot) ((uint32_t)(slot)->slot_buf_size / 2)
+#define WT_LOG_SLOT_UNBUFFERED (WT_LOG_SLOT_BUF_SIZE_MAX << 1)
+
+/*
+ * Slot buffer sizing is checked once a second after at least this many slot closes. Buffers grow
+ * when at least 1% of slots close for unbuffered records and shrink after this many checks without
+ * records larger than a quarter of the buffer. Growing the buffers shrinks the number of slots in
+ * use to bound the memory used, down to a minimum pool depth.
+ */
+#define WT_LOG_SLOT_RESIZE_CLOSES 100
+#define WT_LOG_SLOT_RESIZE_IDLE 10
+#define WT_LOG_SLOT_POOL_MIN 8
+
+/*
+ * Lost races to join a slot are retried without yielding, up to a limit.
  */
-#define WT_LOG_SLOT_BUF_SIZE (256 * 1024) /* Must be power of 2 */
-#define WT_LOG_SLOT_BUF_MAX ((uint32_t)log->slot_buf_size / 2)
-#define WT_LOG_SLOT_UNBUFFERED (WT_LOG_SLOT_BUF_SIZE << 1)
+#define WT_LOG_SLOT_JOIN_SPINS 16
 
 /*
  * Possible values for the consolidation array slot states:
@@ -183,10 +205,10 @@ union __wt_lsn {
 #define WT_LOG_SLOT_INPROGRESS(state) (WT_LOG_SLOT_RELEASED(state) != WT_LOG_SLOT_JOINED(state))
 #define WT_LOG_SLOT_DONE(state) (WT_LOG_SLOT_CLOSED(state) && !WT_LOG_SLOT_INPROGRESS(state))
 /* Slot is in use, more threads may join this slot */
-#define WT_LOG_SLOT_OPEN(state)                                           \
+#define WT_LOG_SLOT_OPEN(slot, state)                                     \
     (WT_LOG_SLOT_ACTIVE(state) && !WT_LOG_SLOT_UNBUFFERED_ISSET(state) && \
       !FLD_LOG_SLOT_ISSET((uint64_t)(state), WT_LOG_SLOT_CLOSE) &&        \
-      WT_LOG_SLOT_JOINED(state) < WT_LOG_SLOT_BUF_MAX)
+      WT_LOG_SLOT_JOINED(state) < WT_LOG_SLOT_BUF_MAX(slot))
 
 struct __wt_logslot {
     WT_CACHE_LINE_PAD_BEGIN
@@ -200,13 +222,16 @@ struct __wt_logslot {
     WT_LSN slot_end_lsn;                   /* Slot ending LSN */
     WT_FH *slot_fh;                        /* File handle for this group */
     WT_ITEM slot_buf;                      /* Buffer for grouped writes */
+    size_t slot_buf_size;                  /* Buffer size */
+    wt_shared uint32_t slot_sync_joins;    /* Synchronous commits in this group */
 
 /* AUTOMATIC FLAG VALUE GENERATION START 0 */
 #define WT_SLOT_CLOSEFH 0x01u        /* Close old fh on release */
 #define WT_SLOT_FLUSH 0x02u          /* Wait for write */
-#define WT_SLOT_SYNC 0x04u           /* Needs sync on release */
-#define WT_SLOT_SYNC_DIR 0x08u       /* Directory sync on release */
-#define WT_SLOT_SYNC_DIRTY 0x10u     /* Sync system buffers on release */
+#define WT_SLOT_GROUP_WAIT 0x04u     /* Held open for group commit */
+#define WT_SLOT_SYNC 0x08u           /* Needs sync on release */
+#define WT_SLOT_SYNC_DIR 0x10u       /* Directory sync on release */
+#define WT_SLOT_SYNC_DIRTY 0x20u     /* Sync system buffers on release */
                                      /* AUTOMATIC FLAG VALUE GENERATION STOP 16 */
     wt_shared uint16_t flags_atomic; /* Atomic flags, use F_*_ATOMIC_16 */
     WT_CACHE_LINE_PAD_END
@@ -237,9 +262,32 @@ struct __wt_myslot {
 
 #define WT_LOG_END_HEADER log->allocsize
 
+/*
+ * WT_LOG_DICT --
+ *	A log compression dictionary. Records are compressed with the current dictionary. Writers pin
+ * the dictionary until their record has joined a slot, and a new log file starts with the current
+ * dictionary and any pinned dictionaries, so every record's dictionary is in the record's file.
+ */
+struct __wt_log_dict {
+    WT_ITEM data;            /* Dictionary content */
+    void *handle;            /* Dictionary loaded by the compressor */
+    wt_shared uint32_t pins; /* Writers compressing with the dictionary */
+    uint16_t version;        /* Dictionary version, 0 if unused */
+};
+
+/*
+ * Dictionaries that can be in use at once, and the sampling of records for the next dictionary:
+ * each record contributes up to the sample maximum, and the samples are limited to a multiple of
+ * the dictionary size.
+ */
+#define WT_LOG_DICT_SLOTS 4
+#define WT_LOG_DICT_SAMPLE_FACTOR 8
+#define WT_LOG_DICT_SAMPLE_MAX (4 * WT_KILOBYTE)
+
 struct __wt_log {
     uint32_t allocsize;             /* Allocation alignment size */
     uint32_t first_record;          /* Offset of first record in file */
+    uint32_t record_start;          /* Offset of first record after system records in file */
     wt_off_t log_written;           /* Amount of log written this period */
                                     /*
                                      * Log file information
@@ -295,7 +343,47 @@ struct __wt_log {
     wt_shared WT_LOGSLOT *active_slot;            /* Active slot */
     wt_shared WT_LOGSLOT slot_pool[WT_SLOT_POOL]; /* Pool of all slots */
     int32_t pool_index;                           /* Index into slot pool */
+    int32_t pool_depth;                           /* Slots in use from the pool */
     size_t slot_buf_size;                         /* Buffer size for slots */
+
+    /*
+     * Slot buffer sizing: the buffer size adapts to the size of the records written.
+     */
+    size_t slot_buf_init;                   /* Initial and smallest buffer size */
+    size_t slot_buf_limit;                  /* Largest buffer size */
+    uint64_t slot_closes;                   /* Slot closes, under the slot lock */
+    uint64_t slot_no_free;                  /* Slot pool exhausted, under the slot lock */
+    uint64_t slot_resize_closes;            /* Slot closes at the last sizing check */
+    u_int slot_resize_hold;                 /* Sizing checks until buffers may grow */
+    u_int slot_resize_idle;                 /* Sizing checks without large records */
+    wt_shared uint64_t slot_large;          /* Records too large for half a buffer */
+    wt_shared uint64_t slot_unbuffered;     /* Records written unbuffered */
+    wt_shared uint64_t slot_unbuffered_max; /* Largest record written unbuffered */
+
+    /*
+     * Adaptive group commit: moving averages of the time a sync takes and the time between
+     * synchronous commits, used to decide how long a synchronous commit holds its slot open.
+     */
+    wt_shared uint64_t group_arrival_usecs; /* Time between synchronous commits */
+    wt_shared uint64_t group_fsync_usecs;   /* Time to sync the log */
+    wt_shared uint32_t group_inflight;      /* Synchronous commits in progress */
+    wt_shared uint64_t group_last_arrival;  /* Clock time of the last synchronous commit */
+
+    /*
+     * Log compression dictionaries: the log server builds a dictionary from sampled records, and it
+     * becomes the current dictionary when the next log file is created.
+     */
+    size_t dict_size;                    /* Configured dictionary size, 0 if not used */
+    WT_LOG_DICT dict[WT_LOG_DICT_SLOTS]; /* Dictionaries in use */
+    wt_shared WT_LOG_DICT *dict_current; /* Dictionary for new records */
+    WT_LOG_DICT dict_pending;            /* Dictionary for the next log file, under the slot lock */
+    uint16_t dict_version;               /* Last dictionary version */
+    WT_SPINLOCK dict_sample_lock;        /* Locked: sampled records */
+    WT_ITEM dict_sample;                 /* Sampled records */
+    size_t *dict_sample_sizes;           /* Sampled record sizes */
+    size_t dict_nsamples;                /* Count of sampled records */
+    size_t dict_samples_max;             /* Maximum count of sampled records */
+    wt_shared bool dict_sample_full;     /* No room for more samples */
 #ifdef HAVE_DIAGNOSTIC
     uint64_t write_calls; /* Calls to log_write */
 #endif
@@ -315,16 +403,18 @@ struct __wt_log_record {
 /*
  * No automatic generation: flag values cannot change, they're written to disk.
  *
- * Unused bits in the flags, as well as the 'unused' padding, are expected to be zeroed; we check
- * that to help detect file corruption.
+ * Unused bits in the flags are expected to be zeroed, and the dictionary version is expected to be
+ * set only for records compressed with a dictionary; we check that to help detect file corruption.
  */
 #define WT_LOG_RECORD_COMPRESSED 0x01u /* Compressed except hdr */
 #define WT_LOG_RECORD_ENCRYPTED 0x02u  /* Encrypted except hdr */
-#define WT_LOG_RECORD_ALL_FLAGS (WT_LOG_RECORD_COMPRESSED | WT_LOG_RECORD_ENCRYPTED)
-    uint16_t flags;    /* 08-09: Flags */
-    uint8_t unused[2]; /* 10-11: Padding */
-    uint32_t mem_len;  /* 12-15: Uncompressed len if needed */
-    uint8_t record[0]; /* Beginning of actual data */
+#define WT_LOG_RECORD_DICTIONARY 0x04u /* Compressed with a dictionary */
+#define WT_LOG_RECORD_ALL_FLAGS \
+    (WT_LOG_RECORD_COMPRESSED | WT_LOG_RECORD_ENCRYPTED | WT_LOG_RECORD_DICTIONARY)
+    uint16_t flags;        /* 08-09: Flags */
+    uint16_t dict_version; /* 10-11: Compression dictionary version */
+    uint32_t mem_len;      /* 12-15: Uncompressed len if needed */
+    uint8_t record[0];     /* Beginning of actual data */
 };
 
 /*
@@ -338,6 +428,7 @@ __wt_log_record_byteswap(WT_LOG_RECORD *record)
     record->len = __wt_bswap32(record->len);
     record->checksum = __wt_bswap32(record->checksum);
     record->flags = __wt_bswap16(record->flags);
+    record->dict_version = __wt_bswap16(record->dict_version);
     record->mem_len = __wt_bswap32(record->mem_len);
 #else
     WT_UNUSED(record);
@@ -358,9 +449,9 @@ struct __wt_log_desc {
                          * through 5.
                          */
 #define WT_LOG_VERSION 5
-    uint16_t version;  /* 04-05: Log version */
-    uint16_t unused;   /* 06-07: Unused */
-    uint64_t log_size; /* 08-15: Log file size */
+    uint16_t version;      /* 04-05: Log version */
+    uint16_t dict_version; /* 06-07: Newest compression dictionary in the file */
+    uint64_t log_size;     /* 08-15: Log file size */
 };
 /*
  * This is the log version that introduced the system record.
@@ -388,7 +479,7 @@ __wt_log_desc_byteswap(WT_LOG_DESC *desc)
 #ifdef WORDS_BIGENDIAN
     desc->log_magic = __wt_bswap32(desc->log_magic);
     desc->version = __wt_bswap16(desc->version);
-    desc->unused = __wt_bswap16(desc->unused);
+    desc->dict_version = __wt_bswap16(desc->dict_version);
     desc->log_size = __wt_bswap64(desc->log_size);
 #else
     WT_UNUSED(desc);
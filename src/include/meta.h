@@ -16,6 +16,9 @@
 
 #define WT_USERCONFIG "WiredTiger.config" /* User configuration */
 
+#define WT_WARM_RESTART "WiredTiger.warm"         /* Warm restart page list */
+#define WT_WARM_RESTART_SET "WiredTiger.warm.set" /* Warm restart temp file */
+
 /*
  * Backup related WiredTiger files.
  */
@@ -36,6 +39,15 @@
 #define WT_HS_FILE "WiredTigerHS.wt"     /* History store table */
 #define WT_HS_URI "file:WiredTigerHS.wt" /* History store table URI */
 
+/*
+ * Files configured with a history store of their own keep their history in a file named for their
+ * file ID, "WiredTigerHS.<id>.wt". The prefix matches the shared history store as well.
+ */
+#define WT_HS_FILE_PREFIX "WiredTigerHS."     /* History store file prefix */
+#define WT_HS_URI_PREFIX "file:WiredTigerHS." /* History store URI prefix */
+#define WT_HS_URI_SIZE 40                     /* History store URI buffer size */
+#define WT_IS_HS_URI(uri) WT_PREFIX_MATCH(uri, WT_HS_URI_PREFIX)
+
 #define WT_CC_METAFILE "WiredTigerCC.wt"          /* Chunk cache metadata table */
 #define WT_CC_METAFILE_URI "file:WiredTigerCC.wt" /* Chunk cache metadata table URI */
 
@@ -190,3 +202,14 @@ struct __wt_ckpt_snapshot {
     uint64_t *snapshot_txns;
     uint32_t snapshot_count;
 };
+
+/*
+ * WT_CKPT_META_UPDATE --
+ *     A file's checkpoint metadata, written when the database checkpoint has checkpointed all of its
+ *     trees.
+ */
+struct __wt_ckpt_meta_update {
+    char *uri;   /* File URI */
+    char *value; /* Metadata value */
+    u_int order; /* Order of the update */
+};
@@ -221,6 +221,17 @@ struct __wt_session_impl {
     u_int ckpt_handle_next;       /* Next empty slot */
     size_t ckpt_handle_allocated; /* Bytes allocated */
 
+    /* Checkpoint handles for the history stores of individual files */
+    WT_DATA_HANDLE **ckpt_hs_handle; /* Handle list */
+    u_int ckpt_hs_handle_next;       /* Next empty slot */
+    size_t ckpt_hs_handle_allocated; /* Bytes allocated */
+
+    /* Metadata updates deferred to the end of a checkpoint's tree checkpoints */
+    WT_CKPT_META_UPDATE *ckpt_meta; /* Update list */
+    u_int ckpt_meta_next;           /* Next empty slot */
+    size_t ckpt_meta_allocated;     /* Bytes allocated */
+    bool ckpt_meta_defer;           /* Defer metadata updates */
+
     /* Named checkpoint drop list, during a checkpoint */
     WT_ITEM *ckpt_drop_list;
 
@@ -443,10 +443,16 @@ struct __wt_connection_stats {
     int64_t backup_blocks;
     int64_t backup_blocks_compressed;
     int64_t backup_blocks_uncompressed;
+    int64_t block_cache_admission_admitted;
+    int64_t block_cache_admission_rejected;
+    int64_t block_cache_blocks_compressed;
     int64_t block_cache_blocks_update;
     int64_t block_cache_bytes_update;
+    int64_t block_cache_blocks_promoted;
+    int64_t block_cache_capacity_multiplier;
     int64_t block_cache_blocks_evicted;
     int64_t block_cache_bypass_filesize;
+    int64_t block_cache_hit_ratio;
     int64_t block_cache_lookups;
     int64_t block_cache_not_evicted_overhead;
     int64_t block_cache_bypass_writealloc;
@@ -456,8 +462,10 @@ struct __wt_connection_stats {
     int64_t block_cache_eviction_passes;
     int64_t block_cache_hits;
     int64_t block_cache_misses;
+    int64_t block_cache_bypass_bucket_full;
     int64_t block_cache_bypass_chkpt;
     int64_t block_cache_blocks_removed;
+    int64_t block_cache_decompress_time;
     int64_t block_cache_blocks_removed_blocked;
     int64_t block_cache_blocks;
     int64_t block_cache_blocks_insert_read;
@@ -468,6 +476,7 @@ struct __wt_connection_stats {
     int64_t block_preload;
     int64_t block_read;
     int64_t block_write;
+    int64_t block_write_batch_blocks;
     int64_t block_byte_read;
     int64_t block_byte_read_mmap;
     int64_t block_byte_read_syscall;
@@ -476,6 +485,9 @@ struct __wt_connection_stats {
     int64_t block_byte_write_checkpoint;
     int64_t block_byte_write_mmap;
     int64_t block_byte_write_syscall;
+    int64_t block_write_batch;
+    int64_t block_extlist_incremental;
+    int64_t block_extlist_consolidate;
     int64_t block_map_read;
     int64_t block_byte_map_read;
     int64_t block_remap_file_resize;
@@ -570,14 +582,18 @@ struct __wt_connection_stats {
     int64_t cache_hazard_checks;
     int64_t cache_hazard_walks;
     int64_t cache_hazard_max;
+    int64_t cache_hs_bloom_build;
     int64_t cache_hs_insert;
     int64_t cache_hs_insert_restart;
     int64_t cache_hs_ondisk_max;
     int64_t cache_hs_ondisk;
     int64_t cache_hs_read;
     int64_t cache_hs_read_miss;
+    int64_t cache_hs_bloom_false_positive;
     int64_t cache_hs_read_squash;
+    int64_t cache_hs_bloom_skip;
     int64_t cache_hs_order_lose_durable_timestamp;
+    int64_t cache_hs_read_squash_modify;
     int64_t cache_hs_key_truncate_rts_unstable;
     int64_t cache_hs_key_truncate_rts;
     int64_t cache_hs_btree_truncate;
@@ -604,6 +620,7 @@ struct __wt_connection_stats {
     int64_t cache_eviction_maximum_page_size;
     int64_t cache_eviction_dirty;
     int64_t cache_eviction_app_dirty;
+    int64_t cache_update_chain_consolidate_modify;
     int64_t cache_eviction_blocked_multi_block_reconcilation_during_checkpoint;
     int64_t cache_timed_out_ops;
     int64_t cache_eviction_blocked_overflow_keys;
@@ -639,6 +656,7 @@ struct __wt_connection_stats {
     int64_t cache_eviction_blocked_recently_modified;
     int64_t cache_reverse_splits;
     int64_t cache_reverse_splits_skipped_vlcs;
+    int64_t cache_hs_insert_reverse_modify_saved;
     int64_t cache_hs_insert_full_update;
     int64_t cache_hs_insert_reverse_modify;
     int64_t cache_reentry_hs_eviction_milliseconds;
@@ -648,6 +666,11 @@ struct __wt_connection_stats {
     int64_t cache_pages_dirty;
     int64_t cache_eviction_blocked_uncommitted_truncate;
     int64_t cache_eviction_clean;
+    int64_t cache_update_chain_lt10;
+    int64_t cache_update_chain_lt100;
+    int64_t cache_update_chain_lt1000;
+    int64_t cache_update_chain_ge1000;
+    int64_t cache_update_chain_consolidate;
     int64_t fsync_all_fh_total;
     int64_t fsync_all_fh;
     int64_t fsync_all_time;
@@ -657,13 +680,16 @@ struct __wt_connection_stats {
     int64_t capacity_bytes_evict;
     int64_t capacity_bytes_log;
     int64_t capacity_bytes_written;
+    int64_t capacity_ckpt_pace_rate;
     int64_t capacity_threshold;
     int64_t capacity_time_total;
     int64_t capacity_time_ckpt;
     int64_t capacity_time_evict;
     int64_t capacity_time_log;
     int64_t capacity_time_read;
+    int64_t capacity_time_ckpt_pace;
     int64_t capacity_time_chunkcache;
+    int64_t checkpoint_flush;
     int64_t checkpoint_cleanup_success;
     int64_t checkpoint_snapshot_acquired;
     int64_t checkpoint_skipped;
@@ -678,6 +704,7 @@ struct __wt_connection_stats {
     int64_t checkpoint_handle_skip_duration;
     int64_t checkpoint_handle_meta_check_duration;
     int64_t checkpoint_handle_lock_duration;
+    int64_t checkpoint_meta_update_duration;
     int64_t checkpoint_handle_applied;
     int64_t checkpoint_handle_dropped;
     int64_t checkpoint_handle_meta_checked;
@@ -692,6 +719,7 @@ struct __wt_connection_stats {
     int64_t checkpoint_hs_pages_reconciled;
     int64_t checkpoint_pages_visited_internal;
     int64_t checkpoint_pages_visited_leaf;
+    int64_t checkpoint_flush_pages;
     int64_t checkpoint_pages_reconciled;
     int64_t checkpoint_cleanup_pages_evict;
     int64_t checkpoint_cleanup_pages_removed;
@@ -728,6 +756,11 @@ struct __wt_connection_stats {
     int64_t chunkcache_metadata_work_units_dequeued;
     int64_t chunkcache_misses;
     int64_t chunkcache_io_failed;
+    int64_t chunkcache_prefetch_hits;
+    int64_t chunkcache_prefetch_queued;
+    int64_t chunkcache_prefetch_queue_depth;
+    int64_t chunkcache_prefetch_read;
+    int64_t chunkcache_prefetch_wasted;
     int64_t chunkcache_retries;
     int64_t chunkcache_retries_checksum_mismatch;
     int64_t chunkcache_toomany_retries;
@@ -863,17 +896,38 @@ struct __wt_connection_stats {
     int64_t lock_txn_global_read_count;
     int64_t lock_txn_global_write_count;
     int64_t log_slot_switch_busy;
+    int64_t log_compress_ratio;
     int64_t log_force_remove_sleep;
+    int64_t log_group_fsync_usecs;
+    int64_t log_group_arrival_usecs;
+    int64_t log_group_latency_lt100;
+    int64_t log_group_latency_lt250;
+    int64_t log_group_latency_lt500;
+    int64_t log_group_latency_lt1000;
+    int64_t log_group_latency_lt10000;
+    int64_t log_group_latency_gt10000;
+    int64_t log_group_latency_total_usecs;
+    int64_t log_group_size_1;
+    int64_t log_group_size_lt4;
+    int64_t log_group_size_lt8;
+    int64_t log_group_size_lt16;
+    int64_t log_group_size_lt32;
+    int64_t log_group_size_gt32;
+    int64_t log_group_holds;
+    int64_t log_group_hold_usecs;
     int64_t log_bytes_payload;
     int64_t log_bytes_written;
+    int64_t log_compress_dict_builds;
     int64_t log_zero_fills;
     int64_t log_flush;
     int64_t log_force_write;
     int64_t log_force_write_skip;
     int64_t log_compress_writes;
+    int64_t log_compress_dict_writes;
     int64_t log_compress_write_fails;
     int64_t log_compress_small;
     int64_t log_release_write_lsn;
+    int64_t log_write_lsn_release;
     int64_t log_scans;
     int64_t log_scan_rereads;
     int64_t log_write_lsn;
@@ -890,6 +944,10 @@ struct __wt_connection_stats {
     int64_t log_prealloc_files;
     int64_t log_prealloc_used;
     int64_t log_scan_records;
+    int64_t log_slot_buffer_size;
+    int64_t log_slot_buffer_shrink_pool;
+    int64_t log_slot_buffer_shrink_small;
+    int64_t log_slot_buffer_grow_unbuffered;
     int64_t log_slot_close_race;
     int64_t log_slot_close_unbuf;
     int64_t log_slot_closes;
@@ -903,6 +961,9 @@ struct __wt_connection_stats {
     int64_t log_slot_yield_duration;
     int64_t log_slot_no_free_slots;
     int64_t log_slot_unbuffered;
+    int64_t log_slot_pool_depth;
+    int64_t log_compress_time;
+    int64_t log_decompress_time;
     int64_t log_compress_mem;
     int64_t log_buffer_size;
     int64_t log_compress_len;
@@ -952,6 +1013,9 @@ struct __wt_connection_stats {
     int64_t prefetch_pages_queued;
     int64_t prefetch_pages_read;
     int64_t prefetch_attempts;
+    int64_t prefetch_warm_pages_missing;
+    int64_t prefetch_warm_pages_queued;
+    int64_t prefetch_warm_pages_recorded;
     int64_t rec_vlcs_emptied_pages;
     int64_t rec_time_window_bytes_ts;
     int64_t rec_time_window_bytes_txn;
@@ -1099,6 +1163,8 @@ struct __wt_connection_stats {
     int64_t txn_pinned_timestamp_oldest;
     int64_t txn_timestamp_oldest_active_read;
     int64_t txn_rollback_to_stable_running;
+    int64_t txn_snapshot_cached;
+    int64_t txn_snapshot_cache_miss;
     int64_t txn_walk_sessions;
     int64_t txn_commit;
     int64_t txn_rollback;
@@ -1192,12 +1258,16 @@ struct __wt_dsrc_stats {
     int64_t cache_eviction_walk_from_root;
     int64_t cache_eviction_walk_saved_pos;
     int64_t cache_eviction_blocked_hazard;
+    int64_t cache_hs_bloom_build;
     int64_t cache_hs_insert;
     int64_t cache_hs_insert_restart;
     int64_t cache_hs_read;
     int64_t cache_hs_read_miss;
+    int64_t cache_hs_bloom_false_positive;
     int64_t cache_hs_read_squash;
+    int64_t cache_hs_bloom_skip;
     int64_t cache_hs_order_lose_durable_timestamp;
+    int64_t cache_hs_read_squash_modify;
     int64_t cache_hs_key_truncate_rts_unstable;
     int64_t cache_hs_key_truncate_rts;
     int64_t cache_hs_btree_truncate;
@@ -1217,6 +1287,7 @@ struct __wt_dsrc_stats {
     int64_t cache_eviction_split_leaf;
     int64_t cache_eviction_random_sample_inmem_root;
     int64_t cache_eviction_dirty;
+    int64_t cache_update_chain_consolidate_modify;
     int64_t cache_eviction_blocked_multi_block_reconcilation_during_checkpoint;
     int64_t cache_eviction_blocked_overflow_keys;
     int64_t cache_read_overflow;
@@ -1234,11 +1305,17 @@ struct __wt_dsrc_stats {
     int64_t cache_eviction_blocked_recently_modified;
     int64_t cache_reverse_splits;
     int64_t cache_reverse_splits_skipped_vlcs;
+    int64_t cache_hs_insert_reverse_modify_saved;
     int64_t cache_hs_insert_full_update;
     int64_t cache_hs_insert_reverse_modify;
     int64_t cache_bytes_dirty;
     int64_t cache_eviction_blocked_uncommitted_truncate;
     int64_t cache_eviction_clean;
+    int64_t cache_update_chain_lt10;
+    int64_t cache_update_chain_lt100;
+    int64_t cache_update_chain_lt1000;
+    int64_t cache_update_chain_ge1000;
+    int64_t cache_update_chain_consolidate;
     int64_t cache_state_gen_avg_gap;
     int64_t cache_state_avg_written_size;
     int64_t cache_state_avg_visited_age;
@@ -109,6 +109,9 @@ typedef enum {
               saved_txn_shared_metadata_pinned == WT_TXN_NONE) &&                                \
             (txn_shared_pinned_id == saved_txn_shared_pinned_id ||                               \
               saved_txn_shared_pinned_id == WT_TXN_NONE));                                       \
+        if (saved_txn_shared_metadata_pinned != WT_TXN_NONE ||                                   \
+          saved_txn_shared_pinned_id != WT_TXN_NONE)                                             \
+            __wt_txn_shared_active(s);                                                           \
         __wt_atomic_storev64(&txn_shared->metadata_pinned, saved_txn_shared_metadata_pinned);    \
         __wt_atomic_storev64(&txn_shared->pinned_id, saved_txn_shared_pinned_id);                \
     } while (0)
@@ -188,6 +191,32 @@ struct __wt_txn_global {
     wt_shared volatile uint64_t metadata_pinned; /* Oldest ID for metadata */
 
     WT_TXN_SHARED *txn_shared_list; /* Per-session shared transaction states */
+
+    /*
+     * One byte per session, set before a session publishes anything in its shared transaction
+     * state and cleared once all of it has been cleared again. Walks of the shared states use it
+     * to skip idle sessions a word at a time, rather than reading a cache line for every session.
+     */
+    wt_shared uint64_t *txn_active_map;
+
+    /*
+     * The commit sequence number is bumped every time a transaction ID leaves the global table,
+     * that is, every time the set of running transactions shrinks. Together with the current ID,
+     * which grows whenever the set gains a member, it identifies the set of running transactions:
+     * while neither moves, every snapshot built by a reader without a transaction ID is the same.
+     * The most recently built snapshot is cached under a sequence lock (odd while being written) so
+     * readers can copy it instead of walking the session array and sorting the result.
+     */
+    wt_shared volatile uint64_t commit_seq;
+    struct {
+        wt_shared volatile uint64_t version; /* Sequence lock */
+        wt_shared uint64_t commit_seq;       /* Commit sequence number of the snapshot */
+        wt_shared uint64_t current_id;       /* Current ID of the snapshot */
+        wt_shared uint64_t pinned_id;        /* Oldest ID in the snapshot */
+        wt_shared uint64_t metadata_pinned;  /* Checkpoint ID included in the snapshot */
+        wt_shared uint32_t count;            /* Snapshot ID count */
+        wt_shared uint64_t *snapshot;        /* Sorted snapshot IDs */
+    } snapshot_cache;
 };
 
 typedef enum __wt_txn_isolation {
@@ -289,6 +318,8 @@ struct __wt_txn {
 
     uint32_t forced_iso; /* Isolation is currently forced. */
 
+    bool shared_active; /* Session is marked in the global active map. */
+
     uint32_t txn_logsync; /* Log sync configuration */
 
     /* Snapshot data. */
@@ -1487,6 +1487,51 @@ __wt_txn_idle_cache_check(WT_SESSION_IMPL *session)
     return (0);
 }
 
+/*
+ * __wt_txn_shared_active --
+ *     Mark the session in the global active map, before it publishes any shared transaction state.
+ */
+static WT_INLINE void
+__wt_txn_shared_active(WT_SESSION_IMPL *session)
+{
+    WT_TXN *txn;
+
+    txn = session->txn;
+    if (txn->shared_active)
+        return;
+
+    __wt_atomic_store8((uint8_t *)S2C(session)->txn_global.txn_active_map + session->id, 1);
+    /* A walk that misses the mark must also miss anything we publish after it. */
+    WT_FULL_BARRIER();
+    txn->shared_active = true;
+}
+
+/*
+ * __wt_txn_shared_next --
+ *     Return the next session at or after the given slot that may have published shared
+ *     transaction state, or the session count if there are none.
+ */
+static WT_INLINE uint32_t
+__wt_txn_shared_next(WT_SESSION_IMPL *session, uint32_t i, uint32_t session_cnt)
+{
+    WT_TXN_GLOBAL *txn_global;
+
+    txn_global = &S2C(session)->txn_global;
+    for (; i < session_cnt; ++i) {
+        /* Skip a word of idle sessions at a time. */
+        if (i % 8 == 0 && __wt_atomic_load64(&txn_global->txn_active_map[i / 8]) == 0) {
+            i += 7;
+            continue;
+        }
+        if (__wt_atomic_load8((uint8_t *)txn_global->txn_active_map + i) != 0)
+            break;
+    }
+
+    /* Read the session's shared state after its mark. */
+    WT_ACQUIRE_BARRIER();
+    return (WT_MIN(i, session_cnt));
+}
+
 /*
  * __wt_txn_id_alloc --
  *     Allocate a new transaction ID.
@@ -1521,6 +1566,7 @@ __wt_txn_id_alloc(WT_SESSION_IMPL *session, bool publish)
      * well defined, we must use an atomic increment here.
      */
     if (publish) {
+        __wt_txn_shared_active(session);
         WT_RELEASE_WRITE_WITH_BARRIER(txn_shared->is_allocating, true);
         WT_RELEASE_WRITE_WITH_BARRIER(txn_shared->id, txn_global->current);
         id = __wt_atomic_addv64(&txn_global->current, 1) - 1;
@@ -1830,6 +1876,7 @@ __wt_txn_cursor_op(WT_SESSION_IMPL *session)
      * positioned on a value, it can't be freed.
      */
     if (txn->isolation == WT_ISO_READ_UNCOMMITTED) {
+        __wt_txn_shared_active(session);
         if (__wt_atomic_loadv64(&txn_shared->pinned_id) == WT_TXN_NONE)
             __wt_atomic_storev64(
               &txn_shared->pinned_id, __wt_atomic_loadv64(&txn_global->last_running));
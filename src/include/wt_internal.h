@@ -81,8 +81,12 @@ struct __wt_backup_target;
 typedef struct __wt_backup_target WT_BACKUP_TARGET;
 struct __wt_blkcache;
 typedef struct __wt_blkcache WT_BLKCACHE;
+struct __wt_blkcache_bucket;
+typedef struct __wt_blkcache_bucket WT_BLKCACHE_BUCKET;
 struct __wt_blkcache_item;
 typedef struct __wt_blkcache_item WT_BLKCACHE_ITEM;
+struct __wt_blkcache_slab;
+typedef struct __wt_blkcache_slab WT_BLKCACHE_SLAB;
 struct __wt_blkincr;
 typedef struct __wt_blkincr WT_BLKINCR;
 struct __wt_block;
@@ -135,8 +139,12 @@ struct __wt_chunkcache_metadata_work_unit;
 typedef struct __wt_chunkcache_metadata_work_unit WT_CHUNKCACHE_METADATA_WORK_UNIT;
 struct __wt_chunkcache_pinned_list;
 typedef struct __wt_chunkcache_pinned_list WT_CHUNKCACHE_PINNED_LIST;
+struct __wt_chunkcache_prefetch_work_unit;
+typedef struct __wt_chunkcache_prefetch_work_unit WT_CHUNKCACHE_PREFETCH_WORK_UNIT;
 struct __wt_ckpt;
 typedef struct __wt_ckpt WT_CKPT;
+struct __wt_ckpt_meta_update;
+typedef struct __wt_ckpt_meta_update WT_CKPT_META_UPDATE;
 struct __wt_ckpt_snapshot;
 typedef struct __wt_ckpt_snapshot WT_CKPT_SNAPSHOT;
 struct __wt_col;
@@ -257,6 +265,8 @@ struct __wt_hazard_array;
 typedef struct __wt_hazard_array WT_HAZARD_ARRAY;
 struct __wt_hazard_cookie;
 typedef struct __wt_hazard_cookie WT_HAZARD_COOKIE;
+struct __wt_hs_bloom;
+typedef struct __wt_hs_bloom WT_HS_BLOOM;
 struct __wt_ikey;
 typedef struct __wt_ikey WT_IKEY;
 struct __wt_import_entry;
@@ -279,6 +289,8 @@ struct __wt_log;
 typedef struct __wt_log WT_LOG;
 struct __wt_log_desc;
 typedef struct __wt_log_desc WT_LOG_DESC;
+struct __wt_log_dict;
+typedef struct __wt_log_dict WT_LOG_DICT;
 struct __wt_log_op_desc;
 typedef struct __wt_log_op_desc WT_LOG_OP_DESC;
 struct __wt_log_rec_desc;
@@ -345,6 +357,10 @@ struct __wt_prefetch;
 typedef struct __wt_prefetch WT_PREFETCH;
 struct __wt_prefetch_queue_entry;
 typedef struct __wt_prefetch_queue_entry WT_PREFETCH_QUEUE_ENTRY;
+struct __wt_prefetch_warm;
+typedef struct __wt_prefetch_warm WT_PREFETCH_WARM;
+struct __wt_prefetch_warm_page;
+typedef struct __wt_prefetch_warm_page WT_PREFETCH_WARM_PAGE;
 struct __wt_process;
 typedef struct __wt_process WT_PROCESS;
 struct __wt_rec_chunk;
@@ -389,6 +405,8 @@ struct __wt_shutdown_timeline;
 typedef struct __wt_shutdown_timeline WT_SHUTDOWN_TIMELINE;
 struct __wt_size;
 typedef struct __wt_size WT_SIZE;
+struct __wt_size_class;
+typedef struct __wt_size_class WT_SIZE_CLASS;
 struct __wt_spinlock;
 typedef struct __wt_spinlock WT_SPINLOCK;
 struct __wt_split_page_hist;
@@ -13,8 +13,8 @@ static int __log_openfile(WT_SESSION_IMPL *, uint32_t, uint32_t, WT_FH **);
 static int __log_truncate(WT_SESSION_IMPL *, WT_LSN *, bool, bool);
 static int __log_write_internal(WT_SESSION_IMPL *, WT_ITEM *, WT_LSN *, uint32_t);
 
-#define WT_LOG_COMPRESS_SKIP (offsetof(WT_LOG_RECORD, record))
-#define WT_LOG_ENCRYPT_SKIP (offsetof(WT_LOG_RECORD, record))
+/* Synchronous commit latency histogram. */
+WT_STAT_USECS_HIST_INCR_FUNC(logsync, log_group_latency)
 
 /* AUTOMATIC FLAG VALUE GENERATION START 0 */
 #define WT_LOG_OPEN_CREATE_OK 0x1u /* Flag to __log_openfile() */
@@ -285,6 +285,12 @@ __log_fsync_file(WT_SESSION_IMPL *session, WT_LSN *min_lsn, const char *method,
         WT_ASSIGN_LSN(&log->sync_lsn, min_lsn);
         WT_STAT_CONN_INCR(session, log_sync);
         WT_STAT_CONN_INCRV(session, log_sync_duration, fsync_duration_usecs);
+
+        /* Syncs are single-threaded by the lock, update the group commit average. */
+        fsync_duration_usecs =
+          (__wt_atomic_load64(&log->group_fsync_usecs) * 7 + fsync_duration_usecs) / 8;
+        __wt_atomic_store64(&log->group_fsync_usecs, fsync_duration_usecs);
+        WT_STAT_CONN_SET(session, log_group_fsync_usecs, fsync_duration_usecs);
         __wt_cond_signal(session, log->log_sync_cond);
     }
 err:
@@ -620,17 +626,15 @@ err:
 
 /*
  * __log_prealloc --
- *     Pre-allocate a log file.
+ *     Pre-allocate a log file from the given offset.
  */
 static int
-__log_prealloc(WT_SESSION_IMPL *session, WT_FH *fh)
+__log_prealloc(WT_SESSION_IMPL *session, WT_FH *fh, wt_off_t start)
 {
     WT_CONNECTION_IMPL *conn;
     WT_DECL_RET;
-    WT_LOG *log;
 
     conn = S2C(session);
-    log = conn->log;
 
     /*
      * If the user configured zero filling, pre-allocate the log file manually. Otherwise use the
@@ -638,8 +642,7 @@ __log_prealloc(WT_SESSION_IMPL *session, WT_FH *fh)
      */
     if (FLD_ISSET(conn->log_flags, WT_CONN_LOG_ZERO_FILL)) {
         WT_STAT_CONN_INCR(session, log_zero_fills);
-        return (
-          __wt_file_zero(session, fh, log->first_record, conn->log_file_max, WT_THROTTLE_LOG));
+        return (__wt_file_zero(session, fh, start, conn->log_file_max, WT_THROTTLE_LOG));
     }
 
     /* If configured to not extend the file, we're done. */
@@ -669,21 +672,25 @@ __log_size_fit(WT_SESSION_IMPL *session, WT_LSN *lsn, uint64_t recsize)
     conn = S2C(session);
     log = conn->log;
     offset = __wt_lsn_offset(lsn);
-    return (offset == log->first_record || offset + (wt_off_t)recsize < conn->log_file_max);
+    return (offset == log->record_start || offset + (wt_off_t)recsize < conn->log_file_max);
 }
 
 /*
  * __log_decompress --
- *     Decompress a log record.
+ *     Decompress a log record, using the log file's dictionaries if the record was compressed with
+ *     a dictionary.
  */
 static int
-__log_decompress(WT_SESSION_IMPL *session, WT_ITEM *in, WT_ITEM *out)
+__log_decompress(WT_SESSION_IMPL *session, WT_ITEM *in, WT_ITEM *out, WT_LOG_DICT *dicts)
 {
     WT_COMPRESSOR *compressor;
     WT_CONNECTION_IMPL *conn;
+    WT_LOG_DICT *dict;
     WT_LOG_RECORD *logrec;
     size_t result_len, skip;
+    uint64_t time_start, time_stop;
     uint32_t uncompressed_size;
+    u_int i;
 
     conn = S2C(session);
     logrec = (WT_LOG_RECORD *)in->mem;
@@ -691,11 +698,29 @@ __log_decompress(WT_SESSION_IMPL *session, WT_ITEM *in, WT_ITEM *out)
     compressor = conn->log_compressor;
     if (compressor == NULL || compressor->decompress == NULL)
         WT_RET_MSG(session, WT_ERROR, "Compressed record with no configured compressor");
+    dict = NULL;
+    if (F_ISSET(logrec, WT_LOG_RECORD_DICTIONARY)) {
+        for (i = 0; i < WT_LOG_DICT_SLOTS; ++i)
+            if (dicts[i].version == logrec->dict_version && dicts[i].handle != NULL)
+                dict = &dicts[i];
+        if (dict == NULL)
+            WT_RET_MSG(session, WT_ERROR,
+              "Compressed record with log compression dictionary %" PRIu16 " not found",
+              logrec->dict_version);
+    }
     uncompressed_size = logrec->mem_len;
     WT_RET(__wt_buf_initsize(session, out, uncompressed_size));
     memcpy(out->mem, in->mem, skip);
-    WT_RET(compressor->decompress(compressor, &session->iface, (uint8_t *)in->mem + skip,
-      in->size - skip, (uint8_t *)out->mem + skip, uncompressed_size - skip, &result_len));
+    time_start = __wt_clock(session);
+    if (dict == NULL)
+        WT_RET(compressor->decompress(compressor, &session->iface, (uint8_t *)in->mem + skip,
+          in->size - skip, (uint8_t *)out->mem + skip, uncompressed_size - skip, &result_len));
+    else
+        WT_RET(compressor->dict_decompress(compressor, &session->iface, dict->handle,
+          (uint8_t *)in->mem + skip, in->size - skip, (uint8_t *)out->mem + skip,
+          uncompressed_size - skip, &result_len));
+    time_stop = __wt_clock(session);
+    WT_STAT_CONN_INCRV(session, log_decompress_time, WT_CLOCKDIFF_US(time_stop, time_start));
 
     /*
      * If checksums were turned off because we're depending on the decompression to fail on any
@@ -728,6 +753,99 @@ __log_decrypt(WT_SESSION_IMPL *session, WT_ITEM *in, WT_ITEM *out)
     return (__wt_decrypt(session, encryptor, WT_LOG_ENCRYPT_SKIP, in, out));
 }
 
+/*
+ * __log_dict_read --
+ *     Load the compression dictionaries written at the start of a log file. The file header names
+ *     the newest dictionary in the file, the dictionaries follow the previous LSN record.
+ */
+static int
+__log_dict_read(
+  WT_SESSION_IMPL *session, WT_FH *log_fh, wt_off_t log_size, uint32_t allocsize, WT_LOG_DICT *dicts)
+{
+    WT_DECL_ITEM(buf);
+    WT_DECL_ITEM(decryptitem);
+    WT_DECL_RET;
+    WT_ITEM dictionary, *ip;
+    WT_LOG_DESC *desc;
+    WT_LOG_RECORD *logrec;
+    wt_off_t offset;
+    uint32_t opsize, optype, rdup_len, rectype, reclen, version;
+    uint16_t dict_version;
+    u_int i;
+    const uint8_t *end, *p, *peek;
+
+    WT_RET(__wt_scr_alloc(session, allocsize, &buf));
+    WT_ERR(__wt_scr_alloc(session, 0, &decryptitem));
+
+    WT_ERR(__log_fs_read(session, log_fh, 0, allocsize, buf->mem));
+    logrec = (WT_LOG_RECORD *)buf->mem;
+    __wt_log_record_byteswap(logrec);
+    desc = (WT_LOG_DESC *)logrec->record;
+    __wt_log_desc_byteswap(desc);
+    if ((dict_version = desc->dict_version) == 0)
+        WT_ERR_MSG(session, WT_ERROR,
+          "%s: log file header does not list a compression dictionary", log_fh->name);
+
+    for (offset = allocsize; offset + allocsize <= log_size; offset += rdup_len) {
+        WT_ERR(__log_fs_read(session, log_fh, offset, (size_t)allocsize, buf->mem));
+        reclen = ((WT_LOG_RECORD *)buf->mem)->len;
+#ifdef WORDS_BIGENDIAN
+        reclen = __wt_bswap32(reclen);
+#endif
+        if (reclen == 0)
+            break;
+        rdup_len = __wt_rduppo2(reclen, allocsize);
+        if (offset + rdup_len > log_size)
+            break;
+        if (rdup_len > allocsize) {
+            WT_ERR(__wt_buf_grow(session, buf, rdup_len));
+            WT_ERR(__log_fs_read(session, log_fh, offset, (size_t)rdup_len, buf->mem));
+        }
+        buf->size = reclen;
+        if (!__log_checksum_match(buf, reclen))
+            break;
+        logrec = (WT_LOG_RECORD *)buf->mem;
+        __wt_log_record_byteswap(logrec);
+
+        /* System records aren't compressed, stop at the first compressed record. */
+        if (F_ISSET(logrec, WT_LOG_RECORD_COMPRESSED))
+            break;
+        ip = buf;
+        if (F_ISSET(logrec, WT_LOG_RECORD_ENCRYPTED)) {
+            WT_ERR(__log_decrypt(session, buf, decryptitem));
+            ip = decryptitem;
+        }
+
+        /* Skip the previous LSN record, stop at any other record that isn't a dictionary. */
+        p = WT_LOG_SKIP_HEADER(ip->data);
+        end = (const uint8_t *)ip->data + ip->size;
+        WT_ERR(__wt_logrec_read(session, &p, end, &rectype));
+        if (rectype != WT_LOGREC_SYSTEM)
+            break;
+        peek = p;
+        WT_ERR(__wt_logop_read(session, &peek, end, &optype, &opsize));
+        if (optype == WT_LOGOP_PREV_LSN)
+            continue;
+        if (optype != WT_LOGOP_LOG_DICTIONARY)
+            break;
+        WT_ERR(__wt_logop_log_dictionary_unpack(session, &p, p + opsize, &version, &dictionary));
+        WT_ERR(__wt_log_dict_add(session, dicts, (uint16_t)version, &dictionary));
+    }
+
+    for (i = 0; i < WT_LOG_DICT_SLOTS; ++i)
+        if (dicts[i].version == dict_version)
+            break;
+    if (i == WT_LOG_DICT_SLOTS)
+        WT_ERR_MSG(session, WT_ERROR,
+          "%s: log compression dictionary %" PRIu16 " listed in the header not found",
+          log_fh->name, dict_version);
+
+err:
+    __wt_scr_free(session, &buf);
+    __wt_scr_free(session, &decryptitem);
+    return (ret);
+}
+
 /*
  * __wt_log_fill --
  *     Copy a thread's log records into the assigned slot.
@@ -766,10 +884,12 @@ err:
 /*
  * __log_file_header --
  *     Create and write a log file header into a file handle. If writing into the main log, it will
- *     be called locked. If writing into a pre-allocated log, it will be called unlocked.
+ *     be called locked. If writing into a pre-allocated log, it will be called unlocked. The header
+ *     includes the newest compression dictionary version written into the file, if any.
  */
 static int
-__log_file_header(WT_SESSION_IMPL *session, WT_FH *fh, WT_LSN *end_lsn, bool prealloc)
+__log_file_header(
+  WT_SESSION_IMPL *session, WT_FH *fh, WT_LSN *end_lsn, bool prealloc, uint16_t dict_version)
 {
     WT_CONNECTION_IMPL *conn;
     WT_DECL_ITEM(buf);
@@ -796,6 +916,7 @@ __log_file_header(WT_SESSION_IMPL *session, WT_FH *fh, WT_LSN *end_lsn, bool pre
     desc = (WT_LOG_DESC *)logrec->record;
     desc->log_magic = WT_LOG_MAGIC;
     desc->version = log->log_version;
+    desc->dict_version = dict_version;
     desc->log_size = (uint64_t)conn->log_file_max;
     __wt_log_desc_byteswap(desc);
 
@@ -1035,7 +1156,6 @@ __log_record_verify(
   WT_SESSION_IMPL *session, WT_FH *log_fh, uint32_t offset, WT_LOG_RECORD *logrecp, bool *corrupt)
 {
     WT_LOG_RECORD logrec;
-    size_t i;
 
     *corrupt = false;
 
@@ -1051,14 +1171,12 @@ __log_record_verify(
           offset, logrec.flags);
         *corrupt = true;
     }
-    for (i = 0; i < sizeof(logrec.unused); i++)
-        if (logrec.unused[i] != 0) {
-            __wt_verbose_notice(session, WT_VERB_LOG,
-              "%s: log record at position %" PRIu32 " has unused[%" WT_SIZET_FMT
-              "] corruption 0x%" PRIx8,
-              log_fh->name, offset, i, logrec.unused[i]);
-            *corrupt = true;
-        }
+    if ((logrec.dict_version == 0) != !F_ISSET(&logrec, WT_LOG_RECORD_DICTIONARY)) {
+        __wt_verbose_notice(session, WT_VERB_LOG,
+          "%s: log record at position %" PRIu32 " has dictionary version corruption 0x%" PRIx16,
+          log_fh->name, offset, logrec.dict_version);
+        *corrupt = true;
+    }
     if (logrec.mem_len != 0 &&
       !F_ISSET(&logrec, WT_LOG_RECORD_COMPRESSED | WT_LOG_RECORD_ENCRYPTED)) {
         __wt_verbose_notice(session, WT_VERB_LOG,
@@ -1141,6 +1259,7 @@ __log_newfile(WT_SESSION_IMPL *session, bool conn_open, bool *created)
     WT_LOG *log;
     WT_LSN end_lsn, logrec_lsn;
     u_int yield_cnt;
+    uint16_t dict_version;
     bool create_log, skipp;
 
     conn = S2C(session);
@@ -1245,7 +1364,16 @@ __log_newfile(WT_SESSION_IMPL *session, bool conn_open, bool *created)
     if (log->log_version >= WT_LOG_VERSION_SYSTEM) {
         WT_RET(__wt_log_system_prevlsn(session, log_fh, &logrec_lsn));
         WT_SET_LSN(&log->alloc_lsn, log->fileid, log->first_record);
+
+        /*
+         * Follow it with the compression dictionaries records in this file may use, and rewrite the
+         * file header to note them: a pre-allocated file's header was written earlier.
+         */
+        WT_RET(__wt_log_dict_newfile(session, log_fh, &dict_version));
+        if (dict_version != 0)
+            WT_RET(__log_file_header(session, log_fh, NULL, true, dict_version));
     }
+    log->record_start = __wt_lsn_offset(&log->alloc_lsn);
     WT_ASSIGN_LSN(&end_lsn, &log->alloc_lsn);
     WT_RELEASE_WRITE_WITH_BARRIER(log->log_fh, log_fh);
 
@@ -1379,8 +1507,8 @@ __wt_log_acquire(WT_SESSION_IMPL *session, uint64_t recsize, WT_LOGSLOT *slot)
      * Pre-allocate on the first real write into the log file, if it was just created (i.e. not
      * pre-allocated).
      */
-    if (__wt_lsn_offset(&log->alloc_lsn) == log->first_record && created_log)
-        WT_RET(__log_prealloc(session, log->log_fh));
+    if (__wt_lsn_offset(&log->alloc_lsn) == log->record_start && created_log)
+        WT_RET(__log_prealloc(session, log->log_fh, log->record_start));
     /*
      * Initialize the slot for activation.
      */
@@ -1556,8 +1684,8 @@ __wt_log_allocfile(WT_SESSION_IMPL *session, uint32_t lognum, const char *dest)
      * Set up the temporary file.
      */
     WT_ERR(__log_openfile(session, tmp_id, WT_LOG_OPEN_CREATE_OK, &log_fh));
-    WT_ERR(__log_file_header(session, log_fh, NULL, true));
-    WT_ERR(__log_prealloc(session, log_fh));
+    WT_ERR(__log_file_header(session, log_fh, NULL, true, 0));
+    WT_ERR(__log_prealloc(session, log_fh, log->first_record));
     WT_ERR(__wt_fsync(session, log_fh, true));
     WT_ERR(__wt_close(session, &log_fh));
     __wt_verbose(session, WT_VERB_LOG, "log_allocfile: rename %s to %s",
@@ -1906,8 +2034,9 @@ __wt_log_release(WT_SESSION_IMPL *session, WT_LOGSLOT *slot, bool *freep)
     WT_CONNECTION_IMPL *conn;
     WT_DECL_RET;
     WT_LOG *log;
-    WT_LSN sync_lsn;
+    WT_LSN release_lsn, sync_lsn;
     int64_t release_buffered, release_bytes;
+    uint32_t sync_joins;
 
     conn = S2C(session);
     log = conn->log;
@@ -1942,16 +2071,23 @@ __wt_log_release(WT_SESSION_IMPL *session, WT_LOGSLOT *slot, bool *freep)
       FLD_ISSET(conn->server_flags, WT_CONN_SERVER_LOG)) {
         if (freep != NULL)
             *freep = false;
+        WT_ASSIGN_LSN(&release_lsn, &slot->slot_release_lsn);
         __wt_atomic_storeiv64(&slot->slot_state, WT_LOG_SLOT_WRITTEN);
         /*
-         * After this point the worker thread owns the slot. There is nothing more to do but return.
+         * After this point the worker thread owns the slot, don't look at it again.
          */
         /*
          * !!! Signaling the wrlsn_cond condition here results in
          * worse performance because it causes more scheduling churn
          * and more walking of the slot pool for a very small number
          * of slots to process.  Don't signal here.
+         *
+         * If this slot is next in LSN order, there's work to do, advance the write LSN ourselves
+         * rather than waiting for the worker thread to be scheduled. Don't wait if some other
+         * thread is already processing slots, it will see this one.
          */
+        if (__wt_log_cmp(&log->write_lsn, &release_lsn) == 0 && __wt_log_wrlsn_try(session))
+            WT_STAT_CONN_INCR(session, log_write_lsn_release);
         return (0);
     }
 
@@ -1984,6 +2120,22 @@ __wt_log_release(WT_SESSION_IMPL *session, WT_LOGSLOT *slot, bool *freep)
         conn->log_dirty_max = 0;
     }
 
+    /* Count the synchronous commits sharing this group's sync. */
+    if ((sync_joins = __wt_atomic_load32(&slot->slot_sync_joins)) != 0) {
+        if (sync_joins == 1)
+            WT_STAT_CONN_INCR(session, log_group_size_1);
+        else if (sync_joins < 4)
+            WT_STAT_CONN_INCR(session, log_group_size_lt4);
+        else if (sync_joins < 8)
+            WT_STAT_CONN_INCR(session, log_group_size_lt8);
+        else if (sync_joins < 16)
+            WT_STAT_CONN_INCR(session, log_group_size_lt16);
+        else if (sync_joins < 32)
+            WT_STAT_CONN_INCR(session, log_group_size_lt32);
+        else
+            WT_STAT_CONN_INCR(session, log_group_size_gt32);
+    }
+
     /*
      * Try to consolidate calls to fsync to wait less. Acquire a spin lock so that threads finishing
      * writing to the log will wait while the current fsync completes and advance log->sync_lsn.
@@ -2066,6 +2218,7 @@ __wt_log_scan(WT_SESSION_IMPL *session, WT_LSN *start_lsnp, WT_LSN *end_lsnp, ui
     WT_FH *log_fh;
     WT_ITEM *cbbuf;
     WT_LOG *log;
+    WT_LOG_DICT dicts[WT_LOG_DICT_SLOTS];
     WT_LOG_RECORD *logrec;
     WT_LSN end_lsn, next_lsn, prev_eof, prev_lsn, rd_lsn, start_lsn;
     wt_off_t bad_offset, log_size;
@@ -2074,14 +2227,15 @@ __wt_log_scan(WT_SESSION_IMPL *session, WT_LSN *start_lsnp, WT_LSN *end_lsnp, ui
     u_int i, logcount;
     int firstrecord;
     char **logfiles;
-    bool corrupt, eol, need_salvage, partial_record;
+    bool corrupt, dicts_loaded, eol, need_salvage, partial_record;
 
     conn = S2C(session);
     log = conn->log;
     log_fh = NULL;
     logcount = 0;
     logfiles = NULL;
-    corrupt = eol = false;
+    WT_CLEAR(dicts);
+    corrupt = dicts_loaded = eol = false;
     firstrecord = 1;
     need_salvage = false;
 
@@ -2200,6 +2354,8 @@ advance:
             WT_ERR(__wt_close(session, &log_fh));
             log_fh = NULL;
             eol = true;
+            WT_ERR(__wt_log_dict_discard(session, dicts));
+            dicts_loaded = false;
             /*
              * Truncate this log file before we move to the next.
              */
@@ -2395,7 +2551,12 @@ advance:
                 cbbuf = decryptitem;
             }
             if (F_ISSET(logrec, WT_LOG_RECORD_COMPRESSED)) {
-                WT_ERR(__log_decompress(session, cbbuf, uncitem));
+                /* Load the file's compression dictionaries the first time a record needs one. */
+                if (F_ISSET(logrec, WT_LOG_RECORD_DICTIONARY) && !dicts_loaded) {
+                    WT_ERR(__log_dict_read(session, log_fh, log_size, allocsize, dicts));
+                    dicts_loaded = true;
+                }
+                WT_ERR(__log_decompress(session, cbbuf, uncitem, dicts));
                 cbbuf = uncitem;
             }
             WT_ERR((*func)(session, cbbuf, &rd_lsn, &next_lsn, cookie, firstrecord));
@@ -2454,6 +2615,7 @@ err:
     }
 
     WT_TRET(__wt_fs_directory_list_free(session, &logfiles, logcount));
+    WT_TRET(__wt_log_dict_discard(session, dicts));
 
     __wt_scr_free(session, &buf);
     __wt_scr_free(session, &decryptitem);
@@ -2503,13 +2665,16 @@ __wt_log_write(WT_SESSION_IMPL *session, WT_ITEM *record, WT_LSN *lsnp, uint32_t
     WT_ITEM *ip;
     WT_KEYED_ENCRYPTOR *kencryptor;
     WT_LOG *log;
+    WT_LOG_DICT *dict;
     WT_LOG_RECORD *newlrp;
     size_t dst_len, len, new_size, result_len, src_len;
+    uint64_t time_start, time_stop;
     uint8_t *dst, *src;
     int compression_failed;
 
     conn = S2C(session);
     log = conn->log;
+    dict = NULL;
     /*
      * An error during opening the logging subsystem can result in it being enabled, but without an
      * open log file. In that case, just return. We can also have logging opened for reading in a
@@ -2544,9 +2709,26 @@ __wt_log_write(WT_SESSION_IMPL *session, WT_ITEM *record, WT_LSN *lsnp, uint32_t
         dst = (uint8_t *)citem->mem + WT_LOG_COMPRESS_SKIP;
         dst_len = len;
 
+        /*
+         * If configured, sample the record for the next compression dictionary and compress with
+         * the current one. The dictionary stays pinned until the record is written so it can't be
+         * replaced before a log file holding it is written.
+         */
+        if (log->dict_size != 0) {
+            __wt_log_dict_sample(session, src, src_len);
+            dict = __wt_log_dict_pin(session);
+        }
+
         compression_failed = 0;
-        WT_ERR(compressor->compress(compressor, &session->iface, src, src_len, dst, dst_len,
-          &result_len, &compression_failed));
+        time_start = __wt_clock(session);
+        if (dict == NULL)
+            WT_ERR(compressor->compress(compressor, &session->iface, src, src_len, dst, dst_len,
+              &result_len, &compression_failed));
+        else
+            WT_ERR(compressor->dict_compress(compressor, &session->iface, dict->handle, src,
+              src_len, dst, dst_len, &result_len, &compression_failed));
+        time_stop = __wt_clock(session);
+        WT_STAT_CONN_INCRV(session, log_compress_time, WT_CLOCKDIFF_US(time_stop, time_start));
         result_len += WT_LOG_COMPRESS_SKIP;
 
         /*
@@ -2556,9 +2738,13 @@ __wt_log_write(WT_SESSION_IMPL *session, WT_ITEM *record, WT_LSN *lsnp, uint32_t
          * output requires), it just means the uncompressed version is as good as it gets, and
          * that's what we use.
          */
-        if (compression_failed || result_len / log->allocsize >= record->size / log->allocsize)
+        if (compression_failed || result_len / log->allocsize >= record->size / log->allocsize) {
             WT_STAT_CONN_INCR(session, log_compress_write_fails);
-        else {
+            if (dict != NULL) {
+                __wt_log_dict_unpin(session, dict);
+                dict = NULL;
+            }
+        } else {
             WT_STAT_CONN_INCR(session, log_compress_writes);
             WT_STAT_CONN_INCRV(session, log_compress_mem, record->size);
             WT_STAT_CONN_INCRV(session, log_compress_len, result_len);
@@ -2573,6 +2759,11 @@ __wt_log_write(WT_SESSION_IMPL *session, WT_ITEM *record, WT_LSN *lsnp, uint32_t
             F_SET(newlrp, WT_LOG_RECORD_COMPRESSED);
             WT_ASSERT(session, result_len < UINT32_MAX && record->size < UINT32_MAX);
             newlrp->mem_len = WT_STORE_SIZE(record->size);
+            if (dict != NULL) {
+                WT_STAT_CONN_INCR(session, log_compress_dict_writes);
+                F_SET(newlrp, WT_LOG_RECORD_DICTIONARY);
+                newlrp->dict_version = dict->version;
+            }
         }
     }
     if ((kencryptor = conn->kencryptor) != NULL) {
@@ -2596,11 +2787,103 @@ __wt_log_write(WT_SESSION_IMPL *session, WT_ITEM *record, WT_LSN *lsnp, uint32_t
     ret = __log_write_internal(session, ip, lsnp, flags);
 
 err:
+    if (dict != NULL)
+        __wt_log_dict_unpin(session, dict);
     __wt_scr_free(session, &citem);
     __wt_scr_free(session, &eitem);
     return (ret);
 }
 
+/*
+ * __log_group_arrival --
+ *     Track the time between synchronous commits for group commit.
+ */
+static void
+__log_group_arrival(WT_SESSION_IMPL *session, uint64_t now, bool concurrent)
+{
+    WT_CONNECTION_IMPL *conn;
+    WT_LOG *log;
+    uint64_t avg, interval, last;
+
+    conn = S2C(session);
+    log = conn->log;
+
+    /*
+     * Racing threads can lose updates to the average, that's fine, it's an estimate. Limit the
+     * interval to the latency target: any longer gap means nobody joins, and an idle period
+     * shouldn't take a long run of commits to be forgotten. A commit arriving when no other
+     * synchronous commit is in progress couldn't have joined anyone's group, however soon after
+     * the last one it arrived: a single thread committing in a loop arrives as fast as its own
+     * commits complete. Count it as the longest interval.
+     */
+    last = __wt_atomic_load64(&log->group_last_arrival);
+    __wt_atomic_store64(&log->group_last_arrival, now);
+    if (last == 0 || now <= last)
+        return;
+    interval = concurrent ? WT_MIN(WT_CLOCKDIFF_US(now, last), conn->txn_logsync_target) :
+                            conn->txn_logsync_target;
+    avg = (__wt_atomic_load64(&log->group_arrival_usecs) * 7 + interval) / 8;
+    __wt_atomic_store64(&log->group_arrival_usecs, avg);
+    WT_STAT_CONN_SET(session, log_group_arrival_usecs, avg);
+}
+
+/*
+ * __log_group_hold --
+ *     The first synchronous commit in a slot: hold the slot open so later synchronous commits can
+ *     share its sync, for as long as the latency target allows after the expected sync time.
+ */
+static void
+__log_group_hold(WT_SESSION_IMPL *session, WT_LOGSLOT *slot)
+{
+    WT_CONNECTION_IMPL *conn;
+    WT_LOG *log;
+    uint64_t arrival_usecs, budget, fsync_usecs, idle_max, now, time_join, time_start, waited;
+    uint32_t joins, last_joins;
+
+    conn = S2C(session);
+    log = conn->log;
+
+    if (conn->txn_logsync_target == 0)
+        return;
+    fsync_usecs = __wt_atomic_load64(&log->group_fsync_usecs);
+    if (fsync_usecs >= conn->txn_logsync_target)
+        return;
+    budget = conn->txn_logsync_target - fsync_usecs;
+
+    /* If another synchronous commit isn't expected in time, holding the slot only adds latency. */
+    arrival_usecs = __wt_atomic_load64(&log->group_arrival_usecs);
+    if (arrival_usecs >= budget)
+        return;
+
+    /*
+     * Tell later synchronous commits joining the slot not to close it. Stop waiting early if the
+     * slot closes because it filled or the log server forced it out, once every synchronous commit
+     * in progress has joined the group, or if commits stop arriving.
+     */
+    F_SET_ATOMIC_16(slot, WT_SLOT_GROUP_WAIT);
+    idle_max = 2 * arrival_usecs + 20;
+    last_joins = 0;
+    time_start = time_join = __wt_clock(session);
+    for (;;) {
+        now = __wt_clock(session);
+        waited = WT_CLOCKDIFF_US(now, time_start);
+        if (waited >= budget ||
+          !WT_LOG_SLOT_OPEN(slot, __wt_atomic_loadiv64(&slot->slot_state)))
+            break;
+        joins = __wt_atomic_load32(&slot->slot_sync_joins);
+        if (joins >= __wt_atomic_load32(&log->group_inflight))
+            break;
+        if (joins != last_joins) {
+            last_joins = joins;
+            time_join = now;
+        } else if (WT_CLOCKDIFF_US(now, time_join) > idle_max)
+            break;
+        __wt_sleep(0, WT_MIN(budget - waited, 50));
+    }
+    WT_STAT_CONN_INCR(session, log_group_holds);
+    WT_STAT_CONN_INCRV(session, log_group_hold_usecs, waited);
+}
+
 /*
  * __log_write_internal --
  *     Write a record into the log.
@@ -2615,8 +2898,9 @@ __log_write_internal(WT_SESSION_IMPL *session, WT_ITEM *record, WT_LSN *lsnp, ui
     WT_LSN lsn;
     WT_MYSLOT myslot;
     int64_t release_size;
+    uint64_t time_start;
     uint32_t fill_size, force, rdup_len;
-    bool free_slot;
+    bool free_slot, group_inflight, group_wait, sync;
 
     conn = S2C(session);
     log = conn->log;
@@ -2627,6 +2911,7 @@ __log_write_internal(WT_SESSION_IMPL *session, WT_ITEM *record, WT_LSN *lsnp, ui
     WT_INIT_LSN(&lsn);
     myslot.slot = NULL;
     memset(&myslot, 0, sizeof(myslot));
+    group_inflight = false;
     /*
      * Assume the WT_ITEM the caller passed is a WT_LOG_RECORD, which has a header at the beginning
      * for us to fill in.
@@ -2687,18 +2972,43 @@ __log_write_internal(WT_SESSION_IMPL *session, WT_ITEM *record, WT_LSN *lsnp, ui
 
     WT_STAT_CONN_INCR(session, log_writes);
 
+    sync = LF_ISSET(WT_LOG_DSYNC | WT_LOG_FSYNC);
+    time_start = 0;
+    if (sync) {
+        time_start = __wt_clock(session);
+        if (conn->txn_logsync_target != 0) {
+            group_inflight = true;
+            __log_group_arrival(
+              session, time_start, __wt_atomic_add32(&log->group_inflight, 1) > 1);
+        }
+    }
+
     /*
      * The only time joining a slot should ever return an error is if it detects a panic.
      */
     __wt_log_slot_join(session, rdup_len, flags, &myslot);
+    if (sync)
+        (void)__wt_atomic_add32(&myslot.slot->slot_sync_joins, 1);
 
     /*
-     * If the addition of this record crosses the buffer boundary, switch in a new slot.
+     * If the addition of this record crosses the buffer boundary, switch in a new slot. Otherwise,
+     * if the caller is waiting for the write, switch unless the slot is being held open for group
+     * commit: the first synchronous commit in the slot may hold it, and then switches it itself.
      */
     force = LF_ISSET(WT_LOG_FLUSH | WT_LOG_FSYNC);
+    group_wait = false;
     ret = 0;
-    if (myslot.end_offset >= WT_LOG_SLOT_BUF_MAX || F_ISSET(&myslot, WT_MYSLOT_UNBUFFERED) || force)
+    if (myslot.end_offset >= WT_LOG_SLOT_BUF_MAX(myslot.slot) ||
+      F_ISSET(&myslot, WT_MYSLOT_UNBUFFERED))
         ret = __wt_log_slot_switch(session, &myslot, true, false, NULL);
+    else if (force) {
+        if (sync && myslot.offset == 0)
+            __log_group_hold(session, myslot.slot);
+        else
+            group_wait = F_ISSET_ATOMIC_16(myslot.slot, WT_SLOT_GROUP_WAIT);
+        if (!group_wait)
+            ret = __wt_log_slot_switch(session, &myslot, true, false, NULL);
+    }
     if (ret == 0)
         ret = __wt_log_fill(session, &myslot, false, record, &lsn);
     release_size = __wt_log_slot_release(&myslot, (int64_t)rdup_len);
@@ -2713,7 +3023,7 @@ __log_write_internal(WT_SESSION_IMPL *session, WT_ITEM *record, WT_LSN *lsnp, ui
         WT_ERR(__wt_log_release(session, myslot.slot, &free_slot));
         if (free_slot)
             __wt_log_slot_free(session, myslot.slot);
-    } else if (force) {
+    } else if (force && !group_wait) {
         /*
          * If we are going to wait for this slot to get written, signal the log server thread.
          *
@@ -2736,8 +3046,13 @@ __log_write_internal(WT_SESSION_IMPL *session, WT_ITEM *record, WT_LSN *lsnp, ui
           __wt_atomic_loadi32(&myslot.slot->slot_error) == 0)
             __wt_cond_wait(session, log->log_sync_cond, 10 * WT_THOUSAND, NULL);
     }
+    if (sync)
+        __wt_stat_usecs_hist_incr_logsync(
+          session, WT_CLOCKDIFF_US(__wt_clock(session), time_start));
 
 err:
+    if (group_inflight)
+        (void)__wt_atomic_sub32(&log->group_inflight, 1);
     if (ret == 0 && lsnp != NULL)
         WT_ASSIGN_LSN(lsnp, &lsn);
     /*
@@ -2835,7 +3150,7 @@ __wt_log_flush(WT_SESSION_IMPL *session, uint32_t flags)
      * to be flushed. Otherwise, if the workload is single-threaded we could wait here forever
      * because the write LSN doesn't switch into the new file until it contains a record.
      */
-    if (__wt_lsn_offset(&last_lsn) == log->first_record)
+    if (__wt_lsn_offset(&last_lsn) == log->record_start)
         WT_ASSIGN_LSN(&last_lsn, &log->log_close_lsn);
 
     /*
@@ -1700,6 +1700,141 @@ __wt_logop_backup_id_print(
     return (0);
 }
 
+/*
+ * __wt_struct_size_log_dictionary --
+ *     Calculate size of log_dictionary struct.
+ */
+static WT_INLINE size_t
+__wt_struct_size_log_dictionary(uint32_t version, WT_ITEM *dictionary)
+{
+    return (__wt_vsize_uint(version) + dictionary->size);
+}
+
+/*
+ * __wt_struct_pack_log_dictionary --
+ *     Pack the log_dictionary struct.
+ */
+WT_GCC_FUNC_DECL_ATTRIBUTE((warn_unused_result))
+static WT_INLINE int
+__wt_struct_pack_log_dictionary(uint8_t **pp, uint8_t *end, uint32_t version, WT_ITEM *dictionary)
+{
+    WT_RET(__pack_encode_uintAny(pp, end, version));
+    WT_RET(__pack_encode_WT_ITEM_last(pp, end, dictionary));
+
+    return (0);
+}
+
+/*
+ * __wt_struct_unpack_log_dictionary --
+ *     Unpack the log_dictionary struct.
+ */
+WT_GCC_FUNC_DECL_ATTRIBUTE((warn_unused_result))
+static WT_INLINE int
+__wt_struct_unpack_log_dictionary(
+  const uint8_t **pp, const uint8_t *end, uint32_t *versionp, WT_ITEM *dictionaryp)
+{
+    __pack_decode_uintAny(pp, end, uint32_t, versionp);
+    __pack_decode_WT_ITEM_last(pp, end, dictionaryp);
+
+    return (0);
+}
+
+/*
+ * __wt_logop_log_dictionary_pack --
+ *     Pack the log operation log_dictionary.
+ */
+WT_GCC_FUNC_DECL_ATTRIBUTE((warn_unused_result))
+int
+__wt_logop_log_dictionary_pack(
+  WT_SESSION_IMPL *session, WT_ITEM *logrec, uint32_t version, WT_ITEM *dictionary)
+{
+    size_t size;
+    uint8_t *buf, *end;
+
+    size = __wt_struct_size_log_dictionary(version, dictionary);
+    size += __wt_vsize_uint(WT_LOGOP_LOG_DICTIONARY) + __wt_vsize_uint(0);
+    __wt_struct_size_adjust(session, &size);
+    WT_RET(__wt_buf_extend(session, logrec, logrec->size + size));
+
+    buf = (uint8_t *)logrec->data + logrec->size;
+    end = buf + size;
+    WT_RET(__wt_logop_write(session, &buf, end, WT_LOGOP_LOG_DICTIONARY, (uint32_t)size));
+    WT_RET(__wt_struct_pack_log_dictionary(&buf, end, version, dictionary));
+
+    logrec->size += (uint32_t)size;
+    return (0);
+}
+
+/*
+ * __wt_logop_log_dictionary_unpack --
+ *     Unpack the log operation log_dictionary.
+ */
+int
+__wt_logop_log_dictionary_unpack(WT_SESSION_IMPL *session, const uint8_t **pp,
+  const uint8_t *end, uint32_t *versionp, WT_ITEM *dictionaryp)
+{
+    WT_DECL_RET;
+    uint32_t optype, size;
+
+#if !defined(NO_STRICT_PACKING_CHECK) || defined(PACKING_COMPATIBILITY_MODE)
+    const uint8_t *pp_orig;
+    pp_orig = *pp;
+#endif
+
+    if ((ret = __wt_logop_unpack(session, pp, end, &optype, &size)) != 0 ||
+      (ret = __wt_struct_unpack_log_dictionary(pp, end, versionp, dictionaryp)) != 0)
+        WT_RET_MSG(session, ret, "logop_log_dictionary: unpack failure");
+
+    WT_CHECK_OPTYPE(session, optype, WT_LOGOP_LOG_DICTIONARY);
+
+#if !defined(NO_STRICT_PACKING_CHECK)
+    if (WT_PTRDIFF(*pp, pp_orig) != size) {
+        WT_RET_MSG(session, EINVAL,
+          "logop_log_dictionary: size mismatch: expected %u, got %" PRIuPTR, size,
+          WT_PTRDIFF(*pp, pp_orig));
+    }
+#endif
+#if defined(PACKING_COMPATIBILITY_MODE)
+    *pp = pp_orig + size;
+#endif
+
+    return (0);
+}
+
+/*
+ * __wt_logop_log_dictionary_print --
+ *     Print the log operation log_dictionary.
+ */
+int
+__wt_logop_log_dictionary_print(
+  WT_SESSION_IMPL *session, const uint8_t **pp, const uint8_t *end, WT_TXN_PRINTLOG_ARGS *args)
+{
+    WT_DECL_RET;
+    uint32_t version;
+    WT_ITEM dictionary;
+    WT_DECL_ITEM(escaped);
+
+    WT_RET(__wt_logop_log_dictionary_unpack(session, pp, end, &version, &dictionary));
+
+    if (!FLD_ISSET(args->flags, WT_TXN_PRINTLOG_UNREDACT))
+        return (__wt_fprintf(session, args->fs, " REDACTED"));
+
+    WT_RET(__wt_fprintf(session, args->fs, " \"optype\": \"log_dictionary\",\n"));
+    WT_ERR(__wt_fprintf(session, args->fs, "        \"version\": %" PRIu32 ",\n", version));
+    WT_ERR(__logrec_make_json_str(session, &escaped, &dictionary));
+    WT_ERR(
+      __wt_fprintf(session, args->fs, "        \"dictionary\": \"%s\"", (char *)escaped->mem));
+    if (FLD_ISSET(args->flags, WT_TXN_PRINTLOG_HEX)) {
+        WT_ERR(__logrec_make_hex_str(session, &escaped, &dictionary));
+        WT_ERR(__wt_fprintf(
+          session, args->fs, ",\n        \"dictionary-hex\": \"%s\"", (char *)escaped->mem));
+    }
+
+err:
+    __wt_scr_free(session, &escaped);
+    return (ret);
+}
+
 /*
  * __wt_struct_size_txn_timestamp --
  *     Calculate size of txn_timestamp struct.
@@ -1912,6 +2047,10 @@ __wt_txn_op_printlog(
         WT_RET(__wt_logop_backup_id_print(session, pp, end, args));
         break;
 
+    case WT_LOGOP_LOG_DICTIONARY:
+        WT_RET(__wt_logop_log_dictionary_print(session, pp, end, args));
+        break;
+
     case WT_LOGOP_TXN_TIMESTAMP:
         WT_RET(__wt_logop_txn_timestamp_print(session, pp, end, args));
         break;
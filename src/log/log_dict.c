@@ -0,0 +1,438 @@
+/*-
+ * Copyright (c) 2014-present MongoDB, Inc.
+ * Copyright (c) 2008-2014 WiredTiger, Inc.
+ *	All rights reserved.
+ *
+ * See the file LICENSE for redistribution information.
+ */
+
+#include "wt_internal.h"
+
+/*
+ * __log_dict_free --
+ *     Release a dictionary.
+ */
+static int
+__log_dict_free(WT_SESSION_IMPL *session, WT_LOG_DICT *dict)
+{
+    WT_COMPRESSOR *compressor;
+    WT_DECL_RET;
+
+    compressor = S2C(session)->log_compressor;
+    if (dict->handle != NULL) {
+        ret = compressor->dict_unload(compressor, &session->iface, dict->handle);
+        dict->handle = NULL;
+    }
+    __wt_buf_free(session, &dict->data);
+    dict->version = 0;
+    return (ret);
+}
+
+/*
+ * __log_dict_load --
+ *     Load a dictionary's content into the compressor.
+ */
+static int
+__log_dict_load(WT_SESSION_IMPL *session, WT_LOG_DICT *dict)
+{
+    WT_COMPRESSOR *compressor;
+
+    compressor = S2C(session)->log_compressor;
+    if (compressor == NULL || compressor->dict_load == NULL)
+        WT_RET_MSG(session, WT_ERROR,
+          "Log compression dictionary with no configured compressor supporting dictionaries");
+    return (compressor->dict_load(
+      compressor, &session->iface, dict->data.data, dict->data.size, &dict->handle));
+}
+
+/*
+ * __wt_log_dict_init --
+ *     Set up log compression dictionaries, if configured and the compressor supports them.
+ */
+int
+__wt_log_dict_init(WT_SESSION_IMPL *session)
+{
+    WT_COMPRESSOR *compressor;
+    WT_CONNECTION_IMPL *conn;
+    WT_LOG *log;
+
+    conn = S2C(session);
+    log = conn->log;
+    compressor = conn->log_compressor;
+
+    if (conn->log_dict_size == 0 || compressor == NULL)
+        return (0);
+    if (compressor->dict_load == NULL || compressor->dict_compress == NULL ||
+      compressor->dict_decompress == NULL || compressor->dict_unload == NULL) {
+        __wt_verbose_notice(session, WT_VERB_LOG, "%s",
+          "log compressor does not support dictionaries, ignoring log.dictionary_size");
+        return (0);
+    }
+
+    WT_RET(__wt_spin_init(session, &log->dict_sample_lock, "log dictionary sample"));
+    WT_RET(__wt_buf_init(
+      session, &log->dict_sample, conn->log_dict_size * WT_LOG_DICT_SAMPLE_FACTOR));
+    log->dict_samples_max = log->dict_sample.memsize / (WT_LOG_ALIGN / 2);
+    WT_RET(__wt_calloc_def(session, log->dict_samples_max, &log->dict_sample_sizes));
+    log->dict_size = conn->log_dict_size;
+    return (0);
+}
+
+/*
+ * __wt_log_dict_destroy --
+ *     Discard log compression dictionaries.
+ */
+int
+__wt_log_dict_destroy(WT_SESSION_IMPL *session)
+{
+    WT_DECL_RET;
+    WT_LOG *log;
+    u_int i;
+
+    log = S2C(session)->log;
+    if (log->dict_size == 0)
+        return (0);
+
+    for (i = 0; i < WT_LOG_DICT_SLOTS; ++i)
+        WT_TRET(__log_dict_free(session, &log->dict[i]));
+    WT_TRET(__log_dict_free(session, &log->dict_pending));
+    log->dict_current = NULL;
+    __wt_buf_free(session, &log->dict_sample);
+    __wt_free(session, log->dict_sample_sizes);
+    __wt_spin_destroy(session, &log->dict_sample_lock);
+    log->dict_size = 0;
+    return (ret);
+}
+
+/*
+ * __wt_log_dict_sample --
+ *     Sample a record for the next dictionary.
+ */
+void
+__wt_log_dict_sample(WT_SESSION_IMPL *session, const uint8_t *src, size_t src_len)
+{
+    WT_LOG *log;
+    size_t len;
+
+    log = S2C(session)->log;
+
+    /* Sampling is best effort: skip the record rather than wait for another thread. */
+    if (__wt_atomic_loadbool(&log->dict_sample_full) ||
+      __wt_spin_trylock(session, &log->dict_sample_lock) != 0)
+        return;
+
+    len = WT_MIN(src_len, WT_LOG_DICT_SAMPLE_MAX);
+    if (log->dict_nsamples < log->dict_samples_max &&
+      log->dict_sample.size + len <= log->dict_sample.memsize) {
+        memcpy((uint8_t *)log->dict_sample.mem + log->dict_sample.size, src, len);
+        log->dict_sample.size += len;
+        log->dict_sample_sizes[log->dict_nsamples++] = len;
+    } else
+        __wt_atomic_storebool(&log->dict_sample_full, true);
+    __wt_spin_unlock(session, &log->dict_sample_lock);
+}
+
+/*
+ * __log_dict_sample_reset --
+ *     Discard the sampled records. Called with the sample lock held.
+ */
+static void
+__log_dict_sample_reset(WT_LOG *log)
+{
+    log->dict_sample.size = 0;
+    log->dict_nsamples = 0;
+    __wt_atomic_storebool(&log->dict_sample_full, false);
+}
+
+/*
+ * __log_dict_build --
+ *     Build a dictionary from the sampled records. Called with the sample lock held.
+ */
+static int
+__log_dict_build(WT_SESSION_IMPL *session, WT_LOG_DICT *dict)
+{
+    WT_COMPRESSOR *compressor;
+    WT_LOG *log;
+    size_t len;
+
+    log = S2C(session)->log;
+    compressor = S2C(session)->log_compressor;
+
+    WT_RET(__wt_buf_init(session, &dict->data, log->dict_size));
+    len = 0;
+    if (compressor->dict_train != NULL)
+        WT_RET(compressor->dict_train(compressor, &session->iface, log->dict_sample.data,
+          log->dict_sample_sizes, log->dict_nsamples, dict->data.mem, log->dict_size, &len));
+
+    /*
+     * Without a trained dictionary, use the most recent samples as the dictionary content:
+     * compressors matching against raw content generally favor the end of the dictionary.
+     */
+    if (len == 0) {
+        len = WT_MIN(log->dict_sample.size, log->dict_size);
+        memcpy(dict->data.mem, (uint8_t *)log->dict_sample.mem + log->dict_sample.size - len, len);
+    }
+    dict->data.size = len;
+    WT_RET(__log_dict_load(session, dict));
+
+    WT_STAT_CONN_INCR(session, log_compress_dict_builds);
+    return (0);
+}
+
+/*
+ * __wt_log_compress_server --
+ *     Periodic log compression work for the log server: update the compression ratio and build the
+ *     next dictionary.
+ */
+int
+__wt_log_compress_server(WT_SESSION_IMPL *session)
+{
+    WT_CONNECTION_IMPL *conn;
+    WT_DECL_RET;
+    WT_LOG *log;
+    WT_LOG_DICT dict;
+    int64_t len, mem;
+    bool pending;
+
+    conn = S2C(session);
+    log = conn->log;
+
+    if (WT_STAT_ENABLED(session)) {
+        len = WT_STAT_CONN_READ(conn->stats, log_compress_len);
+        mem = WT_STAT_CONN_READ(conn->stats, log_compress_mem);
+        if (len > 0)
+            WT_STAT_CONN_SET(session, log_compress_ratio, mem * 100 / len);
+    }
+
+    if (log->dict_size == 0 || !__wt_atomic_loadbool(&log->dict_sample_full))
+        return (0);
+
+    /*
+     * If the last dictionary we built isn't in use yet, discard the samples so the next dictionary
+     * is built from recent records. Otherwise build the next dictionary, outside of the slot lock,
+     * and hand it to the next log file switch.
+     */
+    WT_CLEAR(dict);
+    WT_WITH_SLOT_LOCK(session, log, pending = log->dict_pending.handle != NULL);
+    __wt_spin_lock(session, &log->dict_sample_lock);
+    if (!pending)
+        ret = __log_dict_build(session, &dict);
+    __log_dict_sample_reset(log);
+    __wt_spin_unlock(session, &log->dict_sample_lock);
+    WT_ERR(ret);
+
+    if (dict.handle != NULL)
+        WT_WITH_SLOT_LOCK(session, log, {
+            log->dict_pending = dict;
+            WT_CLEAR(dict);
+        });
+
+err:
+    WT_TRET(__log_dict_free(session, &dict));
+    return (ret);
+}
+
+/*
+ * __wt_log_dict_pin --
+ *     Return the current dictionary, pinned so it's written into any log file created before the
+ *     caller's record joins a slot, or NULL if there's no current dictionary.
+ */
+WT_LOG_DICT *
+__wt_log_dict_pin(WT_SESSION_IMPL *session)
+{
+    WT_LOG *log;
+    WT_LOG_DICT *dict;
+
+    log = S2C(session)->log;
+    for (;;) {
+        WT_ACQUIRE_READ(dict, log->dict_current);
+        if (dict == NULL)
+            return (NULL);
+
+        /*
+         * The atomic increment is a full barrier: either the log file switch replacing the current
+         * dictionary sees the pin, or we see the new current dictionary and try again.
+         */
+        (void)__wt_atomic_add32(&dict->pins, 1);
+        if (dict == __wt_atomic_load_pointer(&log->dict_current))
+            return (dict);
+        (void)__wt_atomic_sub32(&dict->pins, 1);
+    }
+}
+
+/*
+ * __wt_log_dict_unpin --
+ *     Release a dictionary pinned by __wt_log_dict_pin.
+ */
+void
+__wt_log_dict_unpin(WT_SESSION_IMPL *session, WT_LOG_DICT *dict)
+{
+    WT_UNUSED(session);
+
+    WT_ASSERT(session, __wt_atomic_load32(&dict->pins) > 0);
+    (void)__wt_atomic_sub32(&dict->pins, 1);
+}
+
+/*
+ * __log_dict_write --
+ *     Write a dictionary as a system record at the log file's next allocation LSN.
+ */
+static int
+__log_dict_write(WT_SESSION_IMPL *session, WT_FH *log_fh, WT_LOG_DICT *dict)
+{
+    WT_CONNECTION_IMPL *conn;
+    WT_DECL_ITEM(eitem);
+    WT_DECL_ITEM(logrec_buf);
+    WT_DECL_RET;
+    WT_ITEM *ip;
+    WT_KEYED_ENCRYPTOR *kencryptor;
+    WT_LOG *log;
+    WT_LOGSLOT tmp;
+    WT_LOG_RECORD *logrec;
+    WT_MYSLOT myslot;
+    size_t new_size, recsize;
+    uint32_t rdup_len, rectype;
+    const char *fmt;
+
+    conn = S2C(session);
+    log = conn->log;
+    rectype = WT_LOGREC_SYSTEM;
+    fmt = WT_UNCHECKED_STRING(I);
+
+    WT_RET(__wt_logrec_alloc(session, dict->data.size + log->allocsize, &logrec_buf));
+    WT_ERR(__wt_struct_size(session, &recsize, fmt, rectype));
+    WT_ERR(__wt_struct_pack(
+      session, (uint8_t *)logrec_buf->data + logrec_buf->size, recsize, fmt, rectype));
+    logrec_buf->size += recsize;
+    WT_ERR(__wt_logop_log_dictionary_pack(session, logrec_buf, dict->version, &dict->data));
+
+    /* The dictionary is built from record content, encrypt it as we would the records. */
+    ip = logrec_buf;
+    if ((kencryptor = conn->kencryptor) != NULL) {
+        __wt_encrypt_size(session, kencryptor, ip->size, &new_size);
+        WT_ERR(__wt_scr_alloc(session, new_size, &eitem));
+        WT_ERR(__wt_encrypt(session, kencryptor, WT_LOG_ENCRYPT_SKIP, ip, eitem));
+        ip = eitem;
+        F_SET((WT_LOG_RECORD *)ip->mem, WT_LOG_RECORD_ENCRYPTED);
+    }
+
+    /* Zero-fill to the allocation size, we write the full amount. */
+    rdup_len = __wt_rduppo2((uint32_t)ip->size, log->allocsize);
+    WT_ERR(__wt_buf_grow(session, ip, rdup_len));
+    memset((uint8_t *)ip->mem + ip->size, 0, rdup_len - ip->size);
+    ip->size = rdup_len;
+
+    logrec = (WT_LOG_RECORD *)ip->mem;
+    logrec->len = rdup_len;
+    logrec->checksum = 0;
+    __wt_log_record_byteswap(logrec);
+    logrec->checksum = __wt_checksum(logrec, rdup_len);
+#ifdef WORDS_BIGENDIAN
+    logrec->checksum = __wt_bswap32(logrec->checksum);
+#endif
+
+    WT_CLEAR(tmp);
+    memset(&myslot, 0, sizeof(myslot));
+    myslot.slot = &tmp;
+    __wt_log_slot_activate(session, &tmp);
+    tmp.slot_fh = log_fh;
+    WT_ERR(__wt_log_fill(session, &myslot, true, ip, NULL));
+    WT_SET_LSN(&log->alloc_lsn, log->fileid, __wt_lsn_offset(&log->alloc_lsn) + rdup_len);
+
+err:
+    __wt_scr_free(session, &eitem);
+    __wt_logrec_free(session, &logrec_buf);
+    return (ret);
+}
+
+/*
+ * __wt_log_dict_newfile --
+ *     Called locked when switching to a new log file: make any pending dictionary current, and
+ *     write the dictionaries records in the file may use at the start of the file. Return the
+ *     current dictionary version, or 0 if no dictionaries were written.
+ */
+int
+__wt_log_dict_newfile(WT_SESSION_IMPL *session, WT_FH *log_fh, uint16_t *versionp)
+{
+    WT_LOG *log;
+    WT_LOG_DICT *current, *dict;
+    u_int i;
+
+    log = S2C(session)->log;
+    *versionp = 0;
+
+    WT_ASSERT(session, FLD_ISSET(session->lock_flags, WT_SESSION_LOCKED_SLOT));
+    if (log->dict_size == 0)
+        return (0);
+
+    /*
+     * Replace the current dictionary with the pending one, in a slot no writer has pinned. If every
+     * slot is pinned, keep the current dictionary and try again at the next switch.
+     */
+    current = log->dict_current;
+    if (log->dict_pending.handle != NULL)
+        for (i = 0; i < WT_LOG_DICT_SLOTS; ++i) {
+            dict = &log->dict[i];
+            if (dict == current || __wt_atomic_load32(&dict->pins) != 0)
+                continue;
+            WT_RET(__log_dict_free(session, dict));
+            dict->data = log->dict_pending.data;
+            dict->handle = log->dict_pending.handle;
+            WT_CLEAR(log->dict_pending);
+            if (++log->dict_version == 0)
+                ++log->dict_version;
+            dict->version = log->dict_version;
+            current = dict;
+            WT_RELEASE_WRITE_WITH_BARRIER(log->dict_current, current);
+            break;
+        }
+    if (current == NULL)
+        return (0);
+
+    /* Pair with the pin's atomic increment, see __wt_log_dict_pin. */
+    WT_FULL_BARRIER();
+    for (i = 0; i < WT_LOG_DICT_SLOTS; ++i) {
+        dict = &log->dict[i];
+        if (dict->version != 0 && (dict == current || __wt_atomic_load32(&dict->pins) != 0))
+            WT_RET(__log_dict_write(session, log_fh, dict));
+    }
+    *versionp = current->version;
+    return (0);
+}
+
+/*
+ * __wt_log_dict_add --
+ *     Load a dictionary read from a log file into a set of dictionaries.
+ */
+int
+__wt_log_dict_add(WT_SESSION_IMPL *session, WT_LOG_DICT *dicts, uint16_t version, WT_ITEM *data)
+{
+    WT_LOG_DICT *dict;
+    u_int i;
+
+    for (i = 0; i < WT_LOG_DICT_SLOTS; ++i)
+        if (dicts[i].version == 0)
+            break;
+    if (i == WT_LOG_DICT_SLOTS || version == 0)
+        WT_RET_MSG(session, WT_ERROR, "unexpected log compression dictionary %" PRIu16, version);
+
+    dict = &dicts[i];
+    WT_RET(__wt_buf_set(session, &dict->data, data->data, data->size));
+    dict->version = version;
+    return (__log_dict_load(session, dict));
+}
+
+/*
+ * __wt_log_dict_discard --
+ *     Release a set of dictionaries read from a log file.
+ */
+int
+__wt_log_dict_discard(WT_SESSION_IMPL *session, WT_LOG_DICT *dicts)
+{
+    WT_DECL_RET;
+    u_int i;
+
+    for (i = 0; i < WT_LOG_DICT_SLOTS; ++i)
+        WT_TRET(__log_dict_free(session, &dicts[i]));
+    return (ret);
+}
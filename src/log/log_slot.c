@@ -140,6 +140,7 @@ retry:
      * We own the slot now. No one else can join. Set the end LSN.
      */
     WT_STAT_CONN_INCR(session, log_slot_closes);
+    ++log->slot_closes;
     if (WT_LOG_SLOT_DONE(new_state))
         *releasep = true;
     WT_ASSIGN_LSN(&slot->slot_end_lsn, &slot->slot_start_lsn);
@@ -220,6 +221,44 @@ __log_slot_dirty_max_check(WT_SESSION_IMPL *session, WT_LOGSLOT *slot)
     }
 }
 
+/*
+ * __log_slot_buf_alloc --
+ *     Allocate a slot's buffer, replacing any existing buffer. Must be called holding the slot lock
+ *     on a free slot.
+ */
+static int
+__log_slot_buf_alloc(WT_SESSION_IMPL *session, WT_LOGSLOT *slot, size_t size)
+{
+    __wt_buf_free(session, &slot->slot_buf);
+    slot->slot_buf_size = 0;
+    F_SET(&slot->slot_buf, WT_ITEM_ALIGNED);
+    WT_RET(__wt_buf_init(session, &slot->slot_buf, size));
+    slot->slot_buf_size = size;
+    return (0);
+}
+
+/*
+ * __log_slot_trim --
+ *     Free the buffers of free slots beyond the pool depth. Must be called holding the slot lock.
+ */
+static void
+__log_slot_trim(WT_SESSION_IMPL *session)
+{
+    WT_LOG *log;
+    WT_LOGSLOT *slot;
+    int32_t i;
+
+    log = S2C(session)->log;
+    for (i = log->pool_depth; i < WT_SLOT_POOL; i++) {
+        slot = &log->slot_pool[i];
+        if (slot->slot_buf_size != 0 &&
+          __wt_atomic_loadiv64(&slot->slot_state) == WT_LOG_SLOT_FREE) {
+            __wt_buf_free(session, &slot->slot_buf);
+            slot->slot_buf_size = 0;
+        }
+    }
+}
+
 /*
  * __log_slot_new --
  *     Find a free slot and switch it as the new active slot. Must be called holding the slot lock.
@@ -254,21 +293,27 @@ __log_slot_new(WT_SESSION_IMPL *session)
          * acquiring it again.
          */
         if ((slot = log->active_slot) != NULL &&
-          WT_LOG_SLOT_OPEN(__wt_atomic_loadiv64(&slot->slot_state)))
+          WT_LOG_SLOT_OPEN(slot, __wt_atomic_loadiv64(&slot->slot_state)))
             return (0);
         /*
          * Rotate among the slots to lessen collisions.
          */
         WT_RET(WT_SESSION_CHECK_PANIC(session));
-        for (i = 0, pool_i = log->pool_index; i < WT_SLOT_POOL; i++, pool_i++) {
-            if (pool_i >= WT_SLOT_POOL)
+        for (i = 0, pool_i = log->pool_index; i < log->pool_depth; i++, pool_i++) {
+            if (pool_i >= log->pool_depth)
                 pool_i = 0;
             slot = &log->slot_pool[pool_i];
             if (__wt_atomic_loadiv64(&slot->slot_state) == WT_LOG_SLOT_FREE) {
+                /*
+                 * Slot buffers are resized as they're reused, replace the buffer if the size has
+                 * changed since the slot was last used.
+                 */
+                if (slot->slot_buf_size != log->slot_buf_size)
+                    WT_RET(__log_slot_buf_alloc(session, slot, log->slot_buf_size));
                 /*
                  * Acquire our starting position in the log file. Assume the full buffer size.
                  */
-                WT_RET(__wt_log_acquire(session, log->slot_buf_size, slot));
+                WT_RET(__wt_log_acquire(session, slot->slot_buf_size, slot));
                 /*
                  * We have a new, initialized slot to use. Set it as the active slot.
                  */
@@ -283,6 +328,7 @@ __log_slot_new(WT_SESSION_IMPL *session)
          * threads waiting for it can acquire and possibly move things forward.
          */
         WT_STAT_CONN_INCR(session, log_slot_no_free_slots);
+        ++log->slot_no_free;
         __wt_cond_signal(session, conn->log_wrlsn_cond);
         __wt_spin_unlock(session, &log->log_slot_lock);
         __wt_yield();
@@ -452,14 +498,22 @@ __wt_log_slot_init(WT_SESSION_IMPL *session, bool alloc)
      * small log file sizes.
      */
     if (alloc) {
-        log->slot_buf_size =
+        log->slot_buf_init = log->slot_buf_size =
           (uint32_t)WT_MIN((size_t)conn->log_file_max / 10, WT_LOG_SLOT_BUF_SIZE);
+        /*
+         * Buffers can grow until the minimum pool depth uses the memory of the initial pool, the
+         * same limits as the initial buffer size apply.
+         */
+        log->slot_buf_limit = WT_MIN(log->slot_buf_init * WT_SLOT_POOL / WT_LOG_SLOT_POOL_MIN,
+          WT_MIN((size_t)conn->log_file_max / 10, WT_LOG_SLOT_BUF_SIZE_MAX));
+        log->pool_depth = WT_SLOT_POOL;
         for (i = 0; i < WT_SLOT_POOL; i++) {
-            F_SET(&log->slot_pool[i].slot_buf, WT_ITEM_ALIGNED);
-            WT_ERR(__wt_buf_init(session, &log->slot_pool[i].slot_buf, log->slot_buf_size));
+            WT_ERR(__log_slot_buf_alloc(session, &log->slot_pool[i], log->slot_buf_size));
             F_SET_ATOMIC_16(&log->slot_pool[i], WT_SLOT_INIT_FLAGS);
         }
         WT_STAT_CONN_SET(session, log_buffer_size, log->slot_buf_size * WT_SLOT_POOL);
+        WT_STAT_CONN_SET(session, log_slot_buffer_size, log->slot_buf_size);
+        WT_STAT_CONN_SET(session, log_slot_pool_depth, log->pool_depth);
     }
     /*
      * Set up the available slot from the pool the first time.
@@ -517,6 +571,96 @@ __wt_log_slot_destroy(WT_SESSION_IMPL *session)
     return (0);
 }
 
+/*
+ * __wt_log_slot_resize --
+ *     Adjust the slot buffer size and pool depth to the records being written. Must be called
+ *     holding the slot lock.
+ */
+void
+__wt_log_slot_resize(WT_SESSION_IMPL *session)
+{
+    WT_LOG *log;
+    uint64_t closes, large, no_free, unbuffered, unbuffered_max;
+    size_t size;
+    const char *reason;
+
+    WT_ASSERT(session, FLD_ISSET(session->lock_flags, WT_SESSION_LOCKED_SLOT));
+    log = S2C(session)->log;
+
+    /* Slots in use when the pool depth was reduced are freed once they're written. */
+    __log_slot_trim(session);
+
+    /* Wait for enough slots to have been used to be representative. */
+    closes = log->slot_closes - log->slot_resize_closes;
+    if (closes < WT_LOG_SLOT_RESIZE_CLOSES)
+        return;
+    log->slot_resize_closes = log->slot_closes;
+    no_free = log->slot_no_free;
+    log->slot_no_free = 0;
+
+    /*
+     * The record counters are updated without the slot lock, an update racing with the reset may be
+     * lost. That doesn't matter, they're only used to pick a buffer size.
+     */
+    large = __wt_atomic_load64(&log->slot_large);
+    unbuffered = __wt_atomic_load64(&log->slot_unbuffered);
+    unbuffered_max = __wt_atomic_load64(&log->slot_unbuffered_max);
+    __wt_atomic_store64(&log->slot_large, 0);
+    __wt_atomic_store64(&log->slot_unbuffered, 0);
+    __wt_atomic_store64(&log->slot_unbuffered_max, 0);
+
+    if (log->slot_resize_hold > 0)
+        --log->slot_resize_hold;
+    log->slot_resize_idle = large == 0 ? log->slot_resize_idle + 1 : 0;
+
+    /*
+     * Running out of slots means larger buffers are costing more than they save, fewer slots limit
+     * the number of groups writing concurrently. Halve the buffers and don't grow them again for a
+     * while. Otherwise grow the buffers when records are regularly written unbuffered, as long as
+     * the buffers can get large enough to hold them, and shrink them once there are no large
+     * records.
+     */
+    size = log->slot_buf_size;
+    reason = NULL;
+    if (no_free != 0 && size > log->slot_buf_init) {
+        size /= 2;
+        log->slot_resize_hold = WT_LOG_SLOT_RESIZE_IDLE;
+        reason = "slot pool exhausted";
+        WT_STAT_CONN_INCR(session, log_slot_buffer_shrink_pool);
+    } else if (log->slot_resize_hold == 0 && unbuffered * 100 >= closes &&
+      size < log->slot_buf_limit && unbuffered_max <= log->slot_buf_limit / 2) {
+        while (size < 2 * unbuffered_max && size < log->slot_buf_limit)
+            size *= 2;
+        reason = "records written unbuffered";
+        WT_STAT_CONN_INCR(session, log_slot_buffer_grow_unbuffered);
+    } else if (log->slot_resize_idle >= WT_LOG_SLOT_RESIZE_IDLE && size > log->slot_buf_init) {
+        size /= 2;
+        log->slot_resize_idle = 0;
+        reason = "no large records";
+        WT_STAT_CONN_INCR(session, log_slot_buffer_shrink_small);
+    }
+    size = WT_MAX(log->slot_buf_init, WT_MIN(size, log->slot_buf_limit));
+    if (reason == NULL || size == log->slot_buf_size)
+        return;
+
+    /*
+     * Keep the memory used by the pool the same, larger buffers mean fewer slots. Free slots pick up
+     * the new size when they're next used.
+     */
+    __wt_verbose(session, WT_VERB_LOG,
+      "slot buffer size %" WT_SIZET_FMT " -> %" WT_SIZET_FMT ", pool depth %" PRId32 " -> %" PRId32
+      ": %s",
+      log->slot_buf_size, size, log->pool_depth,
+      (int32_t)WT_MIN(WT_SLOT_POOL, log->slot_buf_init * WT_SLOT_POOL / size), reason);
+    log->slot_buf_size = size;
+    log->pool_depth = (int32_t)WT_MIN(WT_SLOT_POOL, log->slot_buf_init * WT_SLOT_POOL / size);
+    __log_slot_trim(session);
+
+    WT_STAT_CONN_SET(session, log_buffer_size, size * (size_t)log->pool_depth);
+    WT_STAT_CONN_SET(session, log_slot_buffer_size, size);
+    WT_STAT_CONN_SET(session, log_slot_pool_depth, log->pool_depth);
+}
+
 /*
  * __wt_log_slot_join --
  *     Join a consolidated logging slot.
@@ -529,8 +673,8 @@ __wt_log_slot_join(WT_SESSION_IMPL *session, uint64_t mysize, uint32_t flags, WT
     WT_LOGSLOT *slot;
     uint64_t time_start, time_stop, usecs;
     int64_t flag_state, new_state, old_state, released;
-    int32_t join_offset, new_join, wait_cnt;
-    bool closed, diag_yield, raced, slept, unbuffered, yielded;
+    int32_t join_offset, new_join, spin_cnt, wait_cnt;
+    bool closed, diag_unbuffered, diag_yield, raced, slept, unbuffered, yielded;
 
     conn = S2C(session);
     log = conn->log;
@@ -544,22 +688,23 @@ __wt_log_slot_join(WT_SESSION_IMPL *session, uint64_t mysize, uint32_t flags, WT
      */
     unbuffered = yielded = false;
     closed = raced = slept = false;
-    wait_cnt = 0;
+    spin_cnt = wait_cnt = 0;
 #ifdef HAVE_DIAGNOSTIC
     diag_yield = (++log->write_calls % 7) == 0;
-    if ((log->write_calls % WT_THOUSAND) == 0 || mysize > WT_LOG_SLOT_BUF_MAX) {
+    diag_unbuffered = (log->write_calls % WT_THOUSAND) == 0;
 #else
-    diag_yield = false;
-    if (mysize > WT_LOG_SLOT_BUF_MAX) {
+    diag_yield = diag_unbuffered = false;
 #endif
-        unbuffered = true;
-        F_SET(myslot, WT_MYSLOT_UNBUFFERED);
-    }
     for (;;) {
         WT_COMPILER_BARRIER();
         slot = __wt_atomic_load_pointer(&log->active_slot);
         old_state = __wt_atomic_loadiv64(&slot->slot_state);
-        if (WT_LOG_SLOT_OPEN(old_state)) {
+        if (WT_LOG_SLOT_OPEN(slot, old_state)) {
+            /*
+             * Records larger than half the slot's buffer are written directly. Slot buffers differ
+             * in size while the buffer size is changing, decide for the slot we're joining.
+             */
+            unbuffered = diag_unbuffered || mysize > WT_LOG_SLOT_BUF_MAX(slot);
             /*
              * Try to join our size into the existing size and atomically write it back into the
              * state.
@@ -587,6 +732,16 @@ __wt_log_slot_join(WT_SESSION_IMPL *session, uint64_t mysize, uint32_t flags, WT
                 break;
             WT_STAT_CONN_INCR(session, log_slot_races);
             raced = true;
+            /*
+             * Losing the race means another thread joined and the slot is likely still open. Retry
+             * a few times before giving up the processor, yielding on every lost race serializes
+             * the joining threads behind the scheduler.
+             */
+            if (++spin_cnt < WT_LOG_SLOT_JOIN_SPINS) {
+                WT_PAUSE();
+                continue;
+            }
+            spin_cnt = 0;
         } else {
             WT_STAT_CONN_INCR(session, log_slot_active_closed);
             closed = true;
@@ -622,6 +777,19 @@ __wt_log_slot_join(WT_SESSION_IMPL *session, uint64_t mysize, uint32_t flags, WT
         if (slept)
             WT_STAT_CONN_INCR(session, log_slot_yield_sleep);
     }
+    /*
+     * Track the records too large for the buffers, the log server uses them to size the buffers.
+     */
+    if (mysize > log->slot_buf_size / 4) {
+        (void)__wt_atomic_add64(&log->slot_large, 1);
+        if (mysize > WT_LOG_SLOT_BUF_MAX(slot)) {
+            (void)__wt_atomic_add64(&log->slot_unbuffered, 1);
+            if (mysize > __wt_atomic_load64(&log->slot_unbuffered_max))
+                __wt_atomic_store64(&log->slot_unbuffered_max, mysize);
+        }
+    }
+    if (unbuffered)
+        F_SET(myslot, WT_MYSLOT_UNBUFFERED);
     if (LF_ISSET(WT_LOG_DSYNC | WT_LOG_FSYNC))
         F_SET_ATOMIC_16(slot, WT_SLOT_SYNC_DIR);
     if (LF_ISSET(WT_LOG_FLUSH))
@@ -692,5 +860,6 @@ __wt_log_slot_free(WT_SESSION_IMPL *session, WT_LOGSLOT *slot)
     WT_UNUSED(session);
     __wt_atomic_store16(&slot->flags_atomic, WT_SLOT_INIT_FLAGS);
     __wt_atomic_storei32(&slot->slot_error, 0);
+    __wt_atomic_store32(&slot->slot_sync_joins, 0);
     __wt_atomic_storeiv64(&slot->slot_state, WT_LOG_SLOT_FREE);
 }
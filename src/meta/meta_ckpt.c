@@ -265,6 +265,114 @@ __wt_meta_checkpoint_clear(WT_SESSION_IMPL *session, const char *fname)
     return (0);
 }
 
+/*
+ * __ckpt_meta_defer --
+ *     Save a file's checkpoint metadata to be written with the rest of the checkpoint's metadata.
+ */
+static int
+__ckpt_meta_defer(WT_SESSION_IMPL *session, const char *fname, const char *value)
+{
+    WT_CKPT_META_UPDATE *upd;
+    WT_DECL_RET;
+
+    WT_RET(__wt_realloc_def(
+      session, &session->ckpt_meta_allocated, session->ckpt_meta_next + 1, &session->ckpt_meta));
+    upd = &session->ckpt_meta[session->ckpt_meta_next];
+    WT_ERR(__wt_strdup(session, fname, &upd->uri));
+    WT_ERR(__wt_strdup(session, value, &upd->value));
+    upd->order = session->ckpt_meta_next++;
+    return (0);
+
+err:
+    __wt_free(session, upd->uri);
+    return (ret);
+}
+
+/*
+ * __ckpt_meta_compare --
+ *     Qsort comparison routine for deferred metadata updates: sort by URI, then in the order they
+ *     were made.
+ */
+static int WT_CDECL
+__ckpt_meta_compare(const void *a, const void *b)
+{
+    const WT_CKPT_META_UPDATE *upd_a, *upd_b;
+    int cmp;
+
+    upd_a = (const WT_CKPT_META_UPDATE *)a;
+    upd_b = (const WT_CKPT_META_UPDATE *)b;
+    if ((cmp = strcmp(upd_a->uri, upd_b->uri)) != 0)
+        return (cmp);
+    return (upd_a->order < upd_b->order ? -1 : 1);
+}
+
+/*
+ * __wt_meta_ckpt_deferred_apply --
+ *     Write the deferred checkpoint metadata updates, in key order, with a single metadata cursor.
+ */
+int
+__wt_meta_ckpt_deferred_apply(WT_SESSION_IMPL *session)
+{
+    WT_CKPT_META_UPDATE *upd;
+    WT_CURSOR *cursor;
+    WT_DECL_RET;
+    u_int i;
+    const char *value;
+
+    cursor = NULL;
+    if (session->ckpt_meta_next == 0)
+        return (0);
+
+    __wt_qsort(session->ckpt_meta, session->ckpt_meta_next, sizeof(WT_CKPT_META_UPDATE),
+      __ckpt_meta_compare);
+
+    WT_ERR(__wt_metadata_cursor(session, &cursor));
+    for (i = 0, upd = session->ckpt_meta; i < session->ckpt_meta_next; ++i, ++upd) {
+        __wt_verbose_debug3(session, WT_VERB_METADATA, "Update: key: %s, value: %s, deferred",
+          upd->uri, upd->value);
+
+        /*
+         * Track the previous value from the search that positions the cursor, the insert then
+         * updates the entry without searching again.
+         */
+        cursor->set_key(cursor, upd->uri);
+        if (WT_META_TRACKING(session)) {
+            if ((ret = cursor->search(cursor)) == 0)
+                WT_ERR(cursor->get_value(cursor, &value));
+            else {
+                WT_ERR_NOTFOUND_OK(ret, false);
+                value = NULL;
+            }
+            WT_ERR(__wt_meta_track_update_value(session, upd->uri, value));
+        }
+        cursor->set_value(cursor, upd->value);
+        WT_ERR(cursor->insert(cursor));
+    }
+
+err:
+    WT_TRET(__wt_metadata_cursor_release(session, &cursor));
+    __wt_meta_ckpt_deferred_free(session);
+    return (ret);
+}
+
+/*
+ * __wt_meta_ckpt_deferred_free --
+ *     Discard any deferred checkpoint metadata updates.
+ */
+void
+__wt_meta_ckpt_deferred_free(WT_SESSION_IMPL *session)
+{
+    WT_CKPT_META_UPDATE *upd;
+    u_int i;
+
+    for (i = 0, upd = session->ckpt_meta; i < session->ckpt_meta_next; ++i, ++upd) {
+        __wt_free(session, upd->uri);
+        __wt_free(session, upd->value);
+    }
+    __wt_free(session, session->ckpt_meta);
+    session->ckpt_meta_allocated = session->ckpt_meta_next = 0;
+}
+
 /*
  * __ckpt_set --
  *     Set a file's checkpoint.
@@ -312,7 +420,10 @@ __ckpt_set(WT_SESSION_IMPL *session, const char *fname, const char *v, bool use_
 
         /* Concatenate the metadata base string with the checkpoint string. */
         WT_ERR(__wt_buf_fmt(session, tmp, "%s,%s", meta_base, str));
-        WT_ERR(__wt_metadata_update(session, fname, tmp->mem));
+        if (session->ckpt_meta_defer)
+            WT_ERR(__ckpt_meta_defer(session, fname, tmp->mem));
+        else
+            WT_ERR(__wt_metadata_update(session, fname, tmp->mem));
     } else {
         /* Retrieve the metadata for this file. */
         WT_ERR(__wt_metadata_search(session, fname, &config));
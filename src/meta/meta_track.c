@@ -450,6 +450,29 @@ err:
     return (ret);
 }
 
+/*
+ * __wt_meta_track_update_value --
+ *     Track a metadata update operation, given the entry's current value, NULL if there isn't one.
+ */
+int
+__wt_meta_track_update_value(WT_SESSION_IMPL *session, const char *key, const char *value)
+{
+    WT_DECL_RET;
+    WT_META_TRACK *trk;
+
+    WT_RET(__meta_track_next(session, &trk));
+
+    trk->op = value == NULL ? WT_ST_REMOVE : WT_ST_SET;
+    WT_ERR(__wt_strdup(session, key, &trk->a));
+    if (value != NULL)
+        WT_ERR(__wt_strdup(session, value, &trk->b));
+    return (0);
+
+err:
+    __meta_track_err(session);
+    return (ret);
+}
+
 /*
  * __wt_meta_track_fileop --
  *     Track a filesystem operation.
@@ -56,12 +56,17 @@ __wt_reconcile(WT_SESSION_IMPL *session, WT_REF *ref, WT_SALVAGE_COOKIE *salvage
     /* Can't do history store eviction for history store itself or for metadata. */
     WT_ASSERT(session,
       !LF_ISSET(WT_REC_HS) || (!WT_IS_HS(btree->dhandle) && !WT_IS_METADATA(btree->dhandle)));
-    /* Flag as unused for non diagnostic builds. */
-    WT_UNUSED(btree);
-
     /* It's an error to be called with a clean page. */
     WT_ASSERT(session, __wt_page_is_modified(page));
 
+    /*
+     * Eviction of a tree with a history store of its own must not wait on the handle list lock to
+     * find that history store, see __wt_curhs_cache for the deadlock. Give up on the eviction if the
+     * handle isn't in the session's cache and can't be found without waiting.
+     */
+    if (LF_ISSET(WT_REC_EVICT) && btree->hs_id != 0)
+        WT_RET(__wt_hs_cache_dhandle(session, btree->hs_id));
+
     /*
      * Reconciliation acquires and releases pages, and in rare cases that page release triggers
      * eviction. If the page is dirty, eviction can trigger reconciliation, and we re-enter this
@@ -783,8 +788,18 @@ __rec_cleanup(WT_SESSION_IMPL *session, WT_RECONCILE *r)
 
     btree = S2BT(session);
 
-    if (r->hs_cursor != NULL)
-        WT_RET(r->hs_cursor->reset(r->hs_cursor));
+    /*
+     * The history store cursor is kept across runs for the shared history store, a cursor on a
+     * tree's own history store is closed so it doesn't hold that store open against a drop.
+     */
+    if (r->hs_cursor != NULL) {
+        if (btree->hs_id == 0)
+            WT_RET(r->hs_cursor->reset(r->hs_cursor));
+        else {
+            WT_RET(r->hs_cursor->close(r->hs_cursor));
+            r->hs_cursor = NULL;
+        }
+    }
 
     if (btree->type == BTREE_ROW)
         for (multi = r->multi, i = 0; i < r->multi_next; ++multi, ++i)
@@ -2796,7 +2811,7 @@ __wt_rec_hs_clear_on_tombstone(
 
     /* Open a history store cursor if we don't yet have one. */
     if (r->hs_cursor == NULL)
-        WT_RET(__wt_curhs_open(session, NULL, &r->hs_cursor));
+        WT_RET(__wt_curhs_open(session, btree->hs_id, NULL, &r->hs_cursor));
 
     /*
      * From WT_TS_NONE delete/reinsert all the history store content of the key. The test of
@@ -282,12 +282,12 @@ __wt_rts_btree_walk_btree_apply(
     wt_timestamp_t max_durable_ts, newest_start_durable_ts, newest_stop_durable_ts;
     size_t addr_size;
     uint64_t rollback_txnid, write_gen;
-    uint32_t btree_id;
+    uint32_t btree_id, hs_id;
     char ts_string[2][WT_TS_INT_STRING_SIZE];
     bool file_skipped, has_txn_updates_gt_than_ckpt_snap, modified, prepared_updates;
 
     /* Ignore non-btree objects as well as the metadata and history store files. */
-    if (!WT_BTREE_PREFIX(uri) || strcmp(uri, WT_HS_URI) == 0 || strcmp(uri, WT_METAFILE_URI) == 0)
+    if (!WT_BTREE_PREFIX(uri) || WT_IS_HS_URI(uri) || strcmp(uri, WT_METAFILE_URI) == 0)
         return (0);
 
     addr_size = 0;
@@ -424,7 +424,8 @@ __wt_rts_btree_walk_btree_apply(
       !F_ISSET(S2C(session), WT_CONN_IN_MEMORY)) {
         WT_RET(__wt_config_getones(session, config, "id", &cval));
         btree_id = (uint32_t)cval.val;
-        WT_RET(__wt_rts_history_btree_hs_truncate(session, btree_id));
+        WT_RET(__wt_hs_id_config(session, config, &hs_id));
+        WT_RET(__wt_rts_history_btree_hs_truncate(session, hs_id, btree_id));
     }
 
     return (0);
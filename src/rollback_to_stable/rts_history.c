@@ -30,7 +30,7 @@ __wt_rts_history_delete_hs(WT_SESSION_IMPL *session, WT_ITEM *key, wt_timestamp_
     btree_id = S2BT(session)->id;
 
     /* Open a history store table cursor. */
-    WT_RET(__wt_curhs_open(session, NULL, &hs_cursor));
+    WT_RET(__wt_curhs_open(session, S2BT(session)->hs_id, NULL, &hs_cursor));
     /*
      * Rollback-to-stable operates exclusively (i.e., it is the only active operation in the system)
      * outside the constraints of transactions. Therefore, there is no need for snapshot based
@@ -91,10 +91,11 @@ err:
 
 /*
  * __wt_rts_history_btree_hs_truncate --
- *     Wipe all history store updates for the btree (non-timestamped tables)
+ *     Wipe all history store updates for the btree (non-timestamped tables) from the history store
+ *     with the given ID.
  */
 int
-__wt_rts_history_btree_hs_truncate(WT_SESSION_IMPL *session, uint32_t btree_id)
+__wt_rts_history_btree_hs_truncate(WT_SESSION_IMPL *session, uint32_t hs_id, uint32_t btree_id)
 {
     WT_CURSOR *hs_cursor_start, *hs_cursor_stop;
     WT_DECL_ITEM(hs_key);
@@ -114,7 +115,7 @@ __wt_rts_history_btree_hs_truncate(WT_SESSION_IMPL *session, uint32_t btree_id)
     WT_RET(__wt_scr_alloc(session, 0, &hs_key));
 
     /* Open a history store start cursor. */
-    WT_ERR(__wt_curhs_open(session, NULL, &hs_cursor_start));
+    WT_ERR(__wt_curhs_open(session, hs_id, NULL, &hs_cursor_start));
     F_SET(hs_cursor_start, WT_CURSTD_HS_READ_COMMITTED);
 
     hs_cursor_start->set_key(hs_cursor_start, 1, btree_id);
@@ -129,7 +130,7 @@ __wt_rts_history_btree_hs_truncate(WT_SESSION_IMPL *session, uint32_t btree_id)
       btree_id);
 
     /* Open a history store stop cursor. */
-    WT_ERR(__wt_curhs_open(session, NULL, &hs_cursor_stop));
+    WT_ERR(__wt_curhs_open(session, hs_id, NULL, &hs_cursor_stop));
     F_SET(hs_cursor_stop, WT_CURSTD_HS_READ_COMMITTED | WT_CURSTD_HS_READ_ACROSS_BTREE);
 
     hs_cursor_stop->set_key(hs_cursor_stop, 1, btree_id + 1);
@@ -177,28 +178,25 @@ err:
 }
 
 /*
- * __wt_rts_history_final_pass --
- *     Perform rollback to stable on the history store to remove any entries newer than the stable
- *     timestamp.
+ * __rts_history_final_pass_one --
+ *     Perform rollback to stable on one history store.
  */
-int
-__wt_rts_history_final_pass(WT_SESSION_IMPL *session, wt_timestamp_t rollback_timestamp)
+static int
+__rts_history_final_pass_one(
+  WT_SESSION_IMPL *session, const char *uri, wt_timestamp_t rollback_timestamp)
 {
     WT_CONFIG ckptconf;
     WT_CONFIG_ITEM cval, durableval, key;
-    WT_CONNECTION_IMPL *conn;
     WT_DECL_RET;
     wt_timestamp_t max_durable_ts, newest_stop_durable_ts, newest_stop_ts;
-    size_t i;
     char *config;
     char ts_string[2][WT_TS_INT_STRING_SIZE];
     bool release_dhandle;
 
     config = NULL;
-    conn = S2C(session);
     release_dhandle = false;
 
-    WT_RET(__wt_metadata_search(session, WT_HS_URI, &config));
+    WT_RET(__wt_metadata_search(session, uri, &config));
 
     /*
      * Find out the max durable timestamp of the history store from checkpoint. Most of the history
@@ -221,7 +219,7 @@ __wt_rts_history_final_pass(WT_SESSION_IMPL *session, wt_timestamp_t rollback_ti
         WT_ERR_NOTFOUND_OK(ret, false);
     }
     max_durable_ts = WT_MAX(newest_stop_ts, newest_stop_durable_ts);
-    WT_ERR(__wt_session_get_dhandle(session, WT_HS_URI, NULL, NULL, 0));
+    WT_ERR(__wt_session_get_dhandle(session, uri, NULL, NULL, 0));
     release_dhandle = true;
 
     /*
@@ -248,6 +246,38 @@ __wt_rts_history_final_pass(WT_SESSION_IMPL *session, wt_timestamp_t rollback_ti
           __wt_timestamp_to_string(max_durable_ts, ts_string[0]),
           __wt_timestamp_to_string(rollback_timestamp, ts_string[1]));
 
+err:
+    if (release_dhandle)
+        WT_TRET(__wt_session_release_dhandle(session));
+    __wt_free(session, config);
+    return (ret);
+}
+
+/*
+ * __wt_rts_history_final_pass --
+ *     Perform rollback to stable on the history stores to remove any entries newer than the stable
+ *     timestamp.
+ */
+int
+__wt_rts_history_final_pass(WT_SESSION_IMPL *session, wt_timestamp_t rollback_timestamp)
+{
+    WT_CONNECTION_IMPL *conn;
+    WT_DECL_RET;
+    size_t i;
+    uint32_t *hs_ids;
+    char hs_uri[WT_HS_URI_SIZE];
+
+    conn = S2C(session);
+
+    WT_RET(__rts_history_final_pass_one(session, WT_HS_URI, rollback_timestamp));
+
+    /* Files with a history store of their own are rolled back the same way. */
+    WT_RET(__wt_hs_separate_ids(session, &hs_ids));
+    for (i = 0; hs_ids != NULL && hs_ids[i] != 0; ++i) {
+        WT_ERR(__wt_hs_uri(hs_ids[i], hs_uri, sizeof(hs_uri)));
+        WT_ERR(__rts_history_final_pass_one(session, hs_uri, rollback_timestamp));
+    }
+
     /*
      * Truncate history store entries from the partial backup remove list. The list holds all of the
      * btree ids that do not exist as part of the database anymore due to performing a selective
@@ -255,10 +285,9 @@ __wt_rts_history_final_pass(WT_SESSION_IMPL *session, wt_timestamp_t rollback_ti
      */
     if (F_ISSET(conn, WT_CONN_BACKUP_PARTIAL_RESTORE) && conn->partial_backup_remove_ids != NULL)
         for (i = 0; conn->partial_backup_remove_ids[i] != 0; ++i)
-            WT_ERR(__wt_rts_history_btree_hs_truncate(session, conn->partial_backup_remove_ids[i]));
+            WT_ERR(
+              __wt_rts_history_btree_hs_truncate(session, 0, conn->partial_backup_remove_ids[i]));
 err:
-    if (release_dhandle)
-        WT_TRET(__wt_session_release_dhandle(session));
-    __wt_free(session, config);
+    __wt_free(session, hs_ids);
     return (ret);
 }
@@ -149,8 +149,8 @@ __create_file(WT_SESSION_IMPL *session, const char *uri, bool exclusive, const c
     const char *filename, **p,
       *filecfg[] = {WT_CONFIG_BASE(session, file_meta), config, NULL, NULL, NULL, NULL},
       *filestripped;
-    char *fileconf, *filemeta;
-    uint32_t allocsize;
+    char *fileconf, *filemeta, hs_uri[WT_HS_URI_SIZE];
+    uint32_t allocsize, hs_id;
     bool against_stable, exists, import, import_repair, is_metadata;
 
     fileconf = filemeta = NULL;
@@ -181,9 +181,10 @@ __create_file(WT_SESSION_IMPL *session, const char *uri, bool exclusive, const c
      * is copied without a checkpoint into another location and trying to recover from it leads to
      * that history store file exists on disk but not as part of metadata. As we recreate the
      * history store file on every restart to ensure that history store file is present. Make sure
-     * to remove the already exist history store file in the directory.
+     * to remove the already exist history store file in the directory. A file's own history store
+     * is only created with the file, any existing copy is left over from a failed create or drop.
      */
-    if (strcmp(uri, WT_HS_URI) == 0) {
+    if (WT_IS_HS_URI(uri)) {
         WT_IGNORE_RET(__wt_fs_exist(session, filename, &exists));
         if (exists)
             WT_IGNORE_RET(__wt_fs_remove(session, filename, true, false));
@@ -298,6 +299,18 @@ __create_file(WT_SESSION_IMPL *session, const char *uri, bool exclusive, const c
                 WT_CONFIG_LIT_MATCH("stable_timestamp", cval));
             WT_ERR(__check_imported_ts(session, uri, filestripped, against_stable));
         }
+
+        /*
+         * A file configured with a history store of its own gets it created along with the file,
+         * the file's open below expects to find it.
+         */
+        if (!WT_IS_HS_URI(uri)) {
+            WT_ERR(__wt_hs_id_config(session, fileconf, &hs_id));
+            if (hs_id != 0) {
+                WT_ERR(__wt_hs_uri(hs_id, hs_uri, sizeof(hs_uri)));
+                WT_ERR(__create_file(session, hs_uri, true, WT_HS_CONFIG));
+            }
+        }
     }
 
     /*
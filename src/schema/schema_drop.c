@@ -18,6 +18,8 @@ __drop_file(
 {
     WT_CONFIG_ITEM cval;
     WT_DECL_RET;
+    uint32_t hs_id;
+    char *config, hs_uri[WT_HS_URI_SIZE];
     const char *filename;
     bool remove_files;
 
@@ -28,6 +30,15 @@ __drop_file(
     WT_PREFIX_SKIP_REQUIRED(session, filename, "file:");
 
     WT_RET(__wt_schema_backup_check(session, filename));
+
+    /* Find out if the file has a history store of its own, it's dropped along with the file. */
+    hs_id = 0;
+    if (!WT_IS_HS_URI(uri) && __wt_metadata_search(session, uri, &config) == 0) {
+        ret = __wt_hs_id_config(session, config, &hs_id);
+        __wt_free(session, config);
+        WT_RET(ret);
+    }
+
     /* Close all btree handles associated with this file. */
     WT_WITH_HANDLE_LIST_WRITE_LOCK(
       session, ret = __wt_conn_dhandle_close_all(session, uri, true, force, check_visibility));
@@ -35,13 +46,21 @@ __drop_file(
 
     /* Remove the metadata entry (ignore missing items). */
     WT_TRET(__wt_metadata_remove(session, uri));
-    if (!remove_files)
-        return (ret);
 
     /*
      * Schedule the remove of the underlying physical file when the drop completes.
      */
-    WT_TRET(__wt_meta_track_drop(session, filename));
+    if (remove_files)
+        WT_TRET(__wt_meta_track_drop(session, filename));
+
+    /*
+     * The file's history is only in its own history store, dropping the whole history store frees
+     * it without searching the shared history store for the file's records.
+     */
+    if (ret == 0 && hs_id != 0) {
+        WT_RET(__wt_hs_uri(hs_id, hs_uri, sizeof(hs_uri)));
+        WT_RET(__drop_file(session, hs_uri, force, cfg, false));
+    }
 
     return (ret);
 }
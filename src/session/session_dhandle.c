@@ -350,10 +350,10 @@ __session_fetch_checkpoint_snapshot_wall_time(
  *     Get a btree handle for the requested checkpoint of the history store and return it.
  */
 static int
-__session_open_hs_ckpt(WT_SESSION_IMPL *session, const char *checkpoint, const char *cfg[],
-  uint32_t flags, int64_t order_expected, WT_DATA_HANDLE **hs_dhandlep)
+__session_open_hs_ckpt(WT_SESSION_IMPL *session, const char *hs_uri, const char *checkpoint,
+  const char *cfg[], uint32_t flags, int64_t order_expected, WT_DATA_HANDLE **hs_dhandlep)
 {
-    WT_RET(__wt_session_get_dhandle(session, WT_HS_URI, checkpoint, cfg, flags));
+    WT_RET(__wt_session_get_dhandle(session, hs_uri, checkpoint, cfg, flags));
 
     if (session->dhandle->checkpoint_order != order_expected) {
         /* Not what we were expecting; treat as EBUSY and let the caller retry. */
@@ -386,6 +386,8 @@ __wt_session_get_btree_ckpt(WT_SESSION_IMPL *session, const char *uri, const cha
     uint64_t ckpt_gen, ds_time, first_snapshot_time, hs_time, oldest_time, snapshot_time;
     uint64_t stable_time;
     int64_t ds_order, hs_order;
+    uint32_t hs_id;
+    char *config, hs_uri[WT_HS_URI_SIZE];
     const char *checkpoint, *hs_checkpoint;
     bool ckpt_running, is_hs, is_reserved_name, is_unnamed_ckpt, must_resolve;
 
@@ -502,11 +504,20 @@ __wt_session_get_btree_ckpt(WT_SESSION_IMPL *session, const char *uri, const cha
      * life of the checkpoint cursor.
      */
 
-    is_hs = strcmp(uri, WT_HS_URI) == 0;
+    is_hs = WT_IS_HS_URI(uri);
     if (is_hs)
         /* We're opening the history store directly, so don't open it twice. */
         hs_dhandlep = NULL;
 
+    /* Find the history store holding the file's history: its own, or the shared one. */
+    hs_id = 0;
+    if (hs_dhandlep != NULL && (ret = __wt_metadata_search(session, uri, &config)) == 0) {
+        ret = __wt_hs_id_config(session, config, &hs_id);
+        __wt_free(session, config);
+    }
+    WT_RET_NOTFOUND_OK(ret);
+    WT_RET(__wt_hs_uri(hs_id, hs_uri, sizeof(hs_uri)));
+
     /*
      * Applications can use the internal reserved name "WiredTigerCheckpoint" to open the latest
      * checkpoint, but they are not allowed to directly open specific checkpoint versions, such as
@@ -574,10 +585,10 @@ __wt_session_get_btree_ckpt(WT_SESSION_IMPL *session, const char *uri, const cha
         if (hs_dhandlep != NULL) {
             if (must_resolve)
                 WT_RET_NOTFOUND_OK(__wt_meta_checkpoint_last_name(
-                  session, WT_HS_URI, &hs_checkpoint, &hs_order, &hs_time));
+                  session, hs_uri, &hs_checkpoint, &hs_order, &hs_time));
             else {
                 ret =
-                  __wt_meta_checkpoint_by_name(session, WT_HS_URI, checkpoint, &hs_order, &hs_time);
+                  __wt_meta_checkpoint_by_name(session, hs_uri, checkpoint, &hs_order, &hs_time);
                 WT_RET_NOTFOUND_OK(ret);
                 if (ret == WT_NOTFOUND)
                     ret = 0;
@@ -674,8 +685,8 @@ __wt_session_get_btree_ckpt(WT_SESSION_IMPL *session, const char *uri, const cha
             /* Get a handle for the history store. */
             WT_ASSERT(session, hs_dhandlep != NULL);
             WT_WITHOUT_DHANDLE(session,
-              ret =
-                __session_open_hs_ckpt(session, hs_checkpoint, cfg, flags, hs_order, hs_dhandlep));
+              ret = __session_open_hs_ckpt(
+                session, hs_uri, hs_checkpoint, cfg, flags, hs_order, hs_dhandlep));
             if (ret != 0)
                 WT_TRET(__wt_session_release_dhandle(session));
         }
@@ -795,6 +806,50 @@ __session_find_shared_dhandle(WT_SESSION_IMPL *session, const char *uri, const c
     return (ret);
 }
 
+/*
+ * __wt_session_try_cache_dhandle --
+ *     Make sure an open data handle is in the session cache without waiting on the handle list
+ *     lock, so later gets of the handle don't need that lock. Return EBUSY if the lock isn't
+ *     immediately available or the handle isn't open.
+ */
+int
+__wt_session_try_cache_dhandle(WT_SESSION_IMPL *session, const char *uri)
+{
+    WT_DATA_HANDLE *saved_dhandle;
+    WT_DATA_HANDLE_CACHE *dhandle_cache;
+    WT_DECL_RET;
+    bool locked;
+
+    __session_find_dhandle(session, uri, NULL, &dhandle_cache);
+    if (dhandle_cache != NULL)
+        return (0);
+
+    saved_dhandle = session->dhandle;
+    locked = false;
+    if (!FLD_ISSET(session->lock_flags, WT_SESSION_LOCKED_HANDLE_LIST)) {
+        WT_RET(__wt_try_readlock(session, &S2C(session)->dhandle_lock));
+        FLD_SET(session->lock_flags, WT_SESSION_LOCKED_HANDLE_LIST_READ);
+        locked = true;
+    }
+    if ((ret = __wt_conn_dhandle_find(session, uri, NULL)) == 0) {
+        if (F_ISSET(session->dhandle, WT_DHANDLE_OPEN))
+            WT_DHANDLE_ACQUIRE(session->dhandle);
+        else
+            ret = __wt_set_return(session, EBUSY);
+    } else if (ret == WT_NOTFOUND)
+        ret = __wt_set_return(session, EBUSY);
+    if (locked) {
+        FLD_CLR(session->lock_flags, WT_SESSION_LOCKED_HANDLE_LIST_READ);
+        __wt_readunlock(session, &S2C(session)->dhandle_lock);
+    }
+
+    if (ret == 0 && (ret = __session_add_dhandle(session)) != 0)
+        WT_DHANDLE_RELEASE(session->dhandle);
+
+    session->dhandle = saved_dhandle;
+    return (ret);
+}
+
 /*
  * __session_get_dhandle --
  *     Search for a data handle, first in the session cache, then in the connection.
@@ -90,13 +90,17 @@ static const char *const __stats_dsrc_desc[] = {
   "cache: eviction walks started from root of tree",
   "cache: eviction walks started from saved location in tree",
   "cache: hazard pointer blocked page eviction",
+  "cache: history store table bloom filters built",
   "cache: history store table insert calls",
   "cache: history store table insert calls that returned restart",
   "cache: history store table reads",
   "cache: history store table reads missed",
+  "cache: history store table reads not skipped by the bloom filter that found no history",
   "cache: history store table reads requiring squashed modifies",
+  "cache: history store table reads skipped by the bloom filter",
   "cache: history store table resolved updates without timestamps that lose their durable "
   "timestamp",
+  "cache: history store table reverse modifies applied by reads",
   "cache: history store table truncation by rollback to stable to remove an unstable update",
   "cache: history store table truncation by rollback to stable to remove an update",
   "cache: history store table truncation to remove all the keys of a btree",
@@ -121,6 +125,7 @@ static const char *const __stats_dsrc_desc[] = {
   "cache: leaf pages split during eviction",
   "cache: locate a random in-mem ref by examining all entries on the root page",
   "cache: modified pages evicted",
+  "cache: modify updates skipped by update chain consolidation",
   "cache: multi-block reconciliation blocked whilst checkpoint is running",
   "cache: overflow keys on a multiblock row-store page blocked its eviction",
   "cache: overflow pages read into cache",
@@ -138,11 +143,18 @@ static const char *const __stats_dsrc_desc[] = {
   "cache: recent modification of a page blocked its eviction",
   "cache: reverse splits performed",
   "cache: reverse splits skipped because of VLCS namespace gap restrictions",
+  "cache: the number of bytes saved by inserting reverse modifies instead of full updates to "
+  "history store",
   "cache: the number of times full update inserted to history store",
   "cache: the number of times reverse modify inserted to history store",
   "cache: tracked dirty bytes in the cache",
   "cache: uncommitted truncate blocked page eviction",
   "cache: unmodified pages evicted",
+  "cache: update chain length histogram - 0-9",
+  "cache: update chain length histogram - 10-99",
+  "cache: update chain length histogram - 100-999",
+  "cache: update chain length histogram - 1000 and higher",
+  "cache: update chains consolidated into a full value",
   "cache_walk: Average difference between current eviction generation when the page was last "
   "considered",
   "cache_walk: Average on-disk page image size seen",
@@ -447,12 +459,16 @@ __wt_stat_dsrc_clear_single(WT_DSRC_STATS *stats)
     stats->cache_eviction_walk_from_root = 0;
     stats->cache_eviction_walk_saved_pos = 0;
     stats->cache_eviction_blocked_hazard = 0;
+    stats->cache_hs_bloom_build = 0;
     stats->cache_hs_insert = 0;
     stats->cache_hs_insert_restart = 0;
     stats->cache_hs_read = 0;
     stats->cache_hs_read_miss = 0;
+    stats->cache_hs_bloom_false_positive = 0;
     stats->cache_hs_read_squash = 0;
+    stats->cache_hs_bloom_skip = 0;
     stats->cache_hs_order_lose_durable_timestamp = 0;
+    stats->cache_hs_read_squash_modify = 0;
     stats->cache_hs_key_truncate_rts_unstable = 0;
     stats->cache_hs_key_truncate_rts = 0;
     stats->cache_hs_btree_truncate = 0;
@@ -472,6 +488,7 @@ __wt_stat_dsrc_clear_single(WT_DSRC_STATS *stats)
     stats->cache_eviction_split_leaf = 0;
     stats->cache_eviction_random_sample_inmem_root = 0;
     stats->cache_eviction_dirty = 0;
+    stats->cache_update_chain_consolidate_modify = 0;
     stats->cache_eviction_blocked_multi_block_reconcilation_during_checkpoint = 0;
     stats->cache_eviction_blocked_overflow_keys = 0;
     stats->cache_read_overflow = 0;
@@ -489,11 +506,17 @@ __wt_stat_dsrc_clear_single(WT_DSRC_STATS *stats)
     stats->cache_eviction_blocked_recently_modified = 0;
     stats->cache_reverse_splits = 0;
     stats->cache_reverse_splits_skipped_vlcs = 0;
+    stats->cache_hs_insert_reverse_modify_saved = 0;
     stats->cache_hs_insert_full_update = 0;
     stats->cache_hs_insert_reverse_modify = 0;
     /* not clearing cache_bytes_dirty */
     stats->cache_eviction_blocked_uncommitted_truncate = 0;
     stats->cache_eviction_clean = 0;
+    stats->cache_update_chain_lt10 = 0;
+    stats->cache_update_chain_lt100 = 0;
+    stats->cache_update_chain_lt1000 = 0;
+    stats->cache_update_chain_ge1000 = 0;
+    stats->cache_update_chain_consolidate = 0;
     /* not clearing cache_state_gen_avg_gap */
     /* not clearing cache_state_avg_written_size */
     /* not clearing cache_state_avg_visited_age */
@@ -780,12 +803,16 @@ __wt_stat_dsrc_aggregate_single(WT_DSRC_STATS *from, WT_DSRC_STATS *to)
     to->cache_eviction_walk_from_root += from->cache_eviction_walk_from_root;
     to->cache_eviction_walk_saved_pos += from->cache_eviction_walk_saved_pos;
     to->cache_eviction_blocked_hazard += from->cache_eviction_blocked_hazard;
+    to->cache_hs_bloom_build += from->cache_hs_bloom_build;
     to->cache_hs_insert += from->cache_hs_insert;
     to->cache_hs_insert_restart += from->cache_hs_insert_restart;
     to->cache_hs_read += from->cache_hs_read;
     to->cache_hs_read_miss += from->cache_hs_read_miss;
+    to->cache_hs_bloom_false_positive += from->cache_hs_bloom_false_positive;
     to->cache_hs_read_squash += from->cache_hs_read_squash;
+    to->cache_hs_bloom_skip += from->cache_hs_bloom_skip;
     to->cache_hs_order_lose_durable_timestamp += from->cache_hs_order_lose_durable_timestamp;
+    to->cache_hs_read_squash_modify += from->cache_hs_read_squash_modify;
     to->cache_hs_key_truncate_rts_unstable += from->cache_hs_key_truncate_rts_unstable;
     to->cache_hs_key_truncate_rts += from->cache_hs_key_truncate_rts;
     to->cache_hs_btree_truncate += from->cache_hs_btree_truncate;
@@ -807,6 +834,7 @@ __wt_stat_dsrc_aggregate_single(WT_DSRC_STATS *from, WT_DSRC_STATS *to)
     to->cache_eviction_split_leaf += from->cache_eviction_split_leaf;
     to->cache_eviction_random_sample_inmem_root += from->cache_eviction_random_sample_inmem_root;
     to->cache_eviction_dirty += from->cache_eviction_dirty;
+    to->cache_update_chain_consolidate_modify += from->cache_update_chain_consolidate_modify;
     to->cache_eviction_blocked_multi_block_reconcilation_during_checkpoint +=
       from->cache_eviction_blocked_multi_block_reconcilation_during_checkpoint;
     to->cache_eviction_blocked_overflow_keys += from->cache_eviction_blocked_overflow_keys;
@@ -825,12 +853,18 @@ __wt_stat_dsrc_aggregate_single(WT_DSRC_STATS *from, WT_DSRC_STATS *to)
     to->cache_eviction_blocked_recently_modified += from->cache_eviction_blocked_recently_modified;
     to->cache_reverse_splits += from->cache_reverse_splits;
     to->cache_reverse_splits_skipped_vlcs += from->cache_reverse_splits_skipped_vlcs;
+    to->cache_hs_insert_reverse_modify_saved += from->cache_hs_insert_reverse_modify_saved;
     to->cache_hs_insert_full_update += from->cache_hs_insert_full_update;
     to->cache_hs_insert_reverse_modify += from->cache_hs_insert_reverse_modify;
     to->cache_bytes_dirty += from->cache_bytes_dirty;
     to->cache_eviction_blocked_uncommitted_truncate +=
       from->cache_eviction_blocked_uncommitted_truncate;
     to->cache_eviction_clean += from->cache_eviction_clean;
+    to->cache_update_chain_lt10 += from->cache_update_chain_lt10;
+    to->cache_update_chain_lt100 += from->cache_update_chain_lt100;
+    to->cache_update_chain_lt1000 += from->cache_update_chain_lt1000;
+    to->cache_update_chain_ge1000 += from->cache_update_chain_ge1000;
+    to->cache_update_chain_consolidate += from->cache_update_chain_consolidate;
     to->cache_state_gen_avg_gap += from->cache_state_gen_avg_gap;
     to->cache_state_avg_written_size += from->cache_state_avg_written_size;
     to->cache_state_avg_visited_age += from->cache_state_avg_visited_age;
@@ -1123,13 +1157,17 @@ __wt_stat_dsrc_aggregate(WT_DSRC_STATS **from, WT_DSRC_STATS *to)
     to->cache_eviction_walk_from_root += WT_STAT_DSRC_READ(from, cache_eviction_walk_from_root);
     to->cache_eviction_walk_saved_pos += WT_STAT_DSRC_READ(from, cache_eviction_walk_saved_pos);
     to->cache_eviction_blocked_hazard += WT_STAT_DSRC_READ(from, cache_eviction_blocked_hazard);
+    to->cache_hs_bloom_build += WT_STAT_DSRC_READ(from, cache_hs_bloom_build);
     to->cache_hs_insert += WT_STAT_DSRC_READ(from, cache_hs_insert);
     to->cache_hs_insert_restart += WT_STAT_DSRC_READ(from, cache_hs_insert_restart);
     to->cache_hs_read += WT_STAT_DSRC_READ(from, cache_hs_read);
     to->cache_hs_read_miss += WT_STAT_DSRC_READ(from, cache_hs_read_miss);
+    to->cache_hs_bloom_false_positive += WT_STAT_DSRC_READ(from, cache_hs_bloom_false_positive);
     to->cache_hs_read_squash += WT_STAT_DSRC_READ(from, cache_hs_read_squash);
+    to->cache_hs_bloom_skip += WT_STAT_DSRC_READ(from, cache_hs_bloom_skip);
     to->cache_hs_order_lose_durable_timestamp +=
       WT_STAT_DSRC_READ(from, cache_hs_order_lose_durable_timestamp);
+    to->cache_hs_read_squash_modify += WT_STAT_DSRC_READ(from, cache_hs_read_squash_modify);
     to->cache_hs_key_truncate_rts_unstable +=
       WT_STAT_DSRC_READ(from, cache_hs_key_truncate_rts_unstable);
     to->cache_hs_key_truncate_rts += WT_STAT_DSRC_READ(from, cache_hs_key_truncate_rts);
@@ -1155,6 +1193,8 @@ __wt_stat_dsrc_aggregate(WT_DSRC_STATS **from, WT_DSRC_STATS *to)
     to->cache_eviction_random_sample_inmem_root +=
       WT_STAT_DSRC_READ(from, cache_eviction_random_sample_inmem_root);
     to->cache_eviction_dirty += WT_STAT_DSRC_READ(from, cache_eviction_dirty);
+    to->cache_update_chain_consolidate_modify +=
+      WT_STAT_DSRC_READ(from, cache_update_chain_consolidate_modify);
     to->cache_eviction_blocked_multi_block_reconcilation_during_checkpoint +=
       WT_STAT_DSRC_READ(from, cache_eviction_blocked_multi_block_reconcilation_during_checkpoint);
     to->cache_eviction_blocked_overflow_keys +=
@@ -1176,12 +1216,19 @@ __wt_stat_dsrc_aggregate(WT_DSRC_STATS **from, WT_DSRC_STATS *to)
     to->cache_reverse_splits += WT_STAT_DSRC_READ(from, cache_reverse_splits);
     to->cache_reverse_splits_skipped_vlcs +=
       WT_STAT_DSRC_READ(from, cache_reverse_splits_skipped_vlcs);
+    to->cache_hs_insert_reverse_modify_saved +=
+      WT_STAT_DSRC_READ(from, cache_hs_insert_reverse_modify_saved);
     to->cache_hs_insert_full_update += WT_STAT_DSRC_READ(from, cache_hs_insert_full_update);
     to->cache_hs_insert_reverse_modify += WT_STAT_DSRC_READ(from, cache_hs_insert_reverse_modify);
     to->cache_bytes_dirty += WT_STAT_DSRC_READ(from, cache_bytes_dirty);
     to->cache_eviction_blocked_uncommitted_truncate +=
       WT_STAT_DSRC_READ(from, cache_eviction_blocked_uncommitted_truncate);
     to->cache_eviction_clean += WT_STAT_DSRC_READ(from, cache_eviction_clean);
+    to->cache_update_chain_lt10 += WT_STAT_DSRC_READ(from, cache_update_chain_lt10);
+    to->cache_update_chain_lt100 += WT_STAT_DSRC_READ(from, cache_update_chain_lt100);
+    to->cache_update_chain_lt1000 += WT_STAT_DSRC_READ(from, cache_update_chain_lt1000);
+    to->cache_update_chain_ge1000 += WT_STAT_DSRC_READ(from, cache_update_chain_ge1000);
+    to->cache_update_chain_consolidate += WT_STAT_DSRC_READ(from, cache_update_chain_consolidate);
     to->cache_state_gen_avg_gap += WT_STAT_DSRC_READ(from, cache_state_gen_avg_gap);
     to->cache_state_avg_written_size += WT_STAT_DSRC_READ(from, cache_state_avg_written_size);
     to->cache_state_avg_visited_age += WT_STAT_DSRC_READ(from, cache_state_avg_visited_age);
@@ -1407,10 +1454,16 @@ static const char *const __stats_connection_desc[] = {
   "backup: total modified incremental blocks",
   "backup: total modified incremental blocks with compressed data",
   "backup: total modified incremental blocks without compressed data",
+  "block-cache: blocks admitted by the admission filter",
+  "block-cache: blocks rejected by the admission filter",
+  "block-cache: blocks stored compressed",
   "block-cache: cached blocks updated",
   "block-cache: cached bytes updated",
+  "block-cache: compressed blocks promoted to uncompressed",
+  "block-cache: effective capacity multiplier of compression (percent)",
   "block-cache: evicted blocks",
   "block-cache: file size causing bypass",
+  "block-cache: hit ratio (percent)",
   "block-cache: lookups",
   "block-cache: number of blocks not evicted due to overhead",
   "block-cache: number of bypasses because no-write-allocate setting was on",
@@ -1420,8 +1473,10 @@ static const char *const __stats_connection_desc[] = {
   "block-cache: number of eviction passes",
   "block-cache: number of hits",
   "block-cache: number of misses",
+  "block-cache: number of put bypasses because the hash buckets were full",
   "block-cache: number of put bypasses on checkpoint I/O",
   "block-cache: removed blocks",
+  "block-cache: time decompressing blocks on hits (usecs)",
   "block-cache: time sleeping to remove block (usecs)",
   "block-cache: total blocks",
   "block-cache: total blocks inserted on read path",
@@ -1432,6 +1487,7 @@ static const char *const __stats_connection_desc[] = {
   "block-manager: blocks pre-loaded",
   "block-manager: blocks read",
   "block-manager: blocks written",
+  "block-manager: blocks written in checkpoint write batches",
   "block-manager: bytes read",
   "block-manager: bytes read via memory map API",
   "block-manager: bytes read via system call API",
@@ -1440,6 +1496,9 @@ static const char *const __stats_connection_desc[] = {
   "block-manager: bytes written for checkpoint",
   "block-manager: bytes written via memory map API",
   "block-manager: bytes written via system call API",
+  "block-manager: checkpoint write batches written",
+  "block-manager: extent lists written incrementally",
+  "block-manager: incremental extent lists consolidated",
   "block-manager: mapped blocks read",
   "block-manager: mapped bytes read",
   "block-manager: number of times the file was remapped because it changed size via fallocate or "
@@ -1545,15 +1604,19 @@ static const char *const __stats_connection_desc[] = {
   "cache: hazard pointer check calls",
   "cache: hazard pointer check entries walked",
   "cache: hazard pointer maximum array length",
+  "cache: history store table bloom filters built",
   "cache: history store table insert calls",
   "cache: history store table insert calls that returned restart",
   "cache: history store table max on-disk size",
   "cache: history store table on-disk size",
   "cache: history store table reads",
   "cache: history store table reads missed",
+  "cache: history store table reads not skipped by the bloom filter that found no history",
   "cache: history store table reads requiring squashed modifies",
+  "cache: history store table reads skipped by the bloom filter",
   "cache: history store table resolved updates without timestamps that lose their durable "
   "timestamp",
+  "cache: history store table reverse modifies applied by reads",
   "cache: history store table truncation by rollback to stable to remove an unstable update",
   "cache: history store table truncation by rollback to stable to remove an update",
   "cache: history store table truncation to remove all the keys of a btree",
@@ -1585,6 +1648,7 @@ static const char *const __stats_connection_desc[] = {
   "cache: maximum page size seen at eviction",
   "cache: modified pages evicted",
   "cache: modified pages evicted by application threads",
+  "cache: modify updates skipped by update chain consolidation",
   "cache: multi-block reconciliation blocked whilst checkpoint is running",
   "cache: operations timed out waiting for space in cache",
   "cache: overflow keys on a multiblock row-store page blocked its eviction",
@@ -1622,6 +1686,8 @@ static const char *const __stats_connection_desc[] = {
   "cache: recent modification of a page blocked its eviction",
   "cache: reverse splits performed",
   "cache: reverse splits skipped because of VLCS namespace gap restrictions",
+  "cache: the number of bytes saved by inserting reverse modifies instead of full updates to "
+  "history store",
   "cache: the number of times full update inserted to history store",
   "cache: the number of times reverse modify inserted to history store",
   "cache: total milliseconds spent inside reentrant history store evictions in a reconciliation",
@@ -1631,6 +1697,11 @@ static const char *const __stats_connection_desc[] = {
   "cache: tracked dirty pages in the cache",
   "cache: uncommitted truncate blocked page eviction",
   "cache: unmodified pages evicted",
+  "cache: update chain length histogram - 0-9",
+  "cache: update chain length histogram - 10-99",
+  "cache: update chain length histogram - 100-999",
+  "cache: update chain length histogram - 1000 and higher",
+  "cache: update chains consolidated into a full value",
   "capacity: background fsync file handles considered",
   "capacity: background fsync file handles synced",
   "capacity: background fsync time (msecs)",
@@ -1640,13 +1711,16 @@ static const char *const __stats_connection_desc[] = {
   "capacity: bytes written for eviction",
   "capacity: bytes written for log",
   "capacity: bytes written total",
+  "capacity: checkpoint pacing rate (bytes per second)",
   "capacity: threshold to call fsync",
   "capacity: time waiting due to total capacity (usecs)",
   "capacity: time waiting during checkpoint (usecs)",
   "capacity: time waiting during eviction (usecs)",
   "capacity: time waiting during logging (usecs)",
   "capacity: time waiting during read (usecs)",
+  "capacity: time waiting for checkpoint pacing (usecs)",
   "capacity: time waiting for chunk cache IO bandwidth (usecs)",
+  "checkpoint: background flushes of dirty leaf pages between checkpoints",
   "checkpoint: checkpoint cleanup successful calls",
   "checkpoint: checkpoint has acquired a snapshot for its transaction",
   "checkpoint: checkpoints skipped because database was clean",
@@ -1661,6 +1735,7 @@ static const char *const __stats_connection_desc[] = {
   "checkpoint: most recent duration for gathering skipped handles (usecs)",
   "checkpoint: most recent duration for handles metadata checked (usecs)",
   "checkpoint: most recent duration for locking the handles (usecs)",
+  "checkpoint: most recent duration for writing tree metadata updates (usecs)",
   "checkpoint: most recent handles applied",
   "checkpoint: most recent handles checkpoint dropped",
   "checkpoint: most recent handles metadata checked",
@@ -1675,6 +1750,7 @@ static const char *const __stats_connection_desc[] = {
   "checkpoint: number of history store pages caused to be reconciled",
   "checkpoint: number of internal pages visited",
   "checkpoint: number of leaf pages visited",
+  "checkpoint: number of leaf pages written ahead of checkpoints",
   "checkpoint: number of pages caused to be reconciled",
   "checkpoint: pages added for eviction during checkpoint cleanup",
   "checkpoint: pages removed during checkpoint cleanup",
@@ -1711,6 +1787,11 @@ static const char *const __stats_connection_desc[] = {
   "chunk-cache: number of metadata inserts/deletes read by the worker thread",
   "chunk-cache: number of misses",
   "chunk-cache: number of times a read from storage failed",
+  "chunk-cache: read-ahead chunks accessed",
+  "chunk-cache: read-ahead chunks queued",
+  "chunk-cache: read-ahead chunks queued and not yet read",
+  "chunk-cache: read-ahead chunks read",
+  "chunk-cache: read-ahead chunks removed without being accessed",
   "chunk-cache: retried accessing a chunk while I/O was in progress",
   "chunk-cache: retries from a chunk cache checksum mismatch",
   "chunk-cache: timed out due to too many retries",
@@ -1848,17 +1929,38 @@ static const char *const __stats_connection_desc[] = {
   "lock: txn global read lock acquisitions",
   "lock: txn global write lock acquisitions",
   "log: busy returns attempting to switch slots",
+  "log: compression ratio of compressed records (percent)",
   "log: force log remove time sleeping (usecs)",
+  "log: group commit estimated sync time (usecs)",
+  "log: group commit estimated time between synchronous commits (usecs)",
+  "log: group commit latency histogram (bucket 1) - 0-99us",
+  "log: group commit latency histogram (bucket 2) - 100-249us",
+  "log: group commit latency histogram (bucket 3) - 250-499us",
+  "log: group commit latency histogram (bucket 4) - 500-999us",
+  "log: group commit latency histogram (bucket 5) - 1000-9999us",
+  "log: group commit latency histogram (bucket 6) - 10000us+",
+  "log: group commit latency histogram total (usecs)",
+  "log: group commit size histogram (bucket 1) - 1 commit",
+  "log: group commit size histogram (bucket 2) - 2-3 commits",
+  "log: group commit size histogram (bucket 3) - 4-7 commits",
+  "log: group commit size histogram (bucket 4) - 8-15 commits",
+  "log: group commit size histogram (bucket 5) - 16-31 commits",
+  "log: group commit size histogram (bucket 6) - 32+ commits",
+  "log: group commit slots held open",
+  "log: group commit time slots held open (usecs)",
   "log: log bytes of payload data",
   "log: log bytes written",
+  "log: log compression dictionaries built",
   "log: log files manually zero-filled",
   "log: log flush operations",
   "log: log force write operations",
   "log: log force write operations skipped",
   "log: log records compressed",
+  "log: log records compressed with a dictionary",
   "log: log records not compressed",
   "log: log records too small to compress",
   "log: log release advances write LSN",
+  "log: log release thread advances write LSN in order",
   "log: log scan operations",
   "log: log scan records requiring two reads",
   "log: log server thread advances write LSN",
@@ -1875,6 +1977,10 @@ static const char *const __stats_connection_desc[] = {
   "log: pre-allocated log files prepared",
   "log: pre-allocated log files used",
   "log: records processed by log scan",
+  "log: slot buffer size",
+  "log: slot buffer size decreases for slot pool exhaustion",
+  "log: slot buffer size decreases for small records",
+  "log: slot buffer size increases for unbuffered records",
   "log: slot close lost race",
   "log: slot close unbuffered waits",
   "log: slot closures",
@@ -1888,6 +1994,9 @@ static const char *const __stats_connection_desc[] = {
   "log: slot joins yield time (usecs)",
   "log: slot transitions unable to find free slot",
   "log: slot unbuffered writes",
+  "log: slots available in the slot pool",
+  "log: time spent compressing log records (usecs)",
+  "log: time spent decompressing log records (usecs)",
   "log: total in-memory size of compressed records",
   "log: total log buffer size",
   "log: total size of compressed records",
@@ -1937,6 +2046,9 @@ static const char *const __stats_connection_desc[] = {
   "prefetch: pre-fetch pages queued",
   "prefetch: pre-fetch pages read in background",
   "prefetch: pre-fetch triggered by page read",
+  "prefetch: warm restart pages no longer on disk in the tree",
+  "prefetch: warm restart pages queued",
+  "prefetch: warm restart pages recorded",
   "reconciliation: VLCS pages explicitly reconciled as empty",
   "reconciliation: approximate byte size of timestamps in pages written",
   "reconciliation: approximate byte size of transaction IDs in pages written",
@@ -2092,6 +2204,8 @@ static const char *const __stats_connection_desc[] = {
   "transaction: transaction range of timestamps pinned by the oldest timestamp",
   "transaction: transaction read timestamp of the oldest active reader",
   "transaction: transaction rollback to stable currently running",
+  "transaction: transaction snapshots copied from the snapshot cache",
+  "transaction: transaction snapshots not found in the snapshot cache",
   "transaction: transaction walk of concurrent sessions",
   "transaction: transactions committed",
   "transaction: transactions rolled back",
@@ -2167,10 +2281,16 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     stats->backup_blocks = 0;
     stats->backup_blocks_compressed = 0;
     stats->backup_blocks_uncompressed = 0;
+    stats->block_cache_admission_admitted = 0;
+    stats->block_cache_admission_rejected = 0;
+    stats->block_cache_blocks_compressed = 0;
     stats->block_cache_blocks_update = 0;
     stats->block_cache_bytes_update = 0;
+    stats->block_cache_blocks_promoted = 0;
+    /* not clearing block_cache_capacity_multiplier */
     stats->block_cache_blocks_evicted = 0;
     stats->block_cache_bypass_filesize = 0;
+    /* not clearing block_cache_hit_ratio */
     stats->block_cache_lookups = 0;
     stats->block_cache_not_evicted_overhead = 0;
     stats->block_cache_bypass_writealloc = 0;
@@ -2180,8 +2300,10 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     stats->block_cache_eviction_passes = 0;
     stats->block_cache_hits = 0;
     stats->block_cache_misses = 0;
+    stats->block_cache_bypass_bucket_full = 0;
     stats->block_cache_bypass_chkpt = 0;
     stats->block_cache_blocks_removed = 0;
+    stats->block_cache_decompress_time = 0;
     stats->block_cache_blocks_removed_blocked = 0;
     stats->block_cache_blocks = 0;
     stats->block_cache_blocks_insert_read = 0;
@@ -2192,6 +2314,7 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     stats->block_preload = 0;
     stats->block_read = 0;
     stats->block_write = 0;
+    stats->block_write_batch_blocks = 0;
     stats->block_byte_read = 0;
     stats->block_byte_read_mmap = 0;
     stats->block_byte_read_syscall = 0;
@@ -2200,6 +2323,9 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     stats->block_byte_write_checkpoint = 0;
     stats->block_byte_write_mmap = 0;
     stats->block_byte_write_syscall = 0;
+    stats->block_write_batch = 0;
+    stats->block_extlist_incremental = 0;
+    stats->block_extlist_consolidate = 0;
     stats->block_map_read = 0;
     stats->block_byte_map_read = 0;
     stats->block_remap_file_resize = 0;
@@ -2294,14 +2420,18 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     stats->cache_hazard_checks = 0;
     stats->cache_hazard_walks = 0;
     stats->cache_hazard_max = 0;
+    stats->cache_hs_bloom_build = 0;
     stats->cache_hs_insert = 0;
     stats->cache_hs_insert_restart = 0;
     /* not clearing cache_hs_ondisk_max */
     /* not clearing cache_hs_ondisk */
     stats->cache_hs_read = 0;
     stats->cache_hs_read_miss = 0;
+    stats->cache_hs_bloom_false_positive = 0;
     stats->cache_hs_read_squash = 0;
+    stats->cache_hs_bloom_skip = 0;
     stats->cache_hs_order_lose_durable_timestamp = 0;
+    stats->cache_hs_read_squash_modify = 0;
     stats->cache_hs_key_truncate_rts_unstable = 0;
     stats->cache_hs_key_truncate_rts = 0;
     stats->cache_hs_btree_truncate = 0;
@@ -2328,6 +2458,7 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     /* not clearing cache_eviction_maximum_page_size */
     stats->cache_eviction_dirty = 0;
     stats->cache_eviction_app_dirty = 0;
+    stats->cache_update_chain_consolidate_modify = 0;
     stats->cache_eviction_blocked_multi_block_reconcilation_during_checkpoint = 0;
     stats->cache_timed_out_ops = 0;
     stats->cache_eviction_blocked_overflow_keys = 0;
@@ -2363,6 +2494,7 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     stats->cache_eviction_blocked_recently_modified = 0;
     stats->cache_reverse_splits = 0;
     stats->cache_reverse_splits_skipped_vlcs = 0;
+    stats->cache_hs_insert_reverse_modify_saved = 0;
     stats->cache_hs_insert_full_update = 0;
     stats->cache_hs_insert_reverse_modify = 0;
     /* not clearing cache_reentry_hs_eviction_milliseconds */
@@ -2372,6 +2504,11 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     /* not clearing cache_pages_dirty */
     stats->cache_eviction_blocked_uncommitted_truncate = 0;
     stats->cache_eviction_clean = 0;
+    stats->cache_update_chain_lt10 = 0;
+    stats->cache_update_chain_lt100 = 0;
+    stats->cache_update_chain_lt1000 = 0;
+    stats->cache_update_chain_ge1000 = 0;
+    stats->cache_update_chain_consolidate = 0;
     stats->fsync_all_fh_total = 0;
     stats->fsync_all_fh = 0;
     /* not clearing fsync_all_time */
@@ -2381,13 +2518,16 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     stats->capacity_bytes_evict = 0;
     stats->capacity_bytes_log = 0;
     stats->capacity_bytes_written = 0;
+    /* not clearing capacity_ckpt_pace_rate */
     stats->capacity_threshold = 0;
     stats->capacity_time_total = 0;
     stats->capacity_time_ckpt = 0;
     stats->capacity_time_evict = 0;
     stats->capacity_time_log = 0;
     stats->capacity_time_read = 0;
+    stats->capacity_time_ckpt_pace = 0;
     stats->capacity_time_chunkcache = 0;
+    stats->checkpoint_flush = 0;
     stats->checkpoint_cleanup_success = 0;
     stats->checkpoint_snapshot_acquired = 0;
     stats->checkpoint_skipped = 0;
@@ -2402,6 +2542,7 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     /* not clearing checkpoint_handle_skip_duration */
     /* not clearing checkpoint_handle_meta_check_duration */
     /* not clearing checkpoint_handle_lock_duration */
+    /* not clearing checkpoint_meta_update_duration */
     stats->checkpoint_handle_applied = 0;
     stats->checkpoint_handle_dropped = 0;
     stats->checkpoint_handle_meta_checked = 0;
@@ -2416,6 +2557,7 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     stats->checkpoint_hs_pages_reconciled = 0;
     stats->checkpoint_pages_visited_internal = 0;
     stats->checkpoint_pages_visited_leaf = 0;
+    stats->checkpoint_flush_pages = 0;
     stats->checkpoint_pages_reconciled = 0;
     stats->checkpoint_cleanup_pages_evict = 0;
     stats->checkpoint_cleanup_pages_removed = 0;
@@ -2452,6 +2594,11 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     stats->chunkcache_metadata_work_units_dequeued = 0;
     stats->chunkcache_misses = 0;
     stats->chunkcache_io_failed = 0;
+    stats->chunkcache_prefetch_hits = 0;
+    stats->chunkcache_prefetch_queued = 0;
+    /* not clearing chunkcache_prefetch_queue_depth */
+    stats->chunkcache_prefetch_read = 0;
+    stats->chunkcache_prefetch_wasted = 0;
     stats->chunkcache_retries = 0;
     stats->chunkcache_retries_checksum_mismatch = 0;
     stats->chunkcache_toomany_retries = 0;
@@ -2587,17 +2734,38 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     stats->lock_txn_global_read_count = 0;
     stats->lock_txn_global_write_count = 0;
     stats->log_slot_switch_busy = 0;
+    /* not clearing log_compress_ratio */
     stats->log_force_remove_sleep = 0;
+    /* not clearing log_group_fsync_usecs */
+    /* not clearing log_group_arrival_usecs */
+    stats->log_group_latency_lt100 = 0;
+    stats->log_group_latency_lt250 = 0;
+    stats->log_group_latency_lt500 = 0;
+    stats->log_group_latency_lt1000 = 0;
+    stats->log_group_latency_lt10000 = 0;
+    stats->log_group_latency_gt10000 = 0;
+    stats->log_group_latency_total_usecs = 0;
+    stats->log_group_size_1 = 0;
+    stats->log_group_size_lt4 = 0;
+    stats->log_group_size_lt8 = 0;
+    stats->log_group_size_lt16 = 0;
+    stats->log_group_size_lt32 = 0;
+    stats->log_group_size_gt32 = 0;
+    stats->log_group_holds = 0;
+    stats->log_group_hold_usecs = 0;
     stats->log_bytes_payload = 0;
     stats->log_bytes_written = 0;
+    stats->log_compress_dict_builds = 0;
     stats->log_zero_fills = 0;
     stats->log_flush = 0;
     stats->log_force_write = 0;
     stats->log_force_write_skip = 0;
     stats->log_compress_writes = 0;
+    stats->log_compress_dict_writes = 0;
     stats->log_compress_write_fails = 0;
     stats->log_compress_small = 0;
     stats->log_release_write_lsn = 0;
+    stats->log_write_lsn_release = 0;
     stats->log_scans = 0;
     stats->log_scan_rereads = 0;
     stats->log_write_lsn = 0;
@@ -2614,6 +2782,10 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     stats->log_prealloc_files = 0;
     stats->log_prealloc_used = 0;
     stats->log_scan_records = 0;
+    /* not clearing log_slot_buffer_size */
+    stats->log_slot_buffer_shrink_pool = 0;
+    stats->log_slot_buffer_shrink_small = 0;
+    stats->log_slot_buffer_grow_unbuffered = 0;
     stats->log_slot_close_race = 0;
     stats->log_slot_close_unbuf = 0;
     stats->log_slot_closes = 0;
@@ -2627,6 +2799,9 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     /* not clearing log_slot_yield_duration */
     stats->log_slot_no_free_slots = 0;
     stats->log_slot_unbuffered = 0;
+    /* not clearing log_slot_pool_depth */
+    stats->log_compress_time = 0;
+    stats->log_decompress_time = 0;
     stats->log_compress_mem = 0;
     /* not clearing log_buffer_size */
     stats->log_compress_len = 0;
@@ -2676,6 +2851,9 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     stats->prefetch_pages_queued = 0;
     stats->prefetch_pages_read = 0;
     stats->prefetch_attempts = 0;
+    stats->prefetch_warm_pages_missing = 0;
+    stats->prefetch_warm_pages_queued = 0;
+    stats->prefetch_warm_pages_recorded = 0;
     stats->rec_vlcs_emptied_pages = 0;
     stats->rec_time_window_bytes_ts = 0;
     stats->rec_time_window_bytes_txn = 0;
@@ -2823,6 +3001,8 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     /* not clearing txn_pinned_timestamp_oldest */
     /* not clearing txn_timestamp_oldest_active_read */
     /* not clearing txn_rollback_to_stable_running */
+    stats->txn_snapshot_cached = 0;
+    stats->txn_snapshot_cache_miss = 0;
     stats->txn_walk_sessions = 0;
     stats->txn_commit = 0;
     stats->txn_rollback = 0;
@@ -2877,10 +3057,16 @@ __wt_stat_connection_aggregate(WT_CONNECTION_STATS **from, WT_CONNECTION_STATS *
     to->backup_blocks += WT_STAT_CONN_READ(from, backup_blocks);
     to->backup_blocks_compressed += WT_STAT_CONN_READ(from, backup_blocks_compressed);
     to->backup_blocks_uncompressed += WT_STAT_CONN_READ(from, backup_blocks_uncompressed);
+    to->block_cache_admission_admitted += WT_STAT_CONN_READ(from, block_cache_admission_admitted);
+    to->block_cache_admission_rejected += WT_STAT_CONN_READ(from, block_cache_admission_rejected);
+    to->block_cache_blocks_compressed += WT_STAT_CONN_READ(from, block_cache_blocks_compressed);
     to->block_cache_blocks_update += WT_STAT_CONN_READ(from, block_cache_blocks_update);
     to->block_cache_bytes_update += WT_STAT_CONN_READ(from, block_cache_bytes_update);
+    to->block_cache_blocks_promoted += WT_STAT_CONN_READ(from, block_cache_blocks_promoted);
+    to->block_cache_capacity_multiplier += WT_STAT_CONN_READ(from, block_cache_capacity_multiplier);
     to->block_cache_blocks_evicted += WT_STAT_CONN_READ(from, block_cache_blocks_evicted);
     to->block_cache_bypass_filesize += WT_STAT_CONN_READ(from, block_cache_bypass_filesize);
+    to->block_cache_hit_ratio += WT_STAT_CONN_READ(from, block_cache_hit_ratio);
     to->block_cache_lookups += WT_STAT_CONN_READ(from, block_cache_lookups);
     to->block_cache_not_evicted_overhead +=
       WT_STAT_CONN_READ(from, block_cache_not_evicted_overhead);
@@ -2891,8 +3077,10 @@ __wt_stat_connection_aggregate(WT_CONNECTION_STATS **from, WT_CONNECTION_STATS *
     to->block_cache_eviction_passes += WT_STAT_CONN_READ(from, block_cache_eviction_passes);
     to->block_cache_hits += WT_STAT_CONN_READ(from, block_cache_hits);
     to->block_cache_misses += WT_STAT_CONN_READ(from, block_cache_misses);
+    to->block_cache_bypass_bucket_full += WT_STAT_CONN_READ(from, block_cache_bypass_bucket_full);
     to->block_cache_bypass_chkpt += WT_STAT_CONN_READ(from, block_cache_bypass_chkpt);
     to->block_cache_blocks_removed += WT_STAT_CONN_READ(from, block_cache_blocks_removed);
+    to->block_cache_decompress_time += WT_STAT_CONN_READ(from, block_cache_decompress_time);
     to->block_cache_blocks_removed_blocked +=
       WT_STAT_CONN_READ(from, block_cache_blocks_removed_blocked);
     to->block_cache_blocks += WT_STAT_CONN_READ(from, block_cache_blocks);
@@ -2904,6 +3092,7 @@ __wt_stat_connection_aggregate(WT_CONNECTION_STATS **from, WT_CONNECTION_STATS *
     to->block_preload += WT_STAT_CONN_READ(from, block_preload);
     to->block_read += WT_STAT_CONN_READ(from, block_read);
     to->block_write += WT_STAT_CONN_READ(from, block_write);
+    to->block_write_batch_blocks += WT_STAT_CONN_READ(from, block_write_batch_blocks);
     to->block_byte_read += WT_STAT_CONN_READ(from, block_byte_read);
     to->block_byte_read_mmap += WT_STAT_CONN_READ(from, block_byte_read_mmap);
     to->block_byte_read_syscall += WT_STAT_CONN_READ(from, block_byte_read_syscall);
@@ -2912,6 +3101,9 @@ __wt_stat_connection_aggregate(WT_CONNECTION_STATS **from, WT_CONNECTION_STATS *
     to->block_byte_write_checkpoint += WT_STAT_CONN_READ(from, block_byte_write_checkpoint);
     to->block_byte_write_mmap += WT_STAT_CONN_READ(from, block_byte_write_mmap);
     to->block_byte_write_syscall += WT_STAT_CONN_READ(from, block_byte_write_syscall);
+    to->block_write_batch += WT_STAT_CONN_READ(from, block_write_batch);
+    to->block_extlist_incremental += WT_STAT_CONN_READ(from, block_extlist_incremental);
+    to->block_extlist_consolidate += WT_STAT_CONN_READ(from, block_extlist_consolidate);
     to->block_map_read += WT_STAT_CONN_READ(from, block_map_read);
     to->block_byte_map_read += WT_STAT_CONN_READ(from, block_byte_map_read);
     to->block_remap_file_resize += WT_STAT_CONN_READ(from, block_remap_file_resize);
@@ -3039,15 +3231,19 @@ __wt_stat_connection_aggregate(WT_CONNECTION_STATS **from, WT_CONNECTION_STATS *
     to->cache_hazard_walks += WT_STAT_CONN_READ(from, cache_hazard_walks);
     if ((v = WT_STAT_CONN_READ(from, cache_hazard_max)) > to->cache_hazard_max)
         to->cache_hazard_max = v;
+    to->cache_hs_bloom_build += WT_STAT_CONN_READ(from, cache_hs_bloom_build);
     to->cache_hs_insert += WT_STAT_CONN_READ(from, cache_hs_insert);
     to->cache_hs_insert_restart += WT_STAT_CONN_READ(from, cache_hs_insert_restart);
     to->cache_hs_ondisk_max += WT_STAT_CONN_READ(from, cache_hs_ondisk_max);
     to->cache_hs_ondisk += WT_STAT_CONN_READ(from, cache_hs_ondisk);
     to->cache_hs_read += WT_STAT_CONN_READ(from, cache_hs_read);
     to->cache_hs_read_miss += WT_STAT_CONN_READ(from, cache_hs_read_miss);
+    to->cache_hs_bloom_false_positive += WT_STAT_CONN_READ(from, cache_hs_bloom_false_positive);
     to->cache_hs_read_squash += WT_STAT_CONN_READ(from, cache_hs_read_squash);
+    to->cache_hs_bloom_skip += WT_STAT_CONN_READ(from, cache_hs_bloom_skip);
     to->cache_hs_order_lose_durable_timestamp +=
       WT_STAT_CONN_READ(from, cache_hs_order_lose_durable_timestamp);
+    to->cache_hs_read_squash_modify += WT_STAT_CONN_READ(from, cache_hs_read_squash_modify);
     to->cache_hs_key_truncate_rts_unstable +=
       WT_STAT_CONN_READ(from, cache_hs_key_truncate_rts_unstable);
     to->cache_hs_key_truncate_rts += WT_STAT_CONN_READ(from, cache_hs_key_truncate_rts);
@@ -3085,6 +3281,8 @@ __wt_stat_connection_aggregate(WT_CONNECTION_STATS **from, WT_CONNECTION_STATS *
       WT_STAT_CONN_READ(from, cache_eviction_maximum_page_size);
     to->cache_eviction_dirty += WT_STAT_CONN_READ(from, cache_eviction_dirty);
     to->cache_eviction_app_dirty += WT_STAT_CONN_READ(from, cache_eviction_app_dirty);
+    to->cache_update_chain_consolidate_modify +=
+      WT_STAT_CONN_READ(from, cache_update_chain_consolidate_modify);
     to->cache_eviction_blocked_multi_block_reconcilation_during_checkpoint +=
       WT_STAT_CONN_READ(from, cache_eviction_blocked_multi_block_reconcilation_during_checkpoint);
     to->cache_timed_out_ops += WT_STAT_CONN_READ(from, cache_timed_out_ops);
@@ -3134,6 +3332,8 @@ __wt_stat_connection_aggregate(WT_CONNECTION_STATS **from, WT_CONNECTION_STATS *
     to->cache_reverse_splits += WT_STAT_CONN_READ(from, cache_reverse_splits);
     to->cache_reverse_splits_skipped_vlcs +=
       WT_STAT_CONN_READ(from, cache_reverse_splits_skipped_vlcs);
+    to->cache_hs_insert_reverse_modify_saved +=
+      WT_STAT_CONN_READ(from, cache_hs_insert_reverse_modify_saved);
     to->cache_hs_insert_full_update += WT_STAT_CONN_READ(from, cache_hs_insert_full_update);
     to->cache_hs_insert_reverse_modify += WT_STAT_CONN_READ(from, cache_hs_insert_reverse_modify);
     to->cache_reentry_hs_eviction_milliseconds +=
@@ -3145,6 +3345,11 @@ __wt_stat_connection_aggregate(WT_CONNECTION_STATS **from, WT_CONNECTION_STATS *
     to->cache_eviction_blocked_uncommitted_truncate +=
       WT_STAT_CONN_READ(from, cache_eviction_blocked_uncommitted_truncate);
     to->cache_eviction_clean += WT_STAT_CONN_READ(from, cache_eviction_clean);
+    to->cache_update_chain_lt10 += WT_STAT_CONN_READ(from, cache_update_chain_lt10);
+    to->cache_update_chain_lt100 += WT_STAT_CONN_READ(from, cache_update_chain_lt100);
+    to->cache_update_chain_lt1000 += WT_STAT_CONN_READ(from, cache_update_chain_lt1000);
+    to->cache_update_chain_ge1000 += WT_STAT_CONN_READ(from, cache_update_chain_ge1000);
+    to->cache_update_chain_consolidate += WT_STAT_CONN_READ(from, cache_update_chain_consolidate);
     to->fsync_all_fh_total += WT_STAT_CONN_READ(from, fsync_all_fh_total);
     to->fsync_all_fh += WT_STAT_CONN_READ(from, fsync_all_fh);
     to->fsync_all_time += WT_STAT_CONN_READ(from, fsync_all_time);
@@ -3154,13 +3359,16 @@ __wt_stat_connection_aggregate(WT_CONNECTION_STATS **from, WT_CONNECTION_STATS *
     to->capacity_bytes_evict += WT_STAT_CONN_READ(from, capacity_bytes_evict);
     to->capacity_bytes_log += WT_STAT_CONN_READ(from, capacity_bytes_log);
     to->capacity_bytes_written += WT_STAT_CONN_READ(from, capacity_bytes_written);
+    to->capacity_ckpt_pace_rate += WT_STAT_CONN_READ(from, capacity_ckpt_pace_rate);
     to->capacity_threshold += WT_STAT_CONN_READ(from, capacity_threshold);
     to->capacity_time_total += WT_STAT_CONN_READ(from, capacity_time_total);
     to->capacity_time_ckpt += WT_STAT_CONN_READ(from, capacity_time_ckpt);
     to->capacity_time_evict += WT_STAT_CONN_READ(from, capacity_time_evict);
     to->capacity_time_log += WT_STAT_CONN_READ(from, capacity_time_log);
     to->capacity_time_read += WT_STAT_CONN_READ(from, capacity_time_read);
+    to->capacity_time_ckpt_pace += WT_STAT_CONN_READ(from, capacity_time_ckpt_pace);
     to->capacity_time_chunkcache += WT_STAT_CONN_READ(from, capacity_time_chunkcache);
+    to->checkpoint_flush += WT_STAT_CONN_READ(from, checkpoint_flush);
     to->checkpoint_cleanup_success += WT_STAT_CONN_READ(from, checkpoint_cleanup_success);
     to->checkpoint_snapshot_acquired += WT_STAT_CONN_READ(from, checkpoint_snapshot_acquired);
     to->checkpoint_skipped += WT_STAT_CONN_READ(from, checkpoint_skipped);
@@ -3177,6 +3385,7 @@ __wt_stat_connection_aggregate(WT_CONNECTION_STATS **from, WT_CONNECTION_STATS *
     to->checkpoint_handle_meta_check_duration +=
       WT_STAT_CONN_READ(from, checkpoint_handle_meta_check_duration);
     to->checkpoint_handle_lock_duration += WT_STAT_CONN_READ(from, checkpoint_handle_lock_duration);
+    to->checkpoint_meta_update_duration += WT_STAT_CONN_READ(from, checkpoint_meta_update_duration);
     to->checkpoint_handle_applied += WT_STAT_CONN_READ(from, checkpoint_handle_applied);
     to->checkpoint_handle_dropped += WT_STAT_CONN_READ(from, checkpoint_handle_dropped);
     to->checkpoint_handle_meta_checked += WT_STAT_CONN_READ(from, checkpoint_handle_meta_checked);
@@ -3192,6 +3401,7 @@ __wt_stat_connection_aggregate(WT_CONNECTION_STATS **from, WT_CONNECTION_STATS *
     to->checkpoint_pages_visited_internal +=
       WT_STAT_CONN_READ(from, checkpoint_pages_visited_internal);
     to->checkpoint_pages_visited_leaf += WT_STAT_CONN_READ(from, checkpoint_pages_visited_leaf);
+    to->checkpoint_flush_pages += WT_STAT_CONN_READ(from, checkpoint_flush_pages);
     to->checkpoint_pages_reconciled += WT_STAT_CONN_READ(from, checkpoint_pages_reconciled);
     to->checkpoint_cleanup_pages_evict += WT_STAT_CONN_READ(from, checkpoint_cleanup_pages_evict);
     to->checkpoint_cleanup_pages_removed +=
@@ -3236,6 +3446,11 @@ __wt_stat_connection_aggregate(WT_CONNECTION_STATS **from, WT_CONNECTION_STATS *
       WT_STAT_CONN_READ(from, chunkcache_metadata_work_units_dequeued);
     to->chunkcache_misses += WT_STAT_CONN_READ(from, chunkcache_misses);
     to->chunkcache_io_failed += WT_STAT_CONN_READ(from, chunkcache_io_failed);
+    to->chunkcache_prefetch_hits += WT_STAT_CONN_READ(from, chunkcache_prefetch_hits);
+    to->chunkcache_prefetch_queued += WT_STAT_CONN_READ(from, chunkcache_prefetch_queued);
+    to->chunkcache_prefetch_queue_depth += WT_STAT_CONN_READ(from, chunkcache_prefetch_queue_depth);
+    to->chunkcache_prefetch_read += WT_STAT_CONN_READ(from, chunkcache_prefetch_read);
+    to->chunkcache_prefetch_wasted += WT_STAT_CONN_READ(from, chunkcache_prefetch_wasted);
     to->chunkcache_retries += WT_STAT_CONN_READ(from, chunkcache_retries);
     to->chunkcache_retries_checksum_mismatch +=
       WT_STAT_CONN_READ(from, chunkcache_retries_checksum_mismatch);
@@ -3380,17 +3595,38 @@ __wt_stat_connection_aggregate(WT_CONNECTION_STATS **from, WT_CONNECTION_STATS *
     to->lock_txn_global_read_count += WT_STAT_CONN_READ(from, lock_txn_global_read_count);
     to->lock_txn_global_write_count += WT_STAT_CONN_READ(from, lock_txn_global_write_count);
     to->log_slot_switch_busy += WT_STAT_CONN_READ(from, log_slot_switch_busy);
+    to->log_compress_ratio += WT_STAT_CONN_READ(from, log_compress_ratio);
     to->log_force_remove_sleep += WT_STAT_CONN_READ(from, log_force_remove_sleep);
+    to->log_group_fsync_usecs += WT_STAT_CONN_READ(from, log_group_fsync_usecs);
+    to->log_group_arrival_usecs += WT_STAT_CONN_READ(from, log_group_arrival_usecs);
+    to->log_group_latency_lt100 += WT_STAT_CONN_READ(from, log_group_latency_lt100);
+    to->log_group_latency_lt250 += WT_STAT_CONN_READ(from, log_group_latency_lt250);
+    to->log_group_latency_lt500 += WT_STAT_CONN_READ(from, log_group_latency_lt500);
+    to->log_group_latency_lt1000 += WT_STAT_CONN_READ(from, log_group_latency_lt1000);
+    to->log_group_latency_lt10000 += WT_STAT_CONN_READ(from, log_group_latency_lt10000);
+    to->log_group_latency_gt10000 += WT_STAT_CONN_READ(from, log_group_latency_gt10000);
+    to->log_group_latency_total_usecs += WT_STAT_CONN_READ(from, log_group_latency_total_usecs);
+    to->log_group_size_1 += WT_STAT_CONN_READ(from, log_group_size_1);
+    to->log_group_size_lt4 += WT_STAT_CONN_READ(from, log_group_size_lt4);
+    to->log_group_size_lt8 += WT_STAT_CONN_READ(from, log_group_size_lt8);
+    to->log_group_size_lt16 += WT_STAT_CONN_READ(from, log_group_size_lt16);
+    to->log_group_size_lt32 += WT_STAT_CONN_READ(from, log_group_size_lt32);
+    to->log_group_size_gt32 += WT_STAT_CONN_READ(from, log_group_size_gt32);
+    to->log_group_holds += WT_STAT_CONN_READ(from, log_group_holds);
+    to->log_group_hold_usecs += WT_STAT_CONN_READ(from, log_group_hold_usecs);
     to->log_bytes_payload += WT_STAT_CONN_READ(from, log_bytes_payload);
     to->log_bytes_written += WT_STAT_CONN_READ(from, log_bytes_written);
+    to->log_compress_dict_builds += WT_STAT_CONN_READ(from, log_compress_dict_builds);
     to->log_zero_fills += WT_STAT_CONN_READ(from, log_zero_fills);
     to->log_flush += WT_STAT_CONN_READ(from, log_flush);
     to->log_force_write += WT_STAT_CONN_READ(from, log_force_write);
     to->log_force_write_skip += WT_STAT_CONN_READ(from, log_force_write_skip);
     to->log_compress_writes += WT_STAT_CONN_READ(from, log_compress_writes);
+    to->log_compress_dict_writes += WT_STAT_CONN_READ(from, log_compress_dict_writes);
     to->log_compress_write_fails += WT_STAT_CONN_READ(from, log_compress_write_fails);
     to->log_compress_small += WT_STAT_CONN_READ(from, log_compress_small);
     to->log_release_write_lsn += WT_STAT_CONN_READ(from, log_release_write_lsn);
+    to->log_write_lsn_release += WT_STAT_CONN_READ(from, log_write_lsn_release);
     to->log_scans += WT_STAT_CONN_READ(from, log_scans);
     to->log_scan_rereads += WT_STAT_CONN_READ(from, log_scan_rereads);
     to->log_write_lsn += WT_STAT_CONN_READ(from, log_write_lsn);
@@ -3407,6 +3643,10 @@ __wt_stat_connection_aggregate(WT_CONNECTION_STATS **from, WT_CONNECTION_STATS *
     to->log_prealloc_files += WT_STAT_CONN_READ(from, log_prealloc_files);
     to->log_prealloc_used += WT_STAT_CONN_READ(from, log_prealloc_used);
     to->log_scan_records += WT_STAT_CONN_READ(from, log_scan_records);
+    to->log_slot_buffer_size += WT_STAT_CONN_READ(from, log_slot_buffer_size);
+    to->log_slot_buffer_shrink_pool += WT_STAT_CONN_READ(from, log_slot_buffer_shrink_pool);
+    to->log_slot_buffer_shrink_small += WT_STAT_CONN_READ(from, log_slot_buffer_shrink_small);
+    to->log_slot_buffer_grow_unbuffered += WT_STAT_CONN_READ(from, log_slot_buffer_grow_unbuffered);
     to->log_slot_close_race += WT_STAT_CONN_READ(from, log_slot_close_race);
     to->log_slot_close_unbuf += WT_STAT_CONN_READ(from, log_slot_close_unbuf);
     to->log_slot_closes += WT_STAT_CONN_READ(from, log_slot_closes);
@@ -3420,6 +3660,9 @@ __wt_stat_connection_aggregate(WT_CONNECTION_STATS **from, WT_CONNECTION_STATS *
     to->log_slot_yield_duration += WT_STAT_CONN_READ(from, log_slot_yield_duration);
     to->log_slot_no_free_slots += WT_STAT_CONN_READ(from, log_slot_no_free_slots);
     to->log_slot_unbuffered += WT_STAT_CONN_READ(from, log_slot_unbuffered);
+    to->log_slot_pool_depth += WT_STAT_CONN_READ(from, log_slot_pool_depth);
+    to->log_compress_time += WT_STAT_CONN_READ(from, log_compress_time);
+    to->log_decompress_time += WT_STAT_CONN_READ(from, log_decompress_time);
     to->log_compress_mem += WT_STAT_CONN_READ(from, log_compress_mem);
     to->log_buffer_size += WT_STAT_CONN_READ(from, log_buffer_size);
     to->log_compress_len += WT_STAT_CONN_READ(from, log_compress_len);
@@ -3483,6 +3726,9 @@ __wt_stat_connection_aggregate(WT_CONNECTION_STATS **from, WT_CONNECTION_STATS *
     to->prefetch_pages_queued += WT_STAT_CONN_READ(from, prefetch_pages_queued);
     to->prefetch_pages_read += WT_STAT_CONN_READ(from, prefetch_pages_read);
     to->prefetch_attempts += WT_STAT_CONN_READ(from, prefetch_attempts);
+    to->prefetch_warm_pages_missing += WT_STAT_CONN_READ(from, prefetch_warm_pages_missing);
+    to->prefetch_warm_pages_queued += WT_STAT_CONN_READ(from, prefetch_warm_pages_queued);
+    to->prefetch_warm_pages_recorded += WT_STAT_CONN_READ(from, prefetch_warm_pages_recorded);
     to->rec_vlcs_emptied_pages += WT_STAT_CONN_READ(from, rec_vlcs_emptied_pages);
     to->rec_time_window_bytes_ts += WT_STAT_CONN_READ(from, rec_time_window_bytes_ts);
     to->rec_time_window_bytes_txn += WT_STAT_CONN_READ(from, rec_time_window_bytes_txn);
@@ -3650,6 +3896,8 @@ __wt_stat_connection_aggregate(WT_CONNECTION_STATS **from, WT_CONNECTION_STATS *
     to->txn_timestamp_oldest_active_read +=
       WT_STAT_CONN_READ(from, txn_timestamp_oldest_active_read);
     to->txn_rollback_to_stable_running += WT_STAT_CONN_READ(from, txn_rollback_to_stable_running);
+    to->txn_snapshot_cached += WT_STAT_CONN_READ(from, txn_snapshot_cached);
+    to->txn_snapshot_cache_miss += WT_STAT_CONN_READ(from, txn_snapshot_cache_miss);
     to->txn_walk_sessions += WT_STAT_CONN_READ(from, txn_walk_sessions);
     to->txn_commit += WT_STAT_CONN_READ(from, txn_commit);
     to->txn_rollback += WT_STAT_CONN_READ(from, txn_rollback);
@@ -86,6 +86,9 @@ __txn_remove_from_global_table(WT_SESSION_IMPL *session)
     txn_shared = WT_SESSION_TXN_SHARED(session);
 #endif
     WT_RELEASE_WRITE_WITH_BARRIER(txn_shared->id, WT_TXN_NONE);
+
+    /* The set of running transactions has changed, invalidate the cached snapshot. */
+    (void)__wt_atomic_addv64(&S2C(session)->txn_global.commit_seq, 1);
 }
 
 /*
@@ -111,6 +114,122 @@ __txn_sort_snapshot(WT_SESSION_IMPL *session, uint32_t n, uint64_t snap_max)
     WT_ASSERT(session, n == 0 || txn->snapshot_data.snap_min != WT_TXN_NONE);
 }
 
+/*
+ * __txn_snapshot_cache_get --
+ *     Copy the cached snapshot if the set of running transactions hasn't changed since it was
+ *     built, publishing our pinned IDs.
+ */
+static bool
+__txn_snapshot_cache_get(WT_SESSION_IMPL *session)
+{
+    WT_TXN *txn;
+    WT_TXN_GLOBAL *txn_global;
+    WT_TXN_SHARED *txn_shared;
+    uint64_t commit_seq, current_id, metadata_pinned, pinned_id, version;
+    uint32_t n;
+
+    txn = session->txn;
+    txn_global = &S2C(session)->txn_global;
+    txn_shared = WT_SESSION_TXN_SHARED(session);
+
+    WT_ACQUIRE_READ_WITH_BARRIER(version, txn_global->snapshot_cache.version);
+    if (version % 2 != 0)
+        return (false);
+    commit_seq = __wt_atomic_loadv64(&txn_global->commit_seq);
+    current_id = __wt_atomic_loadv64(&txn_global->current);
+    if (txn_global->snapshot_cache.commit_seq != commit_seq ||
+      txn_global->snapshot_cache.current_id != current_id)
+        return (false);
+
+    n = txn_global->snapshot_cache.count;
+    pinned_id = txn_global->snapshot_cache.pinned_id;
+    metadata_pinned = txn_global->snapshot_cache.metadata_pinned;
+    if (n > 0)
+        memcpy(txn->snapshot_data.snapshot, txn_global->snapshot_cache.snapshot,
+          n * sizeof(uint64_t));
+    WT_ACQUIRE_BARRIER();
+    if (__wt_atomic_loadv64(&txn_global->snapshot_cache.version) != version)
+        return (false);
+
+    /*
+     * Publish our pinned IDs, then check the set of running transactions is still the one the
+     * snapshot describes. If it is, the oldest ID in the snapshot is still running and the oldest
+     * ID can't have moved past it, so we didn't need the lock to publish.
+     */
+    if (metadata_pinned != WT_TXN_NONE)
+        __wt_atomic_storev64(&txn_shared->metadata_pinned, metadata_pinned);
+    __wt_atomic_storev64(&txn_shared->pinned_id, pinned_id);
+    WT_FULL_BARRIER();
+    if (__wt_atomic_loadv64(&txn_global->commit_seq) != commit_seq ||
+      __wt_atomic_loadv64(&txn_global->current) != current_id) {
+        __wt_atomic_storev64(&txn_shared->metadata_pinned, WT_TXN_NONE);
+        __wt_atomic_storev64(&txn_shared->pinned_id, WT_TXN_NONE);
+        return (false);
+    }
+
+    txn->snapshot_data.snapshot_count = n;
+    txn->snapshot_data.snap_max = current_id;
+    txn->snapshot_data.snap_min = n > 0 ? txn->snapshot_data.snapshot[0] : current_id;
+    F_SET(txn, WT_TXN_HAS_SNAPSHOT);
+    return (true);
+}
+
+/*
+ * __txn_snapshot_cache_set --
+ *     Cache a snapshot built while the set of running transactions didn't change. Give up if
+ *     another thread is already updating the cache.
+ */
+static void
+__txn_snapshot_cache_set(WT_SESSION_IMPL *session, uint64_t commit_seq, uint64_t pinned_id,
+  uint64_t metadata_pinned)
+{
+    WT_TXN *txn;
+    WT_TXN_GLOBAL *txn_global;
+    uint64_t version;
+    uint32_t n;
+
+    txn = session->txn;
+    txn_global = &S2C(session)->txn_global;
+
+    version = __wt_atomic_loadv64(&txn_global->snapshot_cache.version);
+    if (version % 2 != 0 ||
+      !__wt_atomic_casv64(&txn_global->snapshot_cache.version, version, version + 1))
+        return;
+
+    n = txn->snapshot_data.snapshot_count;
+    txn_global->snapshot_cache.commit_seq = commit_seq;
+    txn_global->snapshot_cache.current_id = txn->snapshot_data.snap_max;
+    txn_global->snapshot_cache.pinned_id = pinned_id;
+    txn_global->snapshot_cache.metadata_pinned = metadata_pinned;
+    txn_global->snapshot_cache.count = n;
+    if (n > 0)
+        memcpy(txn_global->snapshot_cache.snapshot, txn->snapshot_data.snapshot,
+          n * sizeof(uint64_t));
+
+    WT_RELEASE_WRITE_WITH_BARRIER(txn_global->snapshot_cache.version, version + 2);
+}
+
+/*
+ * __txn_shared_idle --
+ *     Clear the session's mark in the global active map once it has nothing published.
+ */
+static void
+__txn_shared_idle(WT_SESSION_IMPL *session)
+{
+    WT_TXN_SHARED *txn_shared;
+
+    txn_shared = WT_SESSION_TXN_SHARED(session);
+    if (!session->txn->shared_active || __wt_atomic_loadv64(&txn_shared->id) != WT_TXN_NONE ||
+      __wt_atomic_loadv64(&txn_shared->pinned_id) != WT_TXN_NONE ||
+      __wt_atomic_loadv64(&txn_shared->metadata_pinned) != WT_TXN_NONE ||
+      txn_shared->pinned_durable_timestamp != WT_TS_NONE ||
+      txn_shared->read_timestamp != WT_TS_NONE)
+        return;
+
+    __wt_atomic_store8((uint8_t *)S2C(session)->txn_global.txn_active_map + session->id, 0);
+    session->txn->shared_active = false;
+}
+
 /*
  * __wt_txn_release_snapshot --
  *     Release the snapshot in the current transaction.
@@ -145,6 +264,8 @@ __wt_txn_release_snapshot(WT_SESSION_IMPL *session)
 
     /* Leave the generation after releasing the snapshot. */
     __wt_session_gen_leave(session, WT_GEN_HAS_SNAPSHOT);
+
+    __txn_shared_idle(session);
 }
 
 /*
@@ -160,13 +281,13 @@ __wt_txn_active(WT_SESSION_IMPL *session, uint64_t txnid)
     WT_TXN_GLOBAL *txn_global;
     WT_TXN_SHARED *s;
     uint64_t oldest_id;
-    uint32_t i, session_cnt;
+    uint32_t i, session_cnt, walked;
     bool active;
 
     conn = S2C(session);
     txn_global = &conn->txn_global;
     active = true;
-    i = 0;
+    walked = 0;
 
     /* We're going to scan the table: wait for the lock. */
     __wt_readlock(session, &txn_global->rwlock);
@@ -180,8 +301,10 @@ __wt_txn_active(WT_SESSION_IMPL *session, uint64_t txnid)
     /* Walk the array of concurrent transactions. */
     WT_ACQUIRE_READ_WITH_BARRIER(session_cnt, conn->session_array.cnt);
     WT_STAT_CONN_INCR(session, txn_walk_sessions);
-    for (i = 0, s = txn_global->txn_shared_list; i < session_cnt; i++, s++) {
+    for (i = __wt_txn_shared_next(session, 0, session_cnt); i < session_cnt;
+         i = __wt_txn_shared_next(session, i + 1, session_cnt), ++walked) {
         /* If the transaction is in the list, it is uncommitted. */
+        s = &txn_global->txn_shared_list[i];
         if (__wt_atomic_loadv64(&s->id) == txnid)
             goto done;
     }
@@ -189,7 +312,7 @@ __wt_txn_active(WT_SESSION_IMPL *session, uint64_t txnid)
     active = false;
 done:
     /* We increment this stat here as the loop traversal can exit using a goto. */
-    WT_STAT_CONN_INCRV(session, txn_sessions_walked, i);
+    WT_STAT_CONN_INCRV(session, txn_sessions_walked, walked);
     __wt_readunlock(session, &txn_global->rwlock);
     return (active);
 }
@@ -205,14 +328,16 @@ __txn_get_snapshot_int(WT_SESSION_IMPL *session, bool update_shared_state)
     WT_TXN *txn;
     WT_TXN_GLOBAL *txn_global;
     WT_TXN_SHARED *s, *txn_shared;
-    uint64_t current_id, id, pinned_id, prev_oldest_id, snapshot_gen;
-    uint32_t i, n, session_cnt;
+    uint64_t commit_seq, current_id, id, metadata_pinned, pinned_id, prev_oldest_id, snapshot_gen;
+    uint32_t i, n, session_cnt, walked;
+    bool use_cache;
 
     conn = S2C(session);
     txn = session->txn;
     txn_global = &conn->txn_global;
     txn_shared = WT_SESSION_TXN_SHARED(session);
-    n = 0;
+    metadata_pinned = WT_TXN_NONE;
+    n = walked = 0;
 
     /* Fast path if we already have the current snapshot. */
     if ((snapshot_gen = __wt_session_gen(session, WT_GEN_HAS_SNAPSHOT)) != 0) {
@@ -226,10 +351,28 @@ __txn_get_snapshot_int(WT_SESSION_IMPL *session, bool update_shared_state)
         __wt_session_gen_leave(session, WT_GEN_HAS_SNAPSHOT);
     }
     __wt_session_gen_enter(session, WT_GEN_HAS_SNAPSHOT);
+    if (update_shared_state)
+        __wt_txn_shared_active(session);
+
+    /*
+     * Readers without a transaction ID all build the same snapshot until the set of running
+     * transactions changes: try the cached copy first. Checkpoints have their own rules for the
+     * pinned IDs they publish, leave them to the scan.
+     */
+    use_cache =
+      update_shared_state && txn->id == WT_TXN_NONE && !WT_SESSION_IS_CHECKPOINT(session);
+    if (use_cache) {
+        if (__txn_snapshot_cache_get(session)) {
+            WT_STAT_CONN_INCR(session, txn_snapshot_cached);
+            return;
+        }
+        WT_STAT_CONN_INCR(session, txn_snapshot_cache_miss);
+    }
 
     /* We're going to scan the table: wait for the lock. */
     __wt_readlock(session, &txn_global->rwlock);
 
+    commit_seq = __wt_atomic_loadv64(&txn_global->commit_seq);
     current_id = pinned_id = __wt_atomic_loadv64(&txn_global->current);
     prev_oldest_id = __wt_atomic_loadv64(&txn_global->oldest_id);
 
@@ -246,6 +389,7 @@ __txn_get_snapshot_int(WT_SESSION_IMPL *session, bool update_shared_state)
             txn->snapshot_data.snapshot[n++] = id;
         if (update_shared_state)
             __wt_atomic_storev64(&txn_shared->metadata_pinned, id);
+        metadata_pinned = id;
     }
 
     /* For pure read-only workloads, avoid scanning. */
@@ -259,7 +403,10 @@ __txn_get_snapshot_int(WT_SESSION_IMPL *session, bool update_shared_state)
     /* Walk the array of concurrent transactions. */
     WT_ACQUIRE_READ_WITH_BARRIER(session_cnt, conn->session_array.cnt);
     WT_STAT_CONN_INCR(session, txn_walk_sessions);
-    for (i = 0, s = txn_global->txn_shared_list; i < session_cnt; i++, s++) {
+    for (i = __wt_txn_shared_next(session, 0, session_cnt); i < session_cnt;
+         i = __wt_txn_shared_next(session, i + 1, session_cnt), ++walked) {
+        s = &txn_global->txn_shared_list[i];
+
         /*
          * Build our snapshot of any concurrent transaction IDs.
          *
@@ -299,7 +446,7 @@ __txn_get_snapshot_int(WT_SESSION_IMPL *session, bool update_shared_state)
             WT_PAUSE();
         }
     }
-    WT_STAT_CONN_INCRV(session, txn_sessions_walked, i);
+    WT_STAT_CONN_INCRV(session, txn_sessions_walked, walked);
 
     /*
      * If we got a new snapshot, update the published pinned ID for this session.
@@ -311,6 +458,10 @@ done:
         __wt_atomic_storev64(&txn_shared->pinned_id, pinned_id);
     __wt_readunlock(session, &txn_global->rwlock);
     __txn_sort_snapshot(session, n, current_id);
+
+    /* If no transaction ID left the table while we were scanning, share the snapshot. */
+    if (use_cache && __wt_atomic_loadv64(&txn_global->commit_seq) == commit_seq)
+        __txn_snapshot_cache_set(session, commit_seq, pinned_id, metadata_pinned);
 }
 
 /*
@@ -405,11 +556,12 @@ __txn_oldest_scan(WT_SESSION_IMPL *session, uint64_t *oldest_idp, uint64_t *last
     WT_TXN_GLOBAL *txn_global;
     WT_TXN_SHARED *s;
     uint64_t id, last_running, metadata_pinned, oldest_id, prev_oldest_id;
-    uint32_t i, session_cnt;
+    uint32_t i, session_cnt, walked;
 
     conn = S2C(session);
     txn_global = &conn->txn_global;
     oldest_session = NULL;
+    walked = 0;
 
     /* The oldest ID cannot change while we are holding the scan lock. */
     prev_oldest_id = __wt_atomic_loadv64(&txn_global->oldest_id);
@@ -421,7 +573,10 @@ __txn_oldest_scan(WT_SESSION_IMPL *session, uint64_t *oldest_idp, uint64_t *last
     /* Walk the array of concurrent transactions. */
     WT_ACQUIRE_READ_WITH_BARRIER(session_cnt, conn->session_array.cnt);
     WT_STAT_CONN_INCR(session, txn_walk_sessions);
-    for (i = 0, s = txn_global->txn_shared_list; i < session_cnt; i++, s++) {
+    for (i = __wt_txn_shared_next(session, 0, session_cnt); i < session_cnt;
+         i = __wt_txn_shared_next(session, i + 1, session_cnt), ++walked) {
+        s = &txn_global->txn_shared_list[i];
+
         /* Update the last running transaction ID. */
         while ((id = __wt_atomic_loadv64(&s->id)) != WT_TXN_NONE &&
           WT_TXNID_LE(prev_oldest_id, id) && WT_TXNID_LT(id, last_running)) {
@@ -465,7 +620,7 @@ __txn_oldest_scan(WT_SESSION_IMPL *session, uint64_t *oldest_idp, uint64_t *last
             oldest_session = &WT_CONN_SESSIONS_GET(conn)[i];
         }
     }
-    WT_STAT_CONN_INCRV(session, txn_sessions_walked, i);
+    WT_STAT_CONN_INCRV(session, txn_sessions_walked, walked);
 
     if (WT_TXNID_LT(last_running, oldest_id))
         oldest_id = last_running;
@@ -780,6 +935,7 @@ __wt_txn_release(WT_SESSION_IMPL *session)
         WT_ASSERT(session, __wt_atomic_loadv64(&WT_SESSION_TXN_SHARED(session)->id) == WT_TXN_NONE);
         txn->id = WT_TXN_NONE;
         __wt_atomic_storev64(&txn_global->checkpoint_txn_shared.id, WT_TXN_NONE);
+        (void)__wt_atomic_addv64(&txn_global->commit_seq, 1);
 
         /*
          * Be extra careful to cleanup everything for checkpoints: once the global checkpoint ID is
@@ -828,6 +984,8 @@ __wt_txn_release(WT_SESSION_IMPL *session)
 
     /* Clear operation timer. */
     txn->operation_timeout_us = 0;
+
+    __txn_shared_idle(session);
 }
 
 /*
@@ -1446,7 +1604,7 @@ __txn_resolve_prepared_op(WT_SESSION_IMPL *session, WT_TXN_OP *op, bool commit,
          * Open a history store table cursor and scan the history store for the given btree and key
          * with maximum start timestamp to let the search point to the last version of the key.
          */
-        WT_ERR(__wt_curhs_open(session, NULL, &hs_cursor));
+        WT_ERR(__wt_curhs_open(session, btree->hs_id, NULL, &hs_cursor));
         F_SET(hs_cursor, WT_CURSTD_HS_READ_COMMITTED);
         if (btree->type == BTREE_ROW)
             hs_cursor->set_key(hs_cursor, 4, btree->id, &cbt->iface.key, WT_TS_MAX, UINT64_MAX);
@@ -1703,7 +1861,6 @@ int
 __wt_txn_commit(WT_SESSION_IMPL *session, const char *cfg[])
 {
     struct timespec tsp;
-    WT_CACHE *cache;
     WT_CONFIG_ITEM cval;
     WT_CONNECTION_IMPL *conn;
     WT_CURSOR *cursor;
@@ -1721,7 +1878,6 @@ __wt_txn_commit(WT_SESSION_IMPL *session, const char *cfg[])
     bool cannot_fail, locked, prepare, readonly, update_durable_ts;
 
     conn = S2C(session);
-    cache = conn->cache;
     cursor = NULL;
     txn = session->txn;
     txn_global = &conn->txn_global;
@@ -1859,7 +2015,7 @@ __wt_txn_commit(WT_SESSION_IMPL *session, const char *cfg[])
                  * transaction timestamp. Those records should already have the original time window
                  * when they are inserted into the history store.
                  */
-                if (cache->hs_fileid != 0 && op->btree->id == cache->hs_fileid)
+                if (WT_IS_HS(op->btree->dhandle))
                     break;
 
                 __wt_txn_op_set_timestamp(session, op);
@@ -2263,8 +2419,7 @@ __wt_txn_rollback(WT_SESSION_IMPL *session, const char *cfg[])
             upd = op->u.op_upd;
 
             if (!prepare) {
-                if (S2C(session)->cache->hs_fileid != 0 &&
-                  op->btree->id == S2C(session)->cache->hs_fileid)
+                if (WT_IS_HS(op->btree->dhandle))
                     break;
                 WT_ASSERT(session, upd->txnid == txn->id || upd->txnid == WT_TXN_ABORTED);
                 upd->txnid = WT_TXN_ABORTED;
@@ -2585,6 +2740,10 @@ __wt_txn_global_init(WT_SESSION_IMPL *session, const char *cfg[])
     WT_RET(__wt_rwlock_init(session, &txn_global->visibility_rwlock));
 
     WT_RET(__wt_calloc_def(session, conn->session_array.size, &txn_global->txn_shared_list));
+    WT_RET(
+      __wt_calloc_def(session, conn->session_array.size, &txn_global->snapshot_cache.snapshot));
+    WT_RET(
+      __wt_calloc_def(session, (conn->session_array.size + 7) / 8, &txn_global->txn_active_map));
 
     for (i = 0, s = txn_global->txn_shared_list; i < conn->session_array.size; i++, s++) {
         __wt_atomic_storev64(&s->id, WT_TXN_NONE);
@@ -2614,6 +2773,8 @@ __wt_txn_global_destroy(WT_SESSION_IMPL *session)
     __wt_rwlock_destroy(session, &txn_global->rwlock);
     __wt_rwlock_destroy(session, &txn_global->visibility_rwlock);
     __wt_free(session, txn_global->txn_shared_list);
+    __wt_free(session, txn_global->snapshot_cache.snapshot);
+    __wt_free(session, txn_global->txn_active_map);
 }
 
 /*
@@ -412,6 +412,31 @@ __checkpoint_data_source(WT_SESSION_IMPL *session, const char *cfg[])
     return (0);
 }
 
+/*
+ * __checkpoint_get_hs_handle --
+ *     Add the history store of an individual file to the list of history stores to checkpoint.
+ */
+static int
+__checkpoint_get_hs_handle(WT_SESSION_IMPL *session, const char *uri)
+{
+    WT_DECL_RET;
+    u_int i;
+
+    for (i = 0; i < session->ckpt_hs_handle_next; ++i)
+        if (strcmp(session->ckpt_hs_handle[i]->name, uri) == 0)
+            return (0);
+
+    WT_RET(__wt_realloc_def(session, &session->ckpt_hs_handle_allocated,
+      session->ckpt_hs_handle_next + 1, &session->ckpt_hs_handle));
+
+    session->dhandle = NULL;
+    if ((ret = __wt_session_get_dhandle(session, uri, NULL, NULL, 0)) != 0)
+        return (ret == EBUSY ? 0 : ret);
+
+    session->ckpt_hs_handle[session->ckpt_hs_handle_next++] = session->dhandle;
+    return (0);
+}
+
 /*
  * __wt_checkpoint_get_handles --
  *     Get a list of handles to flush.
@@ -424,6 +449,7 @@ __wt_checkpoint_get_handles(WT_SESSION_IMPL *session, const char *cfg[])
     WT_DECL_RET;
     uint64_t time_diff, time_start, time_stop;
     const char *name;
+    char hs_uri[WT_HS_URI_SIZE];
     bool force;
 
     /* Periodically log checkpoint prepare progress. */
@@ -443,11 +469,22 @@ __wt_checkpoint_get_handles(WT_SESSION_IMPL *session, const char *cfg[])
     btree = S2BT(session);
 
     /*
-     * Skip files that are never involved in a checkpoint. Skip the history store file as it is,
-     * checkpointed manually later.
+     * Skip files that are never involved in a checkpoint. Skip the history store files as they are
+     * checkpointed manually later, gathering the history stores of individual files as we go.
      */
-    if (F_ISSET(btree, WT_BTREE_NO_CHECKPOINT) || WT_IS_HS(btree->dhandle))
+    if (F_ISSET(btree, WT_BTREE_NO_CHECKPOINT))
         return (0);
+    if (WT_IS_HS(btree->dhandle)) {
+        name = btree->dhandle->name;
+        if (strcmp(name, WT_HS_URI) != 0)
+            WT_SAVE_DHANDLE(session, ret = __checkpoint_get_hs_handle(session, name));
+        return (ret);
+    }
+    if (btree->hs_id != 0) {
+        WT_RET(__wt_hs_uri(btree->hs_id, hs_uri, sizeof(hs_uri)));
+        WT_SAVE_DHANDLE(session, ret = __checkpoint_get_hs_handle(session, hs_uri));
+        WT_RET(ret);
+    }
 
     /*
      * We may have raced between starting the checkpoint transaction and some operation completing
@@ -842,6 +879,7 @@ __checkpoint_prepare(WT_SESSION_IMPL *session, bool *trackingp, const char *cfg[
     __wt_atomic_storev64(&txn_shared->id, WT_TXN_NONE);
     __wt_atomic_storev64(&txn_shared->pinned_id, WT_TXN_NONE);
     __wt_atomic_storev64(&txn_shared->metadata_pinned, WT_TXN_NONE);
+    (void)__wt_atomic_addv64(&txn_global->commit_seq, 1);
 
     /*
      * Set the checkpoint transaction's timestamp, if requested.
@@ -1112,8 +1150,8 @@ __txn_checkpoint(WT_SESSION_IMPL *session, const char *cfg[])
     wt_timestamp_t ckpt_tmp_ts;
     size_t namelen;
     uint64_t ckpt_tree_duration_usecs, fsync_duration_usecs, generation, hs_ckpt_duration_usecs;
-    uint64_t time_start_ckpt_tree, time_start_fsync, time_start_hs, time_stop_ckpt_tree,
-      time_stop_fsync, time_stop_hs;
+    uint64_t time_start_ckpt_tree, time_start_fsync, time_start_hs, time_start_meta,
+      time_stop_ckpt_tree, time_stop_fsync, time_stop_hs;
     u_int i;
     const char *name;
     bool can_skip, failed, full, idle, logging, tracking, use_timestamp;
@@ -1266,6 +1304,12 @@ __txn_checkpoint(WT_SESSION_IMPL *session, const char *cfg[])
     WT_STAT_CONN_SET(session, checkpoint_state, WT_CHECKPOINT_STATE_CKPT_TREE);
     __checkpoint_verbose_track(session, "checkpointing individual trees");
 
+    /*
+     * Write the trees' metadata updates together once all of the trees are checkpointed, rather
+     * than one tree at a time: sorted, they can be written with a single metadata cursor.
+     */
+    session->ckpt_meta_defer = getenv("NODEFER") == NULL;
+
     time_start_ckpt_tree = __wt_clock(session);
     WT_ERR(__checkpoint_apply_to_dhandles(session, cfg, __checkpoint_tree_helper));
     time_stop_ckpt_tree = __wt_clock(session);
@@ -1312,6 +1356,29 @@ __txn_checkpoint(WT_SESSION_IMPL *session, const char *cfg[])
         WT_STAT_CONN_SET(session, txn_hs_ckpt_duration, hs_ckpt_duration_usecs);
     }
 
+    /* Checkpoint the history stores of individual files the same way. */
+    for (i = 0; i < session->ckpt_hs_handle_next; ++i) {
+        if (!F_ISSET(session->ckpt_hs_handle[i], WT_DHANDLE_OPEN))
+            continue;
+        conn->txn_global.checkpoint_running_hs = true;
+        WT_STAT_CONN_SET(session, checkpoint_state, WT_CHECKPOINT_STATE_HS);
+
+        WT_WITH_DHANDLE(session, session->ckpt_hs_handle[i], ret = __wt_checkpoint(session, cfg));
+
+        conn->txn_global.checkpoint_running_hs = false;
+        WT_ERR(ret);
+
+        WT_WITH_DHANDLE(
+          session, session->ckpt_hs_handle[i], __checkpoint_update_generation(session));
+    }
+
+    /* Write the metadata updates for all of the trees. */
+    session->ckpt_meta_defer = false;
+    time_start_meta = __wt_clock(session);
+    WT_ERR(__wt_meta_ckpt_deferred_apply(session));
+    WT_STAT_CONN_SET(session, checkpoint_meta_update_duration,
+      WT_CLOCKDIFF_US(__wt_clock(session), time_start_meta));
+
     /*
      * As part of recovery, rollback to stable may have left out clearing stale transaction ids.
      * Update the connection base write generation based on the latest checkpoint write generations
@@ -1362,6 +1429,11 @@ __txn_checkpoint(WT_SESSION_IMPL *session, const char *cfg[])
         WT_STAT_CONN_SET(session, checkpoint_state, WT_CHECKPOINT_STATE_HS_SYNC);
         WT_WITH_DHANDLE(session, hs_dhandle, ret = __wt_checkpoint_sync(session, NULL));
     }
+    for (i = 0; ret == 0 && i < session->ckpt_hs_handle_next; ++i)
+        if (F_ISSET(session->ckpt_hs_handle[i], WT_DHANDLE_OPEN))
+            WT_WITH_DHANDLE(
+              session, session->ckpt_hs_handle[i], ret = __wt_checkpoint_sync(session, NULL));
+    WT_ERR(ret);
 
     time_stop_fsync = __wt_clock(session);
     fsync_duration_usecs = WT_CLOCKDIFF_US(time_stop_fsync, time_start_fsync);
@@ -1483,6 +1555,10 @@ err:
         WT_STAT_CONN_INCR(session, checkpoints_total_failed);
     }
 
+    /* Discard metadata updates not written because the checkpoint failed. */
+    session->ckpt_meta_defer = false;
+    __wt_meta_ckpt_deferred_free(session);
+
     session->isolation = txn->isolation = WT_ISO_READ_UNCOMMITTED;
     if (tracking)
         WT_TRET(__wt_meta_track_off(session, false, failed));
@@ -1525,6 +1601,13 @@ err:
           session, session->ckpt_handle[i], WT_TRET(__wt_session_release_dhandle(session)));
     }
 
+    for (i = 0; i < session->ckpt_hs_handle_next; ++i) {
+        if (failed)
+            WT_WITH_DHANDLE(session, session->ckpt_hs_handle[i], __checkpoint_fail_reset(session));
+        WT_WITH_DHANDLE(
+          session, session->ckpt_hs_handle[i], WT_TRET(__wt_session_release_dhandle(session)));
+    }
+
     if (session->ckpt_drop_list != NULL)
         __wt_scr_free(session, &session->ckpt_drop_list);
 
@@ -1532,6 +1615,8 @@ err:
 
     __wt_free(session, session->ckpt_handle);
     session->ckpt_handle_allocated = session->ckpt_handle_next = 0;
+    __wt_free(session, session->ckpt_hs_handle);
+    session->ckpt_hs_handle_allocated = session->ckpt_hs_handle_next = 0;
 
     session->isolation = txn->isolation = saved_isolation;
     WT_STAT_CONN_SET(session, checkpoint_state, WT_CHECKPOINT_STATE_INACTIVE);
@@ -1590,6 +1675,7 @@ __wt_txn_checkpoint(WT_SESSION_IMPL *session, const char *cfg[], bool waiting)
     WT_CONFIG_ITEM cval;
     WT_DECL_RET;
     uint32_t orig_flags;
+    int tret;
     bool checkpoint_cleanup, flush, flush_sync;
 
     /*
@@ -1654,6 +1740,16 @@ __wt_txn_checkpoint(WT_SESSION_IMPL *session, const char *cfg[], bool waiting)
           __wt_panic(session, ret, "checkpoint can not fail when flush_tier is enabled"));
     WT_ERR(ret);
 
+    /*
+     * Record the pages in cache for warm restart. Hold the checkpoint lock so concurrent
+     * checkpoints don't race writing the file. A failure here doesn't fail the checkpoint.
+     */
+    if (S2C(session)->prefetch_warm_restart) {
+        WT_WITH_CHECKPOINT_LOCK(session, tret = __wt_prefetch_warm_save(session));
+        if (tret != 0)
+            __wt_err(session, tret, "failed to record pages for warm restart");
+    }
+
     /* Trigger the checkpoint cleanup thread to remove the obsolete pages. */
     if (checkpoint_cleanup)
         __wt_checkpoint_cleanup_trigger(session);
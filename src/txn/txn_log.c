@@ -668,7 +668,7 @@ __txn_printlog(WT_SESSION_IMPL *session, WT_ITEM *rawrec, WT_LSN *lsnp, WT_LSN *
     uint32_t fileid, lsnfile, lsnoffset, rectype;
     int32_t start;
     const uint8_t *end, *p;
-    const char *msg;
+    const char *hdr_flags, *msg;
     bool compressed;
 
     WT_UNUSED(next_lsnp);
@@ -678,6 +678,10 @@ __txn_printlog(WT_SESSION_IMPL *session, WT_ITEM *rawrec, WT_LSN *lsnp, WT_LSN *
     end = (const uint8_t *)rawrec->data + rawrec->size;
     logrec = (WT_LOG_RECORD *)rawrec->data;
     compressed = F_ISSET(logrec, WT_LOG_RECORD_COMPRESSED);
+    if (F_ISSET(logrec, WT_LOG_RECORD_DICTIONARY))
+        hdr_flags = "compressed,dictionary";
+    else
+        hdr_flags = compressed ? "compressed" : "";
 
     /* First, peek at the log record type. */
     WT_RET(__wt_logrec_read(session, &p, end, &rectype));
@@ -698,8 +702,10 @@ __txn_printlog(WT_SESSION_IMPL *session, WT_ITEM *rawrec, WT_LSN *lsnp, WT_LSN *
 
     WT_RET(__wt_fprintf(session, args->fs, "  { \"lsn\" : [%" PRIu32 ",%" PRIu32 "],\n",
       lsnp->l.file, __wt_lsn_offset(lsnp)));
-    WT_RET(__wt_fprintf(
-      session, args->fs, "    \"hdr_flags\" : \"%s\",\n", compressed ? "compressed" : ""));
+    WT_RET(__wt_fprintf(session, args->fs, "    \"hdr_flags\" : \"%s\",\n", hdr_flags));
+    if (F_ISSET(logrec, WT_LOG_RECORD_DICTIONARY))
+        WT_RET(__wt_fprintf(
+          session, args->fs, "    \"dict_version\" : %" PRIu16 ",\n", logrec->dict_version));
     WT_RET(__wt_fprintf(session, args->fs, "    \"rec_len\" : %" PRIu32 ",\n", logrec->len));
     WT_RET(__wt_fprintf(session, args->fs, "    \"mem_len\" : %" PRIu32 ",\n",
       compressed ? logrec->mem_len : logrec->len));
@@ -20,6 +20,21 @@ typedef struct {
     WT_LSN ckpt_lsn; /* File's checkpoint LSN. */
 } WT_RECOVERY_FILE;
 
+/*
+ * Operations are queued for the log apply threads in batches. A batch is handed to its thread once
+ * it holds this many bytes, and the log reader waits when a thread has too many batches queued.
+ */
+#define WT_RECOVERY_BATCH_SIZE (64 * WT_KILOBYTE)
+#define WT_RECOVERY_BATCH_QUEUE 8
+
+/* A batch of operations: each is the LSN of its log record, its size and the packed operation. */
+typedef struct __recovery_batch {
+    struct __recovery_batch *next;
+    WT_ITEM buf;
+} WT_RECOVERY_BATCH;
+
+typedef struct __recovery_applier WT_RECOVERY_APPLIER;
+
 typedef struct {
     WT_SESSION_IMPL *session;
 
@@ -39,8 +54,33 @@ typedef struct {
                          * Set during the first recovery pass,
                          * when only the metadata is recovered.
                          */
+
+    /* Threads applying operations in the main recovery pass. */
+    WT_RECOVERY_APPLIER *appliers;
+    u_int nappliers;
+    WT_CONDVAR *apply_cond;      /* Signalled when a batch is applied. */
+    wt_shared int32_t apply_ret; /* First error applying a batch. */
+    wt_shared bool apply_done;   /* Set when the threads should exit. */
 } WT_RECOVERY;
 
+/*
+ * A log apply thread. Each thread has its own session and cursors, and a copy of the recovery state
+ * sharing the file URIs with the thread reading the log.
+ */
+struct __recovery_applier {
+    WT_RECOVERY r;       /* Applier's recovery state. */
+    WT_RECOVERY *reader; /* Log reader's recovery state. */
+
+    wt_thread_t tid;
+    bool tid_set;
+
+    WT_SPINLOCK lock;               /* Queue lock. */
+    WT_CONDVAR *cond;               /* Signalled when a batch is queued. */
+    WT_RECOVERY_BATCH *head, *tail; /* Queued batches. */
+    WT_RECOVERY_BATCH *fill;        /* Batch being filled by the reader. */
+    wt_shared uint32_t queued;      /* Batches queued or being applied. */
+};
+
 /*
  * __recovery_cursor --
  *     Get a cursor for a recovery operation.
@@ -445,6 +485,340 @@ err:
     return (ret);
 }
 
+/*
+ * __recovery_batch_free --
+ *     Free a batch of operations.
+ */
+static void
+__recovery_batch_free(WT_SESSION_IMPL *session, WT_RECOVERY_BATCH *batch)
+{
+    __wt_buf_free(session, &batch->buf);
+    __wt_free(session, batch);
+}
+
+/*
+ * __recovery_batch_apply --
+ *     Apply a batch of operations in a log apply thread.
+ */
+static int
+__recovery_batch_apply(WT_RECOVERY_APPLIER *a, WT_RECOVERY_BATCH *batch)
+{
+    WT_LSN lsn;
+    uint32_t opsize;
+    const uint8_t *end, *op, *p;
+
+    for (p = batch->buf.data, end = p + batch->buf.size; p < end;) {
+        memcpy(&lsn, p, sizeof(lsn));
+        p += sizeof(lsn);
+        memcpy(&opsize, p, sizeof(opsize));
+        p += sizeof(opsize);
+        op = p;
+        p += opsize;
+        WT_RET(__txn_op_apply(&a->r, &lsn, &op, p));
+    }
+    return (0);
+}
+
+/*
+ * __recovery_apply_thread --
+ *     Log apply thread: apply queued batches of operations in order.
+ */
+static WT_THREAD_RET
+__recovery_apply_thread(void *arg)
+{
+    WT_DECL_RET;
+    WT_RECOVERY *reader;
+    WT_RECOVERY_APPLIER *a;
+    WT_RECOVERY_BATCH *batch;
+    WT_SESSION_IMPL *session;
+
+    a = arg;
+    reader = a->reader;
+    session = a->r.session;
+
+    for (;;) {
+        __wt_spin_lock(session, &a->lock);
+        if ((batch = a->head) != NULL && (a->head = batch->next) == NULL)
+            a->tail = NULL;
+        __wt_spin_unlock(session, &a->lock);
+
+        if (batch == NULL) {
+            if (__wt_atomic_loadbool(&reader->apply_done))
+                break;
+            __wt_cond_wait(session, a->cond, 10 * WT_THOUSAND, NULL);
+            continue;
+        }
+
+        /* Once any thread fails, discard the remaining operations. */
+        if (__wt_atomic_loadi32(&reader->apply_ret) == 0 &&
+          (ret = __recovery_batch_apply(a, batch)) != 0)
+            (void)__wt_atomic_casi32(&reader->apply_ret, 0, ret);
+        __recovery_batch_free(session, batch);
+        (void)__wt_atomic_sub32(&a->queued, 1);
+        __wt_cond_signal(session, reader->apply_cond);
+    }
+    return (WT_THREAD_RET_VALUE);
+}
+
+/*
+ * __recovery_apply_flush --
+ *     Hand the batch being filled to its log apply thread, waiting if the thread is too far behind.
+ */
+static int
+__recovery_apply_flush(WT_RECOVERY *r, WT_RECOVERY_APPLIER *a)
+{
+    WT_RECOVERY_BATCH *batch;
+    WT_SESSION_IMPL *session;
+
+    session = r->session;
+    if ((batch = a->fill) == NULL)
+        return (0);
+
+    while (__wt_atomic_load32(&a->queued) >= WT_RECOVERY_BATCH_QUEUE) {
+        WT_RET(__wt_atomic_loadi32(&r->apply_ret));
+        __wt_cond_wait(session, r->apply_cond, WT_THOUSAND, NULL);
+    }
+    WT_RET(__wt_atomic_loadi32(&r->apply_ret));
+
+    a->fill = NULL;
+    (void)__wt_atomic_add32(&a->queued, 1);
+    __wt_spin_lock(session, &a->lock);
+    if (a->tail == NULL)
+        a->head = batch;
+    else
+        a->tail->next = batch;
+    a->tail = batch;
+    __wt_spin_unlock(session, &a->lock);
+    __wt_cond_signal(session, a->cond);
+    return (0);
+}
+
+/*
+ * __recovery_apply_wait --
+ *     Wait for the log apply threads to apply all queued operations.
+ */
+static int
+__recovery_apply_wait(WT_RECOVERY *r)
+{
+    u_int i;
+
+    for (i = 0; i < r->nappliers; ++i)
+        WT_RET(__recovery_apply_flush(r, &r->appliers[i]));
+    for (i = 0; i < r->nappliers; ++i)
+        while (__wt_atomic_load32(&r->appliers[i].queued) != 0)
+            __wt_cond_wait(r->session, r->apply_cond, WT_THOUSAND, NULL);
+    return (__wt_atomic_loadi32(&r->apply_ret));
+}
+
+/*
+ * __recovery_apply_queue --
+ *     Queue an operation for a log apply thread.
+ */
+static int
+__recovery_apply_queue(
+  WT_RECOVERY *r, WT_RECOVERY_APPLIER *a, WT_LSN *lsnp, const uint8_t *op, uint32_t opsize)
+{
+    WT_DECL_RET;
+    WT_RECOVERY_BATCH *batch;
+    WT_SESSION_IMPL *session;
+    uint8_t *p;
+
+    session = r->session;
+    if ((batch = a->fill) == NULL) {
+        WT_RET(__wt_calloc_one(session, &batch));
+        ret = __wt_buf_init(session, &batch->buf, WT_RECOVERY_BATCH_SIZE + WT_KILOBYTE);
+        if (ret != 0) {
+            __wt_free(session, batch);
+            return (ret);
+        }
+        a->fill = batch;
+    }
+    WT_RET(__wt_buf_grow(
+      session, &batch->buf, batch->buf.size + sizeof(*lsnp) + sizeof(opsize) + opsize));
+    p = (uint8_t *)batch->buf.mem + batch->buf.size;
+    memcpy(p, lsnp, sizeof(*lsnp));
+    p += sizeof(*lsnp);
+    memcpy(p, &opsize, sizeof(opsize));
+    p += sizeof(opsize);
+    memcpy(p, op, opsize);
+    batch->buf.size += sizeof(*lsnp) + sizeof(opsize) + opsize;
+
+    if (batch->buf.size >= WT_RECOVERY_BATCH_SIZE)
+        WT_RET(__recovery_apply_flush(r, a));
+    return (0);
+}
+
+/*
+ * __recovery_op_dispatch --
+ *     Queue an operation for the log apply thread that owns its key, or apply it here if it can't
+ *     be applied in parallel.
+ */
+static int
+__recovery_op_dispatch(WT_RECOVERY *r, WT_LSN *lsnp, const uint8_t **pp, const uint8_t *end)
+{
+    WT_ITEM key, value;
+    WT_SESSION_IMPL *session;
+    uint64_t hash, recno;
+    uint32_t fileid, opsize, optype;
+    const uint8_t *opend, *p;
+
+    session = r->session;
+    WT_RET(__wt_logop_read(session, pp, end, &optype, &opsize));
+    if (opsize > WT_PTRDIFF(end, *pp))
+        return (__txn_op_apply(r, lsnp, pp, end));
+    opend = *pp + opsize;
+    p = *pp;
+
+    /*
+     * Operations on a single key are hashed to a thread by file and key, so they're applied in log
+     * order. Truncates span keys: wait for the queued operations to be applied, and truncate here.
+     * Anything else, including operations recovery skips, is handled here as well.
+     */
+    switch (optype) {
+    case WT_LOGOP_COL_MODIFY:
+        WT_RET(__wt_logop_col_modify_unpack(session, &p, opend, &fileid, &recno, &value));
+        hash = __wt_hash_city64(&recno, sizeof(recno));
+        break;
+    case WT_LOGOP_COL_PUT:
+        WT_RET(__wt_logop_col_put_unpack(session, &p, opend, &fileid, &recno, &value));
+        hash = __wt_hash_city64(&recno, sizeof(recno));
+        break;
+    case WT_LOGOP_COL_REMOVE:
+        WT_RET(__wt_logop_col_remove_unpack(session, &p, opend, &fileid, &recno));
+        hash = __wt_hash_city64(&recno, sizeof(recno));
+        break;
+    case WT_LOGOP_ROW_MODIFY:
+        WT_RET(__wt_logop_row_modify_unpack(session, &p, opend, &fileid, &key, &value));
+        hash = __wt_hash_city64(key.data, key.size);
+        break;
+    case WT_LOGOP_ROW_PUT:
+        WT_RET(__wt_logop_row_put_unpack(session, &p, opend, &fileid, &key, &value));
+        hash = __wt_hash_city64(key.data, key.size);
+        break;
+    case WT_LOGOP_ROW_REMOVE:
+        WT_RET(__wt_logop_row_remove_unpack(session, &p, opend, &fileid, &key));
+        hash = __wt_hash_city64(key.data, key.size);
+        break;
+    case WT_LOGOP_COL_TRUNCATE:
+    case WT_LOGOP_ROW_TRUNCATE:
+        WT_RET(__recovery_apply_wait(r));
+        /* FALLTHROUGH */
+    default:
+        return (__txn_op_apply(r, lsnp, pp, end));
+    }
+
+    /* Operations recovery skips are handled here, the checks match __recovery_cursor. */
+    if (WT_LOGOP_IS_IGNORED(fileid) || fileid == WT_METAFILE_ID || fileid >= r->nfiles ||
+      r->files[fileid].uri == NULL || __wt_log_cmp(lsnp, &r->files[fileid].ckpt_lsn) < 0)
+        return (__txn_op_apply(r, lsnp, pp, end));
+
+    WT_RET(__recovery_apply_queue(
+      r, &r->appliers[(hash + fileid) % r->nappliers], lsnp, *pp, opsize));
+    *pp = opend;
+    return (0);
+}
+
+/*
+ * __recovery_apply_start --
+ *     Start the log apply threads.
+ */
+static int
+__recovery_apply_start(WT_RECOVERY *r, u_int nthreads)
+{
+    WT_CONNECTION_IMPL *conn;
+    WT_RECOVERY_APPLIER *a;
+    WT_SESSION_IMPL *session;
+    u_int i, j;
+
+    session = r->session;
+    conn = S2C(session);
+
+    WT_RET(__wt_calloc_def(session, nthreads, &r->appliers));
+    WT_RET(__wt_cond_alloc(session, "recovery apply", &r->apply_cond));
+    for (i = 0; i < nthreads; ++i) {
+        a = &r->appliers[r->nappliers++];
+        a->reader = r;
+        a->r = *r;
+        a->r.files = NULL;
+        a->r.appliers = NULL;
+        a->r.nappliers = 0;
+        a->r.apply_cond = NULL;
+        WT_RET(__wt_spin_init(session, &a->lock, "recovery apply"));
+        WT_RET(__wt_cond_alloc(session, "recovery apply", &a->cond));
+        WT_RET(__wt_open_internal_session(conn, "txn-recover-apply", false, 0, 0, &a->r.session));
+
+        /* The applier opens its own cursors, the URIs are owned by the log reader. */
+        WT_RET(__wt_calloc_def(session, r->nfiles, &a->r.files));
+        a->r.file_alloc = r->nfiles * sizeof(WT_RECOVERY_FILE);
+        for (j = 0; j < r->nfiles; ++j) {
+            a->r.files[j].uri = r->files[j].uri;
+            WT_ASSIGN_LSN(&a->r.files[j].ckpt_lsn, &r->files[j].ckpt_lsn);
+        }
+
+        WT_RET(__wt_thread_create(session, &a->tid, __recovery_apply_thread, a));
+        a->tid_set = true;
+    }
+
+    __wt_verbose_multi(
+      session, WT_VERB_RECOVERY_ALL, "Applying log records with %u threads", r->nappliers);
+    return (0);
+}
+
+/*
+ * __recovery_apply_stop --
+ *     Stop the log apply threads, discarding any operations that haven't been applied.
+ */
+static int
+__recovery_apply_stop(WT_RECOVERY *r)
+{
+    WT_CURSOR *c;
+    WT_DECL_RET;
+    WT_RECOVERY_APPLIER *a;
+    WT_RECOVERY_BATCH *batch;
+    WT_SESSION_IMPL *session;
+    u_int i, j;
+
+    session = r->session;
+    if (r->appliers == NULL)
+        return (0);
+
+    /* Operations still queued are only there after an error. */
+    (void)__wt_atomic_casi32(&r->apply_ret, 0, ECANCELED);
+    __wt_atomic_storebool(&r->apply_done, true);
+    for (i = 0; i < r->nappliers; ++i) {
+        a = &r->appliers[i];
+        if (a->tid_set) {
+            __wt_cond_signal(session, a->cond);
+            WT_TRET(__wt_thread_join(session, &a->tid));
+            a->tid_set = false;
+        }
+    }
+
+    for (i = 0; i < r->nappliers; ++i) {
+        a = &r->appliers[i];
+        while ((batch = a->head) != NULL) {
+            a->head = batch->next;
+            __recovery_batch_free(session, batch);
+        }
+        if (a->fill != NULL)
+            __recovery_batch_free(session, a->fill);
+        if (a->r.files != NULL) {
+            for (j = 0; j < a->r.nfiles; ++j)
+                if ((c = a->r.files[j].c) != NULL)
+                    WT_TRET(c->close(c));
+            __wt_free(session, a->r.files);
+        }
+        if (a->r.session != NULL)
+            WT_TRET(__wt_session_close_internal(a->r.session));
+        __wt_cond_destroy(session, &a->cond);
+        __wt_spin_destroy(session, &a->lock);
+    }
+    __wt_free(session, r->appliers);
+    r->nappliers = 0;
+    __wt_cond_destroy(session, &r->apply_cond);
+    return (ret);
+}
+
 /*
  * __txn_commit_apply --
  *     Apply a commit record during recovery.
@@ -454,7 +828,10 @@ __txn_commit_apply(WT_RECOVERY *r, WT_LSN *lsnp, const uint8_t **pp, const uint8
 {
     /* The logging subsystem zero-pads records. */
     while (*pp < end && **pp)
-        WT_RET(__txn_op_apply(r, lsnp, pp, end));
+        if (r->nappliers == 0)
+            WT_RET(__txn_op_apply(r, lsnp, pp, end));
+        else
+            WT_RET(__recovery_op_dispatch(r, lsnp, pp, end));
 
     return (0);
 }
@@ -1097,11 +1474,19 @@ __wt_txn_recover(WT_SESSION_IMPL *session, const char *cfg[])
      */
     if (needs_rec)
         FLD_SET(conn->log_flags, WT_CONN_LOG_RECOVER_DIRTY);
+    /*
+     * If configured, this thread reads the log and hands operations to threads applying them.
+     */
+    if (needs_rec && conn->log_recover_threads > 0)
+        WT_ERR(__recovery_apply_start(&r, conn->log_recover_threads));
     if (WT_IS_INIT_LSN(&r.ckpt_lsn))
         ret = __wt_log_scan(
           session, NULL, NULL, WT_LOGSCAN_FIRST | WT_LOGSCAN_RECOVER, __txn_log_recover, &r);
     else
         ret = __wt_log_scan(session, &r.ckpt_lsn, NULL, WT_LOGSCAN_RECOVER, __txn_log_recover, &r);
+    if (ret == 0 && r.nappliers != 0)
+        ret = __recovery_apply_wait(&r);
+    WT_TRET(__recovery_apply_stop(&r));
     if (F_ISSET(conn, WT_CONN_SALVAGE))
         ret = 0;
     WT_ERR(ret);
@@ -1222,6 +1607,7 @@ done:
       conn->recovery_timeline.rts_ms, conn->recovery_timeline.checkpoint_ms);
 
 err:
+    WT_TRET(__recovery_apply_stop(&r));
     WT_TRET(__recovery_close_cursors(&r));
     __wt_free(session, config);
     FLD_CLR(conn->log_flags, WT_CONN_LOG_RECOVER_DIRTY);
@@ -88,7 +88,7 @@ __wt_txn_get_pinned_timestamp(WT_SESSION_IMPL *session, wt_timestamp_t *tsp, uin
     WT_TXN_GLOBAL *txn_global;
     WT_TXN_SHARED *s;
     wt_timestamp_t tmp_read_ts, tmp_ts;
-    uint32_t i, session_cnt;
+    uint32_t i, session_cnt, walked;
     bool include_oldest, txn_has_write_lock;
 
     conn = S2C(session);
@@ -114,7 +114,9 @@ __wt_txn_get_pinned_timestamp(WT_SESSION_IMPL *session, wt_timestamp_t *tsp, uin
 
     /* Walk the array of concurrent transactions. */
     WT_ACQUIRE_READ_WITH_BARRIER(session_cnt, conn->session_array.cnt);
-    for (i = 0, s = txn_global->txn_shared_list; i < session_cnt; i++, s++) {
+    for (i = __wt_txn_shared_next(session, 0, session_cnt), walked = 0; i < session_cnt;
+         i = __wt_txn_shared_next(session, i + 1, session_cnt), ++walked) {
+        s = &txn_global->txn_shared_list[i];
         __txn_get_read_timestamp(s, &tmp_read_ts);
         /*
          * A zero timestamp is possible here only when the oldest timestamp is not accounted for.
@@ -127,7 +129,7 @@ __wt_txn_get_pinned_timestamp(WT_SESSION_IMPL *session, wt_timestamp_t *tsp, uin
         __wt_readunlock(session, &txn_global->rwlock);
 
     WT_STAT_CONN_INCR(session, txn_walk_sessions);
-    WT_STAT_CONN_INCRV(session, txn_sessions_walked, i);
+    WT_STAT_CONN_INCRV(session, txn_sessions_walked, walked);
 
     *tsp = tmp_ts;
 }
@@ -154,7 +156,7 @@ __txn_global_query_timestamp(WT_SESSION_IMPL *session, wt_timestamp_t *tsp, cons
     WT_TXN_GLOBAL *txn_global;
     WT_TXN_SHARED *s;
     wt_timestamp_t ts, tmpts;
-    uint32_t i, session_cnt;
+    uint32_t i, session_cnt, walked;
 
     conn = S2C(session);
     txn_global = &conn->txn_global;
@@ -177,7 +179,9 @@ __txn_global_query_timestamp(WT_SESSION_IMPL *session, wt_timestamp_t *tsp, cons
 
         /* Walk the array of concurrent transactions. */
         WT_ACQUIRE_READ_WITH_BARRIER(session_cnt, conn->session_array.cnt);
-        for (i = 0, s = txn_global->txn_shared_list; i < session_cnt; i++, s++) {
+        for (i = __wt_txn_shared_next(session, 0, session_cnt), walked = 0; i < session_cnt;
+             i = __wt_txn_shared_next(session, i + 1, session_cnt), ++walked) {
+            s = &txn_global->txn_shared_list[i];
             __txn_get_durable_timestamp(s, &tmpts);
             if (tmpts != 0 && (ts == 0 || --tmpts < ts))
                 ts = tmpts;
@@ -186,7 +190,7 @@ __txn_global_query_timestamp(WT_SESSION_IMPL *session, wt_timestamp_t *tsp, cons
         __wt_readunlock(session, &txn_global->rwlock);
 
         WT_STAT_CONN_INCR(session, txn_walk_sessions);
-        WT_STAT_CONN_INCRV(session, txn_sessions_walked, i);
+        WT_STAT_CONN_INCRV(session, txn_sessions_walked, walked);
     } else if (WT_CONFIG_LIT_MATCH("last_checkpoint", cval)) {
         /* Read-only value forever. Make sure we don't used a cached version. */
         WT_COMPILER_BARRIER();
@@ -843,6 +847,7 @@ __wt_txn_set_read_timestamp(WT_SESSION_IMPL *session, wt_timestamp_t read_ts)
      * This code is not using the timestamp validate function to avoid a race between checking and
      * setting transaction timestamp.
      */
+    __wt_txn_shared_active(session);
     __wt_readlock(session, &txn_global->rwlock);
 
     ts_oldest = txn_global->oldest_timestamp;
@@ -1077,6 +1082,7 @@ __wt_txn_publish_durable_timestamp(WT_SESSION_IMPL *session)
     } else
         return;
 
+    __wt_txn_shared_active(session);
     txn_shared->pinned_durable_timestamp = ts;
     F_SET(txn, WT_TXN_SHARED_TS_DURABLE);
 }
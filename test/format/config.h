@@ -41,137 +41,138 @@ typedef struct {
 #define V_GLOBAL_BLOCK_CACHE_CACHE_ON_CHECKPOINT 7
 #define V_GLOBAL_BLOCK_CACHE_CACHE_ON_WRITES 8
 #define V_GLOBAL_BLOCK_CACHE_SIZE 9
-#define V_TABLE_BTREE_BITCNT 10
-#define V_TABLE_BTREE_COMPRESSION 11
-#define V_TABLE_BTREE_DICTIONARY 12
-#define V_TABLE_BTREE_INTERNAL_KEY_TRUNCATION 13
-#define V_TABLE_BTREE_INTERNAL_PAGE_MAX 14
-#define V_TABLE_BTREE_KEY_MAX 15
-#define V_TABLE_BTREE_KEY_MIN 16
-#define V_TABLE_BTREE_LEAF_PAGE_MAX 17
-#define V_TABLE_BTREE_MEMORY_PAGE_MAX 18
-#define V_TABLE_BTREE_PREFIX_LEN 19
-#define V_TABLE_BTREE_PREFIX_COMPRESSION 20
-#define V_TABLE_BTREE_PREFIX_COMPRESSION_MIN 21
-#define V_TABLE_BTREE_REPEAT_DATA_PCT 22
-#define V_TABLE_BTREE_REVERSE 23
-#define V_TABLE_BTREE_SPLIT_PCT 24
-#define V_TABLE_BTREE_VALUE_MAX 25
-#define V_TABLE_BTREE_VALUE_MIN 26
-#define V_GLOBAL_BUFFER_ALIGNMENT 27
-#define V_GLOBAL_CACHE 28
-#define V_GLOBAL_CACHE_EVICT_MAX 29
-#define V_GLOBAL_CACHE_EVICTION_DIRTY_TARGET 30
-#define V_GLOBAL_CACHE_EVICTION_DIRTY_TRIGGER 31
-#define V_GLOBAL_CACHE_MINIMUM 32
-#define V_GLOBAL_CHECKPOINT 33
-#define V_GLOBAL_CHECKPOINT_LOG_SIZE 34
-#define V_GLOBAL_CHECKPOINT_WAIT 35
-#define V_GLOBAL_CHUNK_CACHE 36
-#define V_GLOBAL_CHUNK_CACHE_CAPACITY 37
-#define V_GLOBAL_CHUNK_CACHE_CHUNK_SIZE 38
-#define V_GLOBAL_CHUNK_CACHE_STORAGE_PATH 39
-#define V_GLOBAL_CHUNK_CACHE_TYPE 40
-#define V_GLOBAL_COMPACT_FREE_SPACE_TARGET 41
-#define V_GLOBAL_DEBUG_CHECKPOINT_RETENTION 42
-#define V_GLOBAL_DEBUG_CURSOR_REPOSITION 43
-#define V_GLOBAL_DEBUG_EVICTION 44
-#define V_GLOBAL_DEBUG_LOG_RETENTION 45
-#define V_GLOBAL_DEBUG_REALLOC_EXACT 46
-#define V_GLOBAL_DEBUG_REALLOC_MALLOC 47
-#define V_GLOBAL_DEBUG_SLOW_CHECKPOINT 48
-#define V_GLOBAL_DEBUG_TABLE_LOGGING 49
-#define V_GLOBAL_DEBUG_UPDATE_RESTORE_EVICT 50
-#define V_TABLE_DISK_CHECKSUM 51
-#define V_GLOBAL_DISK_DATA_EXTEND 52
-#define V_GLOBAL_DISK_DIRECT_IO 53
-#define V_GLOBAL_DISK_ENCRYPTION 54
-#define V_TABLE_DISK_FIRSTFIT 55
-#define V_GLOBAL_DISK_MMAP 56
-#define V_GLOBAL_DISK_MMAP_ALL 57
-#define V_GLOBAL_FILE_MANAGER_CLOSE_HANDLE_MINIMUM 58
-#define V_GLOBAL_FILE_MANAGER_CLOSE_IDLE_TIME 59
-#define V_GLOBAL_FILE_MANAGER_CLOSE_SCAN_INTERVAL 60
-#define V_GLOBAL_FORMAT_ABORT 61
-#define V_GLOBAL_FORMAT_INDEPENDENT_THREAD_RNG 62
-#define V_GLOBAL_FORMAT_MAJOR_TIMEOUT 63
-#define V_GLOBAL_IMPORT 64
-#define V_GLOBAL_LOGGING 65
-#define V_GLOBAL_LOGGING_COMPRESSION 66
-#define V_GLOBAL_LOGGING_FILE_MAX 67
-#define V_GLOBAL_LOGGING_PREALLOC 68
-#define V_GLOBAL_LOGGING_REMOVE 69
-#define V_TABLE_LSM_AUTO_THROTTLE 70
-#define V_TABLE_LSM_BLOOM 71
-#define V_TABLE_LSM_BLOOM_BIT_COUNT 72
-#define V_TABLE_LSM_BLOOM_HASH_COUNT 73
-#define V_TABLE_LSM_BLOOM_OLDEST 74
-#define V_TABLE_LSM_CHUNK_SIZE 75
-#define V_TABLE_LSM_MERGE_MAX 76
-#define V_GLOBAL_LSM_WORKER_THREADS 77
-#define V_GLOBAL_OPS_ALTER 78
-#define V_GLOBAL_OPS_COMPACTION 79
-#define V_GLOBAL_OPS_HS_CURSOR 80
-#define V_TABLE_OPS_PARETO 81
-#define V_TABLE_OPS_PARETO_SKEW 82
-#define V_TABLE_OPS_PCT_DELETE 83
-#define V_TABLE_OPS_PCT_INSERT 84
-#define V_TABLE_OPS_PCT_MODIFY 85
-#define V_TABLE_OPS_PCT_READ 86
-#define V_TABLE_OPS_PCT_WRITE 87
-#define V_GLOBAL_OPS_BOUND_CURSOR 88
-#define V_GLOBAL_OPS_PREPARE 89
-#define V_GLOBAL_OPS_RANDOM_CURSOR 90
-#define V_GLOBAL_OPS_SALVAGE 91
-#define V_GLOBAL_OPS_THROTTLE 92
-#define V_GLOBAL_OPS_THROTTLE_SLEEP_US 93
-#define V_TABLE_OPS_TRUNCATE 94
-#define V_GLOBAL_OPS_VERIFY 95
-#define V_GLOBAL_QUIET 96
-#define V_GLOBAL_RANDOM_DATA_SEED 97
-#define V_GLOBAL_RANDOM_EXTRA_SEED 98
-#define V_GLOBAL_RUNS_IN_MEMORY 99
-#define V_TABLE_RUNS_MIRROR 100
-#define V_GLOBAL_RUNS_OPS 101
-#define V_GLOBAL_RUNS_PREDICTABLE_REPLAY 102
-#define V_TABLE_RUNS_ROWS 103
-#define V_TABLE_RUNS_SOURCE 104
-#define V_GLOBAL_RUNS_TABLES 105
-#define V_GLOBAL_RUNS_THREADS 106
-#define V_GLOBAL_RUNS_TIMER 107
-#define V_TABLE_RUNS_TYPE 108
-#define V_GLOBAL_RUNS_VERIFY_FAILURE_DUMP 109
-#define V_GLOBAL_STATISTICS_MODE 110
-#define V_GLOBAL_STATISTICS_LOG_SOURCES 111
-#define V_GLOBAL_STRESS_AGGRESSIVE_STASH_FREE 112
-#define V_GLOBAL_STRESS_AGGRESSIVE_SWEEP 113
-#define V_GLOBAL_STRESS_CHECKPOINT 114
-#define V_GLOBAL_STRESS_CHECKPOINT_EVICT_PAGE 115
-#define V_GLOBAL_STRESS_CHECKPOINT_PREPARE 116
-#define V_GLOBAL_STRESS_COMPACT_SLOW 117
-#define V_GLOBAL_STRESS_EVICT_REPOSITION 118
-#define V_GLOBAL_STRESS_FAILPOINT_EVICTION_SPLIT 119
-#define V_GLOBAL_STRESS_FAILPOINT_HS_DELETE_KEY_FROM_TS 120
-#define V_GLOBAL_STRESS_HS_CHECKPOINT_DELAY 121
-#define V_GLOBAL_STRESS_HS_SEARCH 122
-#define V_GLOBAL_STRESS_HS_SWEEP 123
-#define V_GLOBAL_STRESS_PREPARE_RESOLUTION_1 124
-#define V_GLOBAL_STRESS_SLEEP_BEFORE_READ_OVERFLOW_ONPAGE 125
-#define V_GLOBAL_STRESS_SPLIT_1 126
-#define V_GLOBAL_STRESS_SPLIT_2 127
-#define V_GLOBAL_STRESS_SPLIT_3 128
-#define V_GLOBAL_STRESS_SPLIT_4 129
-#define V_GLOBAL_STRESS_SPLIT_5 130
-#define V_GLOBAL_STRESS_SPLIT_6 131
-#define V_GLOBAL_STRESS_SPLIT_7 132
-#define V_GLOBAL_STRESS_SPLIT_8 133
-#define V_GLOBAL_TIERED_STORAGE_FLUSH_FREQUENCY 134
-#define V_GLOBAL_TIERED_STORAGE_STORAGE_SOURCE 135
-#define V_GLOBAL_TRANSACTION_IMPLICIT 136
-#define V_GLOBAL_TRANSACTION_OPERATION_TIMEOUT_MS 137
-#define V_GLOBAL_TRANSACTION_TIMESTAMPS 138
-#define V_GLOBAL_WIREDTIGER_CONFIG 139
-#define V_GLOBAL_WIREDTIGER_RWLOCK 140
-#define V_GLOBAL_WIREDTIGER_LEAK_MEMORY 141
+#define V_GLOBAL_BLOCK_CACHE_TINYLFU 10
+#define V_TABLE_BTREE_BITCNT 11
+#define V_TABLE_BTREE_COMPRESSION 12
+#define V_TABLE_BTREE_DICTIONARY 13
+#define V_TABLE_BTREE_INTERNAL_KEY_TRUNCATION 14
+#define V_TABLE_BTREE_INTERNAL_PAGE_MAX 15
+#define V_TABLE_BTREE_KEY_MAX 16
+#define V_TABLE_BTREE_KEY_MIN 17
+#define V_TABLE_BTREE_LEAF_PAGE_MAX 18
+#define V_TABLE_BTREE_MEMORY_PAGE_MAX 19
+#define V_TABLE_BTREE_PREFIX_LEN 20
+#define V_TABLE_BTREE_PREFIX_COMPRESSION 21
+#define V_TABLE_BTREE_PREFIX_COMPRESSION_MIN 22
+#define V_TABLE_BTREE_REPEAT_DATA_PCT 23
+#define V_TABLE_BTREE_REVERSE 24
+#define V_TABLE_BTREE_SPLIT_PCT 25
+#define V_TABLE_BTREE_VALUE_MAX 26
+#define V_TABLE_BTREE_VALUE_MIN 27
+#define V_GLOBAL_BUFFER_ALIGNMENT 28
+#define V_GLOBAL_CACHE 29
+#define V_GLOBAL_CACHE_EVICT_MAX 30
+#define V_GLOBAL_CACHE_EVICTION_DIRTY_TARGET 31
+#define V_GLOBAL_CACHE_EVICTION_DIRTY_TRIGGER 32
+#define V_GLOBAL_CACHE_MINIMUM 33
+#define V_GLOBAL_CHECKPOINT 34
+#define V_GLOBAL_CHECKPOINT_LOG_SIZE 35
+#define V_GLOBAL_CHECKPOINT_WAIT 36
+#define V_GLOBAL_CHUNK_CACHE 37
+#define V_GLOBAL_CHUNK_CACHE_CAPACITY 38
+#define V_GLOBAL_CHUNK_CACHE_CHUNK_SIZE 39
+#define V_GLOBAL_CHUNK_CACHE_STORAGE_PATH 40
+#define V_GLOBAL_CHUNK_CACHE_TYPE 41
+#define V_GLOBAL_COMPACT_FREE_SPACE_TARGET 42
+#define V_GLOBAL_DEBUG_CHECKPOINT_RETENTION 43
+#define V_GLOBAL_DEBUG_CURSOR_REPOSITION 44
+#define V_GLOBAL_DEBUG_EVICTION 45
+#define V_GLOBAL_DEBUG_LOG_RETENTION 46
+#define V_GLOBAL_DEBUG_REALLOC_EXACT 47
+#define V_GLOBAL_DEBUG_REALLOC_MALLOC 48
+#define V_GLOBAL_DEBUG_SLOW_CHECKPOINT 49
+#define V_GLOBAL_DEBUG_TABLE_LOGGING 50
+#define V_GLOBAL_DEBUG_UPDATE_RESTORE_EVICT 51
+#define V_TABLE_DISK_CHECKSUM 52
+#define V_GLOBAL_DISK_DATA_EXTEND 53
+#define V_GLOBAL_DISK_DIRECT_IO 54
+#define V_GLOBAL_DISK_ENCRYPTION 55
+#define V_TABLE_DISK_FIRSTFIT 56
+#define V_GLOBAL_DISK_MMAP 57
+#define V_GLOBAL_DISK_MMAP_ALL 58
+#define V_GLOBAL_FILE_MANAGER_CLOSE_HANDLE_MINIMUM 59
+#define V_GLOBAL_FILE_MANAGER_CLOSE_IDLE_TIME 60
+#define V_GLOBAL_FILE_MANAGER_CLOSE_SCAN_INTERVAL 61
+#define V_GLOBAL_FORMAT_ABORT 62
+#define V_GLOBAL_FORMAT_INDEPENDENT_THREAD_RNG 63
+#define V_GLOBAL_FORMAT_MAJOR_TIMEOUT 64
+#define V_GLOBAL_IMPORT 65
+#define V_GLOBAL_LOGGING 66
+#define V_GLOBAL_LOGGING_COMPRESSION 67
+#define V_GLOBAL_LOGGING_FILE_MAX 68
+#define V_GLOBAL_LOGGING_PREALLOC 69
+#define V_GLOBAL_LOGGING_REMOVE 70
+#define V_TABLE_LSM_AUTO_THROTTLE 71
+#define V_TABLE_LSM_BLOOM 72
+#define V_TABLE_LSM_BLOOM_BIT_COUNT 73
+#define V_TABLE_LSM_BLOOM_HASH_COUNT 74
+#define V_TABLE_LSM_BLOOM_OLDEST 75
+#define V_TABLE_LSM_CHUNK_SIZE 76
+#define V_TABLE_LSM_MERGE_MAX 77
+#define V_GLOBAL_LSM_WORKER_THREADS 78
+#define V_GLOBAL_OPS_ALTER 79
+#define V_GLOBAL_OPS_COMPACTION 80
+#define V_GLOBAL_OPS_HS_CURSOR 81
+#define V_TABLE_OPS_PARETO 82
+#define V_TABLE_OPS_PARETO_SKEW 83
+#define V_TABLE_OPS_PCT_DELETE 84
+#define V_TABLE_OPS_PCT_INSERT 85
+#define V_TABLE_OPS_PCT_MODIFY 86
+#define V_TABLE_OPS_PCT_READ 87
+#define V_TABLE_OPS_PCT_WRITE 88
+#define V_GLOBAL_OPS_BOUND_CURSOR 89
+#define V_GLOBAL_OPS_PREPARE 90
+#define V_GLOBAL_OPS_RANDOM_CURSOR 91
+#define V_GLOBAL_OPS_SALVAGE 92
+#define V_GLOBAL_OPS_THROTTLE 93
+#define V_GLOBAL_OPS_THROTTLE_SLEEP_US 94
+#define V_TABLE_OPS_TRUNCATE 95
+#define V_GLOBAL_OPS_VERIFY 96
+#define V_GLOBAL_QUIET 97
+#define V_GLOBAL_RANDOM_DATA_SEED 98
+#define V_GLOBAL_RANDOM_EXTRA_SEED 99
+#define V_GLOBAL_RUNS_IN_MEMORY 100
+#define V_TABLE_RUNS_MIRROR 101
+#define V_GLOBAL_RUNS_OPS 102
+#define V_GLOBAL_RUNS_PREDICTABLE_REPLAY 103
+#define V_TABLE_RUNS_ROWS 104
+#define V_TABLE_RUNS_SOURCE 105
+#define V_GLOBAL_RUNS_TABLES 106
+#define V_GLOBAL_RUNS_THREADS 107
+#define V_GLOBAL_RUNS_TIMER 108
+#define V_TABLE_RUNS_TYPE 109
+#define V_GLOBAL_RUNS_VERIFY_FAILURE_DUMP 110
+#define V_GLOBAL_STATISTICS_MODE 111
+#define V_GLOBAL_STATISTICS_LOG_SOURCES 112
+#define V_GLOBAL_STRESS_AGGRESSIVE_STASH_FREE 113
+#define V_GLOBAL_STRESS_AGGRESSIVE_SWEEP 114
+#define V_GLOBAL_STRESS_CHECKPOINT 115
+#define V_GLOBAL_STRESS_CHECKPOINT_EVICT_PAGE 116
+#define V_GLOBAL_STRESS_CHECKPOINT_PREPARE 117
+#define V_GLOBAL_STRESS_COMPACT_SLOW 118
+#define V_GLOBAL_STRESS_EVICT_REPOSITION 119
+#define V_GLOBAL_STRESS_FAILPOINT_EVICTION_SPLIT 120
+#define V_GLOBAL_STRESS_FAILPOINT_HS_DELETE_KEY_FROM_TS 121
+#define V_GLOBAL_STRESS_HS_CHECKPOINT_DELAY 122
+#define V_GLOBAL_STRESS_HS_SEARCH 123
+#define V_GLOBAL_STRESS_HS_SWEEP 124
+#define V_GLOBAL_STRESS_PREPARE_RESOLUTION_1 125
+#define V_GLOBAL_STRESS_SLEEP_BEFORE_READ_OVERFLOW_ONPAGE 126
+#define V_GLOBAL_STRESS_SPLIT_1 127
+#define V_GLOBAL_STRESS_SPLIT_2 128
+#define V_GLOBAL_STRESS_SPLIT_3 129
+#define V_GLOBAL_STRESS_SPLIT_4 130
+#define V_GLOBAL_STRESS_SPLIT_5 131
+#define V_GLOBAL_STRESS_SPLIT_6 132
+#define V_GLOBAL_STRESS_SPLIT_7 133
+#define V_GLOBAL_STRESS_SPLIT_8 134
+#define V_GLOBAL_TIERED_STORAGE_FLUSH_FREQUENCY 135
+#define V_GLOBAL_TIERED_STORAGE_STORAGE_SOURCE 136
+#define V_GLOBAL_TRANSACTION_IMPLICIT 137
+#define V_GLOBAL_TRANSACTION_OPERATION_TIMEOUT_MS 138
+#define V_GLOBAL_TRANSACTION_TIMESTAMPS 139
+#define V_GLOBAL_WIREDTIGER_CONFIG 140
+#define V_GLOBAL_WIREDTIGER_RWLOCK 141
+#define V_GLOBAL_WIREDTIGER_LEAK_MEMORY 142
 
-#define V_ELEMENT_COUNT 142
+#define V_ELEMENT_COUNT 143
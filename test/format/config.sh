@@ -93,6 +93,8 @@ CONFIG configuration_list[] = {
 
 {"block_cache.size", "block cache size (MB)", 0x0, 1, 100, 100 * 1024}
 
+{"block_cache.tinylfu", "block cache: tinylfu admission filter", C_BOOL, 50, 0, 0}
+
 {"btree.bitcnt", "fixed-length column-store object size (number of bits)", C_TABLE | C_TYPE_FIX, 1, 8, 8}
 
 {"btree.compression", "data compression (off | lz4 | snappy | zlib | zstd)", C_IGNORE | C_STRING | C_TABLE, 0, 0, 0}
@@ -29,6 +29,9 @@ CONFIG configuration_list[] = {{"assert.read_timestamp", "assert read_timestamp"
 
   {"block_cache.size", "block cache size (MB)", 0x0, 1, 100, 100 * 1024, V_GLOBAL_BLOCK_CACHE_SIZE},
 
+  {"block_cache.tinylfu", "block cache: tinylfu admission filter", C_BOOL, 50, 0, 0,
+    V_GLOBAL_BLOCK_CACHE_TINYLFU},
+
   {"btree.bitcnt", "fixed-length column-store object size (number of bits)", C_TABLE | C_TYPE_FIX,
     1, 8, 8, V_TABLE_BTREE_BITCNT},
 
@@ -68,7 +68,7 @@ hs_cursor(void *arg)
     memset(&hs_value, 0, sizeof(hs_value));
     for (;;) {
         /* Open a HS cursor. */
-        testutil_check(__wt_curhs_open((WT_SESSION_IMPL *)session, NULL, &cursor));
+        testutil_check(__wt_curhs_open((WT_SESSION_IMPL *)session, 0, NULL, &cursor));
         F_SET(cursor, WT_CURSTD_HS_READ_COMMITTED);
 
         /*
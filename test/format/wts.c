@@ -381,9 +381,11 @@ create_database(const char *home, WT_CONNECTION **connp)
     if (GV(BLOCK_CACHE) != 0)
         CONFIG_APPEND(p,
           ",block_cache=(enabled=true,type=\"dram\""
+          ",admission=%s"
           ",cache_on_checkpoint=%s"
           ",cache_on_writes=%s"
           ",size=%" PRIu32 "MB)",
+          GV(BLOCK_CACHE_TINYLFU) == 0 ? "none" : "tinylfu",
           GV(BLOCK_CACHE_CACHE_ON_CHECKPOINT) == 0 ? "false" : "true",
           GV(BLOCK_CACHE_CACHE_ON_WRITES) == 0 ? "false" : "true", GV(BLOCK_CACHE_SIZE));
 
@@ -0,0 +1,97 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+#
+# test_block_alloc01.py
+#   Test the block allocation configurations keep the file consistent while free space is reused
+#   across checkpoints, restarts and compaction.
+#
+
+import wttest
+from wtscenario import make_scenarios
+
+class test_block_alloc01(wttest.WiredTigerTestCase):
+    uri = 'table:test_block_alloc01'
+    nrecords = 5000
+
+    allocation = [
+        ('best', dict(allocation='best')),
+        ('first', dict(allocation='first')),
+        ('segregated', dict(allocation='segregated')),
+    ]
+    allocation_size = [
+        ('512B', dict(allocation_size='512B')),
+        ('4KB', dict(allocation_size='4KB')),
+    ]
+    scenarios = make_scenarios(allocation, allocation_size)
+
+    # Values of varying sizes, so freed blocks fragment the file.
+    def value(self, i, round):
+        return str(round) * (100 + (i * 37 + round * 101) % 3000)
+
+    def update(self, round, step):
+        c = self.session.open_cursor(self.uri, None)
+        for i in range(0, self.nrecords, step):
+            c[i] = self.value(i, round)
+        c.close()
+
+    def check(self, round):
+        c = self.session.open_cursor(self.uri, None)
+        for i in range(0, self.nrecords):
+            self.assertEqual(c[i], self.value(i, round if i % 2 == 0 else 0))
+        c.close()
+
+    def test_block_alloc(self):
+        self.session.create(self.uri,
+            'key_format=i,value_format=S,leaf_page_max=4KB,allocation_size={},'
+            'block_allocation={}'.format(self.allocation_size, self.allocation))
+        self.update(0, 1)
+        self.session.checkpoint()
+
+        # Rewrite half of the records with differently sized values, freeing and reallocating
+        # blocks in each checkpoint.
+        for round in range(1, 6):
+            self.update(round, 2)
+            self.session.checkpoint()
+
+        # The free space must survive a restart and remain usable.
+        self.reopen_conn()
+        self.check(5)
+        self.update(6, 2)
+        self.session.checkpoint()
+        self.check(6)
+
+        # Compaction switches to first-fit allocation temporarily.
+        self.session.compact(self.uri)
+        self.check(6)
+
+        self.reopen_conn()
+        self.verifyUntilSuccess(self.session, self.uri)
+        self.check(6)
+
+if __name__ == '__main__':
+    wttest.run()
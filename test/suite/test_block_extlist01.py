@@ -0,0 +1,106 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+#
+# test_block_extlist01.py
+#   Test incremental checkpoint extent lists keep the file consistent across checkpoints, named
+#   checkpoints, restarts and consolidation of the incremental lists.
+#
+
+import wttest
+from wiredtiger import stat
+from wtscenario import make_scenarios
+
+class test_block_extlist01(wttest.WiredTigerTestCase):
+    uri = 'table:test_block_extlist01'
+    conn_config = 'statistics=(all)'
+    nrecords = 20000
+
+    consolidate = [
+        ('consolidate-1', dict(consolidate=1)),
+        ('consolidate-25', dict(consolidate=25)),
+        ('consolidate-100', dict(consolidate=100)),
+    ]
+    scenarios = make_scenarios(consolidate)
+
+    def value(self, i, round):
+        return str(round) * (100 + (i * 37 + round * 101) % 500)
+
+    def update(self, round, start, stop, step):
+        c = self.session.open_cursor(self.uri, None)
+        for i in range(start, stop, step):
+            c[i] = self.value(i, round)
+        c.close()
+
+    def get_stat(self, s):
+        stat_cursor = self.session.open_cursor('statistics:')
+        val = stat_cursor[s][2]
+        stat_cursor.close()
+        return val
+
+    def test_block_extlist(self):
+        self.session.create(self.uri,
+            'key_format=i,value_format=S,allocation_size=512,leaf_page_max=512,'
+            'checkpoint_extent_lists=(incremental=true,consolidate={})'.format(self.consolidate))
+
+        # Load the table, then rewrite every third record to fragment the file.
+        self.update(0, 0, self.nrecords, 1)
+        self.session.checkpoint()
+        self.update(1, 0, self.nrecords, 3)
+        self.session.checkpoint()
+
+        # Small changes in each checkpoint, including named checkpoints which hold on to the base
+        # of their incremental extent lists.
+        for round in range(2, 12):
+            self.update(round, round * 100, round * 100 + 50, 1)
+            if round == 4:
+                self.session.checkpoint('name=extlist_a')
+            elif round == 8:
+                self.session.checkpoint('drop=(extlist_a)')
+            else:
+                self.session.checkpoint()
+
+        # Small changes against a fragmented file are written incrementally.
+        if self.consolidate >= 25:
+            self.assertGreater(self.get_stat(stat.conn.block_extlist_incremental), 0)
+
+        # The avail list must survive a restart, then be used for further incremental lists.
+        self.reopen_conn()
+        self.verifyUntilSuccess(self.session, self.uri)
+        for round in range(12, 16):
+            self.update(round, round * 100, round * 100 + 50, 1)
+            self.session.checkpoint()
+
+        self.reopen_conn()
+        self.verifyUntilSuccess(self.session, self.uri)
+        c = self.session.open_cursor(self.uri, None)
+        for round in range(2, 16):
+            self.assertEqual(c[round * 100], self.value(round * 100, round))
+        c.close()
+
+if __name__ == '__main__':
+    wttest.run()
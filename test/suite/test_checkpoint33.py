@@ -0,0 +1,100 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+
+import time
+import wttest
+from wiredtiger import stat
+from wtdataset import SimpleDataSet
+
+# test_checkpoint33.py
+#
+# Test the checkpoint server writes dirty leaf pages between checkpoints, and that data written
+# by those flushes, including history written to the history store, reads back correctly.
+class test_checkpoint33(wttest.WiredTigerTestCase):
+    conn_config = 'cache_size=100MB,statistics=(all),checkpoint=(wait=60,flush_wait=1)'
+    uri = 'table:test_checkpoint33'
+    nrows = 10000
+
+    def get_stat(self, stat_key):
+        stat_cursor = self.session.open_cursor('statistics:')
+        val = stat_cursor[stat_key][2]
+        stat_cursor.close()
+        return val
+
+    def update(self, ds, value, ts):
+        cursor = self.session.open_cursor(self.uri)
+        self.session.begin_transaction()
+        for i in range(1, self.nrows + 1):
+            cursor[ds.key(i)] = value
+            if i % 100 == 0:
+                self.session.commit_transaction('commit_timestamp=' + self.timestamp_str(ts))
+                self.session.begin_transaction()
+        self.session.commit_transaction('commit_timestamp=' + self.timestamp_str(ts))
+        cursor.close()
+
+    def check(self, ds, value, ts):
+        cursor = self.session.open_cursor(self.uri)
+        self.session.begin_transaction('read_timestamp=' + self.timestamp_str(ts))
+        for i in range(1, self.nrows + 1):
+            self.assertEqual(cursor[ds.key(i)], value)
+        self.session.rollback_transaction()
+        cursor.close()
+
+    def test_checkpoint33(self):
+        ds = SimpleDataSet(self, self.uri, 0, key_format='i', value_format='S')
+        ds.populate()
+
+        self.conn.set_timestamp('oldest_timestamp=' + self.timestamp_str(1) +
+            ',stable_timestamp=' + self.timestamp_str(1))
+
+        value_a = 'a' * 500
+        value_b = 'b' * 500
+        self.update(ds, value_a, 2)
+        self.update(ds, value_b, 3)
+
+        # Wait for the checkpoint server to write the dirty pages.
+        for i in range(60):
+            if self.get_stat(stat.conn.checkpoint_flush_pages) > 0:
+                break
+            time.sleep(1)
+        self.assertGreater(self.get_stat(stat.conn.checkpoint_flush), 0)
+        self.assertGreater(self.get_stat(stat.conn.checkpoint_flush_pages), 0)
+
+        self.check(ds, value_a, 2)
+        self.check(ds, value_b, 3)
+
+        # Checkpoint, reopen and check both versions are still there.
+        self.conn.set_timestamp('stable_timestamp=' + self.timestamp_str(3))
+        self.session.checkpoint()
+        self.reopen_conn()
+        self.check(ds, value_a, 2)
+        self.check(ds, value_b, 3)
+
+if __name__ == '__main__':
+    wttest.run()
@@ -0,0 +1,98 @@
+#!/usr/bin/env python3
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+import os, wiredtiger, wttest
+from test_chunkcache01 import get_stat, stat_assert_greater
+from wtdataset import SimpleDataSet
+from wtscenario import make_scenarios
+
+# test_chunkcache07.py
+#    Check chunk cache read-ahead: a sequential scan of a flushed object queues the chunks
+#    following the read, and the chunk cache thread reads them in.
+class test_chunkcache07(wttest.WiredTigerTestCase):
+    uri = 'table:test_chunkcache07'
+    rows = 10000
+
+    format_values = [
+        ('column', dict(key_format='r', value_format='S')),
+        ('row_string', dict(key_format='S', value_format='S')),
+    ]
+
+    prefetch_values = [
+        ('prefetch-off', dict(prefetch_chunks=0)),
+        ('prefetch-on', dict(prefetch_chunks=4)),
+    ]
+
+    scenarios = make_scenarios(format_values, prefetch_values)
+
+    def conn_config(self):
+        if not os.path.exists('bucket7'):
+            os.mkdir('bucket7')
+
+        # Don't load freshly flushed data into the chunk cache, the scan must read it.
+        return 'tiered_storage=(auth_token=Secret,bucket=bucket7,bucket_prefix=pfx_,name=dir_store),' \
+            'chunk_cache=[enabled=true,chunk_size=512KB,capacity=20MB,type=DRAM,' \
+            'flushed_data_cache_insertion=false,prefetch_chunks={}],' \
+            'statistics=(all)'.format(self.prefetch_chunks)
+
+    def conn_extensions(self, extlist):
+        if os.name == 'nt':
+            extlist.skip_if_missing = True
+        extlist.extension('storage_sources', 'dir_store')
+
+    def test_chunkcache07(self):
+        ds = SimpleDataSet(
+            self, self.uri, 0, key_format=self.key_format, value_format=self.value_format)
+        ds.populate()
+
+        # Write several chunks worth of data and flush it to the object store.
+        cursor = self.session.open_cursor(self.uri)
+        for i in range(1, self.rows):
+            cursor[ds.key(i)] = str(i) * 100
+        cursor.close()
+        self.session.checkpoint()
+        self.session.checkpoint('flush_tier=(enabled)')
+
+        # Reopen so the table is read back from the object store, then scan it.
+        self.reopen_conn()
+        cursor = self.session.open_cursor(self.uri)
+        i = 0
+        while cursor.next() == 0:
+            i += 1
+            self.assertEqual(cursor.get_value(), str(i) * 100)
+        self.assertEqual(i, self.rows - 1)
+        cursor.close()
+
+        if self.prefetch_chunks == 0:
+            self.assertEqual(get_stat(self.session, wiredtiger.stat.conn.chunkcache_prefetch_queued), 0)
+        else:
+            self.assertGreater(get_stat(self.session, wiredtiger.stat.conn.chunkcache_prefetch_queued), 0)
+            stat_assert_greater(self.session, wiredtiger.stat.conn.chunkcache_prefetch_read, 0)
+
+if __name__ == '__main__':
+    wttest.run()
@@ -0,0 +1,145 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+
+import os
+import wttest
+from wiredtiger import stat
+from wtscenario import make_scenarios
+
+# test_hs33.py
+# Test tables configured with a history store of their own.
+class test_hs33(wttest.WiredTigerTestCase):
+    conn_config = 'cache_size=50MB,statistics=(all)'
+    format_values = [
+        ('column', dict(key_format='r', value_format='S')),
+        ('string-row', dict(key_format='S', value_format='S')),
+    ]
+    scenarios = make_scenarios(format_values)
+    nrows = 1000
+
+    def create_key(self, i):
+        if self.key_format == 'S':
+            return str(i)
+        return i
+
+    def get_hs_uri(self, uri):
+        meta_cursor = self.session.open_cursor('metadata:')
+        file_id = 0
+        for key, value in meta_cursor:
+            if key == uri:
+                file_id = int(value.split(',id=')[1].split(',')[0])
+        meta_cursor.close()
+        self.assertNotEqual(file_id, 0)
+        return 'file:WiredTigerHS.{}.wt'.format(file_id)
+
+    def in_metadata(self, uri):
+        meta_cursor = self.session.open_cursor('metadata:')
+        meta_cursor.set_key(uri)
+        found = meta_cursor.search() == 0
+        meta_cursor.close()
+        return found
+
+    def evict(self, uri):
+        evict_cursor = self.session.open_cursor(uri, None, 'debug=(release_evict)')
+        self.session.begin_transaction()
+        for i in range(1, self.nrows + 1):
+            evict_cursor.set_key(self.create_key(i))
+            evict_cursor.search()
+            evict_cursor.reset()
+        self.session.rollback_transaction()
+        evict_cursor.close()
+
+    def check(self, uri, value, ts):
+        cursor = self.session.open_cursor(uri)
+        self.session.begin_transaction('read_timestamp=' + self.timestamp_str(ts))
+        for i in range(1, self.nrows + 1):
+            self.assertEqual(cursor[self.create_key(i)], value)
+        self.session.rollback_transaction()
+        cursor.close()
+
+    def test_hs_separate(self):
+        uri = 'table:test_hs33'
+        shared_uri = 'table:test_hs33_shared'
+        self.session.create(uri, 'key_format={},value_format={},history_store=(separate=true)'
+            .format(self.key_format, self.value_format))
+        self.session.create(shared_uri,
+            'key_format={},value_format={}'.format(self.key_format, self.value_format))
+
+        # The table's history store is created with the table.
+        hs_uri = self.get_hs_uri('file:test_hs33.wt')
+        self.assertTrue(self.in_metadata(hs_uri))
+        self.assertTrue(os.path.exists(hs_uri[len('file:'):]))
+
+        self.conn.set_timestamp('oldest_timestamp=' + self.timestamp_str(1) +
+            ',stable_timestamp=' + self.timestamp_str(1))
+
+        value1 = 'a' * 500
+        value2 = 'b' * 500
+        for value, ts in ((value1, 2), (value2, 3)):
+            cursor = self.session.open_cursor(uri)
+            for i in range(1, self.nrows + 1):
+                self.session.begin_transaction()
+                cursor[self.create_key(i)] = value
+                self.session.commit_transaction('commit_timestamp=' + self.timestamp_str(ts))
+            cursor.close()
+
+        # Push the older values into the table's history store.
+        hs_writes = self.get_stat(stat.conn.cache_hs_insert)
+        self.evict(uri)
+        self.assertGreater(self.get_stat(stat.conn.cache_hs_insert), hs_writes)
+
+        # Older values are read back from the table's history store.
+        self.check(uri, value1, 2)
+        self.check(uri, value2, 3)
+
+        # Checkpoint, the checkpoint includes the table's history store.
+        self.conn.set_timestamp('stable_timestamp=' + self.timestamp_str(3))
+        self.session.checkpoint()
+        cursor = self.session.open_cursor(uri, None, 'checkpoint=WiredTigerCheckpoint,' +
+            'debug=(checkpoint_read_timestamp=' + self.timestamp_str(2) + ')')
+        self.assertEqual(cursor[self.create_key(1)], value1)
+        cursor.close()
+
+        # The history survives a restart.
+        self.reopen_conn()
+        self.check(uri, value1, 2)
+        self.check(uri, value2, 3)
+
+        # Dropping the table drops its history store, the shared history store is untouched.
+        self.session.drop(uri)
+        self.assertFalse(self.in_metadata(hs_uri))
+        self.assertFalse(os.path.exists(hs_uri[len('file:'):]))
+        self.assertTrue(self.in_metadata('file:WiredTigerHS.wt'))
+        self.session.drop(shared_uri)
+
+    def get_stat(self, s):
+        stat_cursor = self.session.open_cursor('statistics:')
+        val = stat_cursor[s][2]
+        stat_cursor.close()
+        return val
@@ -0,0 +1,117 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+
+import wiredtiger, wttest
+from wiredtiger import stat
+from wtscenario import make_scenarios
+
+# test_hs34.py
+# Test that history store searches for keys without history are skipped by the bloom filter.
+class test_hs34(wttest.WiredTigerTestCase):
+    conn_config = 'cache_size=50MB,statistics=(all)'
+    format_values = [
+        ('column', dict(key_format='r', value_format='S')),
+        ('string-row', dict(key_format='S', value_format='S')),
+    ]
+    scenarios = make_scenarios(format_values)
+    nrows = 1000
+
+    def create_key(self, i):
+        if self.key_format == 'S':
+            return str(i)
+        return i
+
+    def get_stat(self, stat):
+        stat_cursor = self.session.open_cursor('statistics:')
+        val = stat_cursor[stat][2]
+        stat_cursor.close()
+        return val
+
+    def check(self, uri):
+        skip = self.get_stat(stat.conn.cache_hs_bloom_skip)
+        false_positive = self.get_stat(stat.conn.cache_hs_bloom_false_positive)
+
+        # Keys with history are found, keys created later are not and don't search the history
+        # store.
+        cursor = self.session.open_cursor(uri)
+        self.session.begin_transaction('read_timestamp=' + self.timestamp_str(2))
+        for i in range(1, 2 * self.nrows + 1):
+            cursor.set_key(self.create_key(i))
+            if i <= self.nrows:
+                self.assertEqual(cursor.search(), 0)
+                self.assertEqual(cursor.get_value(), 'a' * 100)
+            else:
+                self.assertEqual(cursor.search(), wiredtiger.WT_NOTFOUND)
+        self.session.rollback_transaction()
+        cursor.close()
+
+        skipped = self.get_stat(stat.conn.cache_hs_bloom_skip) - skip
+        false_positives = self.get_stat(stat.conn.cache_hs_bloom_false_positive) - false_positive
+        self.assertGreater(skipped, 0)
+        self.assertGreaterEqual(skipped + false_positives, self.nrows)
+        self.assertGreater(self.get_stat(stat.conn.cache_hs_bloom_build), 0)
+
+    def test_hs_bloom(self):
+        uri = 'table:hs34'
+        self.session.create(uri, 'key_format={},value_format={}'.format(
+            self.key_format, self.value_format))
+        self.conn.set_timestamp('oldest_timestamp=' + self.timestamp_str(1) +
+            ',stable_timestamp=' + self.timestamp_str(1))
+
+        # Half the keys have a value at timestamp 2 and another at timestamp 3, the other half only
+        # exist from timestamp 3.
+        cursor = self.session.open_cursor(uri)
+        for ts, value in ((2, 'a' * 100), (3, 'b' * 100)):
+            for i in range(1, 2 * self.nrows + 1):
+                if ts == 2 and i > self.nrows:
+                    continue
+                self.session.begin_transaction()
+                cursor[self.create_key(i)] = value
+                self.session.commit_transaction('commit_timestamp=' + self.timestamp_str(ts))
+        cursor.close()
+
+        # Evict the pages to move the older values into the history store.
+        evict_cursor = self.session.open_cursor(uri, None, 'debug=(release_evict)')
+        self.session.begin_transaction()
+        for i in range(1, 2 * self.nrows + 1):
+            evict_cursor.set_key(self.create_key(i))
+            evict_cursor.search()
+            evict_cursor.reset()
+        self.session.rollback_transaction()
+        evict_cursor.close()
+        self.check(uri)
+
+        # After a restart, the filter is built from the history store.
+        self.conn.set_timestamp('stable_timestamp=' + self.timestamp_str(3))
+        self.session.checkpoint()
+        self.reopen_conn()
+        self.check(uri)
+
+if __name__ == '__main__':
+    wttest.run()
@@ -0,0 +1,106 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+
+import wiredtiger, wttest
+from wtscenario import make_scenarios
+
+# test_hs35.py
+# Test the limit on consecutive reverse modifies written to the history store.
+class test_hs35(wttest.WiredTigerTestCase):
+    conn_config = 'cache_size=50MB,statistics=(all)'
+    reverse_modify_values = [
+        ('disabled', dict(reverse_modify_max=0)),
+        ('four', dict(reverse_modify_max=4)),
+        ('default', dict(reverse_modify_max=10)),
+    ]
+    scenarios = make_scenarios(reverse_modify_values)
+    nversions = 20
+    value_size = 10000
+
+    def get_value(self, ts):
+        value = list('x' * self.value_size)
+        for i in range(2, ts + 1):
+            value[i * 37] = chr(ord('a') + i % 26)
+        return ''.join(value)
+
+    def get_stat(self, stat):
+        stat_cursor = self.session.open_cursor('statistics:')
+        val = stat_cursor[stat][2]
+        stat_cursor.close()
+        return val
+
+    def test_reverse_modify_max(self):
+        uri = 'table:hs35'
+        self.session.create(uri, 'key_format=i,value_format=S,' +
+            'history_store=(reverse_modify_max={})'.format(self.reverse_modify_max))
+        self.conn.set_timestamp('oldest_timestamp=' + self.timestamp_str(1) +
+            ',stable_timestamp=' + self.timestamp_str(1))
+
+        # Write versions of a large value that differ by a byte.
+        cursor = self.session.open_cursor(uri)
+        for ts in range(2, self.nversions + 1):
+            self.session.begin_transaction()
+            cursor[1] = self.get_value(ts)
+            self.session.commit_transaction('commit_timestamp=' + self.timestamp_str(ts))
+        cursor.close()
+
+        # Evict the page to move the older versions into the history store.
+        evict_cursor = self.session.open_cursor(uri, None, 'debug=(release_evict)')
+        self.session.begin_transaction()
+        evict_cursor.set_key(1)
+        self.assertEqual(evict_cursor.search(), 0)
+        evict_cursor.reset()
+        self.session.rollback_transaction()
+        evict_cursor.close()
+
+        # Every version but the on-page value is in the history store, the newest one in full.
+        full = self.get_stat(wiredtiger.stat.conn.cache_hs_insert_full_update)
+        reverse_modify = self.get_stat(wiredtiger.stat.conn.cache_hs_insert_reverse_modify)
+        self.assertEqual(full + reverse_modify, self.nversions - 2)
+        self.assertEqual(full, -(-(self.nversions - 2) // (self.reverse_modify_max + 1)))
+        saved = self.get_stat(wiredtiger.stat.conn.cache_hs_insert_reverse_modify_saved)
+        if self.reverse_modify_max == 0:
+            self.assertEqual(saved, 0)
+        else:
+            self.assertGreater(saved, reverse_modify * (self.value_size // 2))
+
+        # Every version reads back.
+        cursor = self.session.open_cursor(uri)
+        for ts in range(2, self.nversions + 1):
+            self.session.begin_transaction('read_timestamp=' + self.timestamp_str(ts))
+            self.assertEqual(cursor[1], self.get_value(ts))
+            self.session.rollback_transaction()
+        cursor.close()
+
+        # Reads apply no more reverse modifies than the limit.
+        applied = self.get_stat(wiredtiger.stat.conn.cache_hs_read_squash_modify)
+        self.assertLessEqual(applied, (self.nversions - 2) * self.reverse_modify_max)
+
+if __name__ == '__main__':
+    wttest.run()
@@ -0,0 +1,103 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+import threading
+import wttest
+from wiredtiger import stat
+from wtscenario import make_scenarios
+
+# test_log05.py
+#    Synchronous commits with a commit latency target, where the log holds a group of synchronous
+#    commits open so they can share a sync.
+class test_log05(wttest.WiredTigerTestCase):
+    uri = 'table:test_log05'
+    nthreads = 8
+    nrecords = 200
+
+    target = [
+        ('no-target', dict(target=0)),
+        ('target', dict(target=2000)),
+    ]
+    method = [
+        ('dsync', dict(method='dsync')),
+        ('fsync', dict(method='fsync')),
+    ]
+    scenarios = make_scenarios(target, method)
+
+    def conn_config(self):
+        return 'log=(enabled),statistics=(all),' + \
+            'transaction_sync=(enabled,latency_target={},method={})'.format(
+            self.target, self.method)
+
+    def get_stat(self, which):
+        stat_cursor = self.session.open_cursor('statistics:')
+        val = stat_cursor[which][2]
+        stat_cursor.close()
+        return val
+
+    def writer(self, id):
+        session = self.conn.open_session()
+        cursor = session.open_cursor(self.uri)
+        for i in range(self.nrecords):
+            session.begin_transaction()
+            cursor[id * self.nrecords + i + 1] = 'value' + str(i)
+            session.commit_transaction()
+        session.close()
+
+    def test_log_group_commit(self):
+        self.session.create(self.uri, 'key_format=Q,value_format=S')
+
+        threads = [threading.Thread(target=self.writer, args=(i,)) for i in range(self.nthreads)]
+        for t in threads:
+            t.start()
+        for t in threads:
+            t.join()
+
+        # Every synchronous commit is in the latency histogram, and was in a group.
+        ncommits = self.nthreads * self.nrecords
+        latency = sum(self.get_stat(s) for s in [
+            stat.conn.log_group_latency_lt100, stat.conn.log_group_latency_lt250,
+            stat.conn.log_group_latency_lt500, stat.conn.log_group_latency_lt1000,
+            stat.conn.log_group_latency_lt10000, stat.conn.log_group_latency_gt10000])
+        self.assertGreaterEqual(latency, ncommits)
+        groups = sum(self.get_stat(s) for s in [
+            stat.conn.log_group_size_1, stat.conn.log_group_size_lt4,
+            stat.conn.log_group_size_lt8, stat.conn.log_group_size_lt16,
+            stat.conn.log_group_size_lt32, stat.conn.log_group_size_gt32])
+        self.assertGreater(groups, 0)
+        if self.target == 0:
+            self.assertEqual(self.get_stat(stat.conn.log_group_holds), 0)
+
+        # Everything committed is durable.
+        self.reopen_conn()
+        cursor = self.session.open_cursor(self.uri)
+        self.assertEqual(sum(1 for _ in cursor), ncommits)
+        cursor.close()
+
+if __name__ == '__main__':
+    wttest.run()
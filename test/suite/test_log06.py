@@ -0,0 +1,86 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+import time
+import wttest
+from wiredtiger import stat
+
+# test_log06.py
+#    Log slot buffers grow when records are too large to be buffered, keeping the memory used by the
+#    slot pool the same by using fewer slots.
+class test_log06(wttest.WiredTigerTestCase):
+    uri = 'table:test_log06'
+    conn_config = 'log=(enabled),statistics=(all)'
+    nrecords = 300
+
+    def get_stat(self, which):
+        stat_cursor = self.session.open_cursor('statistics:')
+        val = stat_cursor[which][2]
+        stat_cursor.close()
+        return val
+
+    def test_log_slot_resize(self):
+        self.session.create(self.uri, 'key_format=Q,value_format=S')
+        initial_size = self.get_stat(stat.conn.log_slot_buffer_size)
+        initial_depth = self.get_stat(stat.conn.log_slot_pool_depth)
+        total = self.get_stat(stat.conn.log_buffer_size)
+        self.assertEqual(initial_size * initial_depth, total)
+
+        # Records between half and all of the initial buffer size are written unbuffered until the
+        # log server grows the buffers, which it checks once a second.
+        value = 'a' * (initial_size * 3 // 4)
+        cursor = self.session.open_cursor(self.uri)
+        key = 0
+        for i in range(60):
+            for j in range(self.nrecords):
+                key += 1
+                cursor[key] = value
+                cursor[key + 1000000] = 'b'
+            if self.get_stat(stat.conn.log_slot_buffer_grow_unbuffered) > 0:
+                break
+            time.sleep(0.5)
+        cursor.close()
+
+        self.assertGreater(self.get_stat(stat.conn.log_slot_buffer_grow_unbuffered), 0)
+        size = self.get_stat(stat.conn.log_slot_buffer_size)
+        depth = self.get_stat(stat.conn.log_slot_pool_depth)
+        self.assertGreaterEqual(size, 2 * len(value))
+        self.assertLess(depth, initial_depth)
+        self.assertEqual(size * depth, total)
+        self.assertEqual(self.get_stat(stat.conn.log_buffer_size), total)
+
+        # The records written on either side of the resize are recovered.
+        self.reopen_conn()
+        cursor = self.session.open_cursor(self.uri)
+        for k in range(1, key + 1):
+            self.assertEqual(cursor[k], value)
+            self.assertEqual(cursor[k + 1000000], 'b')
+        cursor.close()
+
+if __name__ == '__main__':
+    wttest.run()
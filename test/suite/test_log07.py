@@ -0,0 +1,106 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+import time
+import helper, wttest
+from suite_subprocess import suite_subprocess
+from wiredtiger import stat
+from wtscenario import make_scenarios
+
+# test_log07.py
+#    Log records compressed with a dictionary built from recent records are recovered and printed
+#    from the dictionaries stored in the log files.
+class test_log07(wttest.WiredTigerTestCase, suite_subprocess):
+    uri = 'table:test_log07'
+    nrecords = 500
+
+    compress = [
+        ('zlib', dict(compressor='zlib')),
+        ('zstd', dict(compressor='zstd')),
+    ]
+    scenarios = make_scenarios(compress)
+
+    def log_config(self):
+        return 'log=(enabled,compressor=%s,dictionary_size=4KB,file_max=100K,remove=false)' % \
+            self.compressor
+
+    def conn_config(self):
+        return self.log_config() + ',statistics=(all)'
+
+    def conn_extensions(self, extlist):
+        extlist.skip_if_missing = True
+        extlist.extension('compressors', self.compressor)
+
+    def get_stat(self, which):
+        stat_cursor = self.session.open_cursor('statistics:')
+        val = stat_cursor[which][2]
+        stat_cursor.close()
+        return val
+
+    def value(self, i):
+        # Small records that share structure across records, but not much within one record.
+        return '{"user": "user%06d", "email": "user%06d@example.com", "count": %d, ' \
+            '"tags": ["alpha", "beta", "gamma"], "city": "Springfield"}' % (i, i, i * 7)
+
+    def test_log_dictionary(self):
+        self.session.create(self.uri, 'key_format=Q,value_format=S')
+
+        # The log server builds a dictionary from samples once a second, and it is used once a new
+        # log file is started.
+        cursor = self.session.open_cursor(self.uri)
+        key = 0
+        for i in range(60):
+            for j in range(self.nrecords):
+                key += 1
+                cursor[key] = self.value(key)
+            if self.get_stat(stat.conn.log_compress_dict_writes) > 0:
+                break
+            time.sleep(0.5)
+        cursor.close()
+        self.assertGreater(self.get_stat(stat.conn.log_compress_dict_builds), 0)
+        self.assertGreater(self.get_stat(stat.conn.log_compress_dict_writes), 0)
+        self.assertGreater(self.get_stat(stat.conn.log_compress_ratio), 100)
+        self.assertGreater(self.get_stat(stat.conn.log_compress_time), 0)
+
+        # Recovery decompresses the records with the dictionaries stored in the log files.
+        self.session.log_flush('sync=on')
+        helper.simulate_crash_restart(self, ".", "RESTART")
+        cursor = self.session.open_cursor(self.uri)
+        for k in range(1, key + 1):
+            self.assertEqual(cursor[k], self.value(k))
+        cursor.close()
+        self.assertGreater(self.get_stat(stat.conn.log_decompress_time), 0)
+
+        # Printlog reads the dictionaries and marks the records compressed with one.
+        config = self.log_config() + self.extensionsConfig()
+        self.runWt(['-C', config, '-h', 'RESTART', 'printlog'], outfilename='printlog.out')
+        self.check_file_contains('printlog.out', '"optype": "log_dictionary"')
+        self.check_file_contains('printlog.out', '"hdr_flags" : "compressed,dictionary"')
+
+if __name__ == '__main__':
+    wttest.run()
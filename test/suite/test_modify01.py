@@ -0,0 +1,99 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+
+import wiredtiger, wttest
+from wiredtiger import stat
+
+# test_modify01.py
+#    A long chain of modifies that becomes globally visible is consolidated into a full value, and
+#    readers at every point in the chain see the right value.
+class test_modify01(wttest.WiredTigerTestCase):
+    uri = 'table:test_modify01'
+    conn_config = 'statistics=(all)'
+    nmodifies = 30
+    value_size = 100000
+
+    def get_stat(self, which):
+        stat_cursor = self.session.open_cursor('statistics:' + self.uri)
+        val = stat_cursor[which][2]
+        stat_cursor.close()
+        return val
+
+    def test_modify_consolidate(self):
+        self.session.create(self.uri, 'key_format=S,value_format=S')
+
+        # Pin a snapshot older than the base value, so updates don't write full values as the
+        # chain of modifies grows.
+        pinned = self.conn.open_session()
+        pinned_cursor = pinned.open_cursor(self.uri)
+        pinned.begin_transaction()
+        pinned_cursor.set_key('k')
+        self.assertEqual(pinned_cursor.search(), wiredtiger.WT_NOTFOUND)
+
+        cursor = self.session.open_cursor(self.uri)
+        value = 'a' * self.value_size
+        cursor['k'] = value
+        for i in range(self.nmodifies):
+            self.session.begin_transaction()
+            cursor.set_key('k')
+            self.assertEqual(cursor.modify([wiredtiger.Modify('b', i, 1)]), 0)
+            self.session.commit_transaction()
+        value = 'b' * self.nmodifies + value[self.nmodifies:]
+        pinned.rollback_transaction()
+
+        # Checkpoint to move the oldest transaction ID forward.
+        self.session.checkpoint()
+
+        # A reader that sees the last modify, then another update: the modifies are now globally
+        # visible and the chain is consolidated.
+        reader = self.conn.open_session()
+        reader_cursor = reader.open_cursor(self.uri)
+        reader.begin_transaction()
+        reader_cursor.set_key('k')
+        self.assertEqual(reader_cursor.search(), 0)
+        cursor['k'] = 'XXXX'
+        self.assertEqual(self.get_stat(stat.dsrc.cache_update_chain_consolidate), 1)
+        self.assertEqual(
+            self.get_stat(stat.dsrc.cache_update_chain_consolidate_modify), self.nmodifies)
+        self.assertGreater(self.get_stat(stat.dsrc.cache_update_chain_lt100), 0)
+
+        self.assertEqual(reader_cursor.get_value(), value)
+        reader_cursor.reset()
+        reader_cursor.set_key('k')
+        self.assertEqual(reader_cursor.search(), 0)
+        self.assertEqual(reader_cursor.get_value(), value)
+        reader.rollback_transaction()
+
+        # Later updates truncate the chain once the reader is gone.
+        for i in range(10):
+            cursor['k'] = 'Y' * (i + 1)
+        self.assertEqual(cursor['k'], 'Y' * 10)
+
+if __name__ == '__main__':
+    wttest.run()
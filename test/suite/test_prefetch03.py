@@ -0,0 +1,89 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+
+import os, time
+import wiredtiger, wttest
+
+# test_prefetch03.py
+#    Check warm restart: the pages in cache are recorded when the connection is closed and queued
+#    for pre-fetch when it's reopened.
+class test_prefetch03(wttest.WiredTigerTestCase):
+    nrows = 10000
+    uri = 'file:test_prefetch03'
+    conn_config = 'prefetch=(available=true,warm_restart=true),statistics=(all)'
+
+    def get_stat(self, stat):
+        stat_cursor = self.session.open_cursor('statistics:')
+        val = stat_cursor[stat][2]
+        stat_cursor.close()
+        return val
+
+    def test_prefetch_warm_restart(self):
+        self.session.create(self.uri, 'allocation_size=512,leaf_page_max=512,'
+            'key_format=i,value_format=S')
+        c = self.session.open_cursor(self.uri)
+        for i in range(1, self.nrows):
+            c[i] = 'value' + str(i)
+        c.close()
+        self.session.checkpoint()
+
+        # Read the table back so it's in cache, with no dirty pages.
+        self.reopen_conn()
+        c = self.session.open_cursor(self.uri)
+        for i in range(1, self.nrows):
+            self.assertEqual(c[i], 'value' + str(i))
+        c.close()
+
+        # Closing the connection writes the list of pages.
+        self.close_conn()
+        self.assertTrue(os.path.exists('WiredTiger.warm'))
+
+        # Reopening the connection queues the pages for pre-fetch, in the background.
+        self.open_conn()
+        for i in range(100):
+            if self.get_stat(wiredtiger.stat.conn.prefetch_warm_pages_queued) > 0:
+                break
+            time.sleep(0.1)
+        self.assertGreater(self.get_stat(wiredtiger.stat.conn.prefetch_warm_pages_queued), 0)
+        self.assertEqual(self.get_stat(wiredtiger.stat.conn.prefetch_warm_pages_missing), 0)
+
+        # The data is unchanged.
+        c = self.session.open_cursor(self.uri)
+        for i in range(1, self.nrows):
+            self.assertEqual(c[i], 'value' + str(i))
+        c.close()
+
+    def test_prefetch_warm_restart_requires_prefetch(self):
+        self.close_conn()
+        self.assertRaisesWithMessage(wiredtiger.WiredTigerError,
+            lambda: self.wiredtiger_open('.', 'prefetch=(available=false,warm_restart=true)'),
+            '/requires prefetch.available/')
+
+if __name__ == '__main__':
+    wttest.run()
@@ -0,0 +1,116 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+import wiredtiger, wttest
+from helper import copy_wiredtiger_home
+from wtscenario import make_scenarios
+
+# test_txn28.py
+#   Recovery applying log records with several threads recovers the same data as recovery on a
+#   single thread, including modifies and truncates.
+class test_txn28(wttest.WiredTigerTestCase):
+    conn_config = 'log=(enabled)'
+    nops = 5000
+
+    format_values = [
+        ('row', dict(key_format='S', value_format='S')),
+        ('var', dict(key_format='r', value_format='S')),
+    ]
+    scenarios = make_scenarios(format_values)
+
+    def key(self, i):
+        return 'key%06d' % i if self.key_format == 'S' else i + 1
+
+    def contents(self, conn, uris):
+        session = conn.open_session()
+        result = []
+        for uri in uris:
+            cursor = session.open_cursor(uri)
+            result.append(list(cursor))
+            cursor.close()
+        session.close()
+        return result
+
+    def test_recover_threads(self):
+        uris = ['table:test_txn28_a', 'table:test_txn28_b']
+        create_config = 'key_format={},value_format={}'.format(self.key_format, self.value_format)
+        for uri in uris:
+            self.session.create(uri, create_config)
+        self.session.checkpoint()
+
+        # Repeatedly update a small set of keys so each key has a history of operations in the
+        # log that must be applied in order.
+        cursors = [self.session.open_cursor(uri) for uri in uris]
+        for i in range(self.nops):
+            cursor = cursors[i % 2]
+            k = self.key(i * 7 % 300)
+            self.session.begin_transaction()
+            if i % 11 == 0:
+                cursor.set_key(k)
+                cursor.remove()
+            elif i % 5 == 0:
+                cursor.set_key(k)
+                if cursor.search() == 0:
+                    mods = [wiredtiger.Modify('M' + str(i), 2, 3)]
+                    self.assertEqual(cursor.modify(mods), 0)
+                cursor.reset()
+            else:
+                cursor[k] = 'value' + str(i) + '.' * (i % 50)
+            self.session.commit_transaction()
+
+            # Occasionally truncate a range of keys.
+            if i % 997 == 0:
+                start = self.session.open_cursor(uris[0])
+                stop = self.session.open_cursor(uris[0])
+                start.set_key(self.key(i % 100))
+                stop.set_key(self.key(i % 100 + 20))
+                self.session.truncate(None, start, stop, None)
+                start.close()
+                stop.close()
+        for cursor in cursors:
+            cursor.close()
+        self.session.log_flush('sync=on')
+
+        # Copy the database with the connection open, then recover each copy.
+        copy_wiredtiger_home(self, '.', 'RESTART_SERIAL')
+        copy_wiredtiger_home(self, '.', 'RESTART_PARALLEL')
+        expected = self.contents(self.conn, uris)
+
+        conn = self.wiredtiger_open('RESTART_SERIAL', 'log=(enabled,recover_threads=0)')
+        serial = self.contents(conn, uris)
+        conn.close()
+
+        conn = self.wiredtiger_open('RESTART_PARALLEL', 'log=(enabled,recover_threads=4)')
+        parallel = self.contents(conn, uris)
+        conn.close()
+
+        self.assertEqual(serial, expected)
+        self.assertEqual(parallel, expected)
+
+if __name__ == '__main__':
+    wttest.run()